@@ -0,0 +1,679 @@
+/*** LICENSE: LGPLV2. *************************************
+ *                                                        *
+ *                                                        *
+ * This file is a part of the j2 project.                 *
+ * Copyright (C) 2022 Joško Križanović                    *
+ * <jkriza02@fesb.com>                                    *
+ *                                                        *
+ * This library is free software; you can redistribute    *
+ * it and/or modify it under the terms of the GNU Lesser  *
+ * General Public License as published by the Free        *
+ * Software Foundation; either version 2.1 of the         *
+ * License, or (at your option) any later version.        *
+ *                                                        *
+ * This library is distributed in the hope that it will   *
+ * be useful,                                             *
+ * but WITHOUT ANY WARRANTY; without even the implied     *
+ * warranty of MERCHANTABILITY or FITNESS FOR A           *
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public  *
+ * License for more details.                              *
+ *                                                        *
+ * You should have received a copy of the GNU Lesser      *
+ * General Public License along with this library; if     *
+ * not, write to the Free Software Foundation, Inc.,      *
+ * 51 Franklin Street, Fifth Floor, Boston,               *
+ * MA  02110-1301  USA                                    *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: FILE, AUTHOR & DATE INFORMATION. *********
+ *                                                        *
+ *                                                        *
+ * FILE:                                                  *
+ * Benchmarks of the string primitives against their      *
+ * <string.h> equivalents.                                *
+ *                                                        *
+ *                                                        *
+ * AUTHOR:                                                *
+ *      NAME:  Joško Križanović                           *
+ *      EMAIL: jkriza02@fesb.com                          *
+ *                                                        *
+ *                                                        *
+ * DATE:                                                  *
+ * 19.10.2026.                                            *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+
+/**
+ * @brief 
+ * Run with @c "make bench", results are written as JSON to 
+ * @c bench/bench.json (or @c -o FILE), progress goes to stderr.
+ * 
+ *      --quick        sizes up to 1 MiB and fewer repetitions,
+ *      --max BYTES    biggest size to run,
+ *      --filter NAME  only benchmarks whose name contains NAME,
+ *      --time MS      time of a single repetition, default 5,
+ *      -o FILE        where to write the JSON to, default stdout.
+ * 
+ * Every operation is called through a function pointer, on both sides, 
+ * so the numbers of tiny sizes include a couple of ns of call overhead.
+ * Build the library with DEBUG=f, numbers of the debug build are marked 
+ * as "build": "dev" in the output.
+ */
+
+/// clock_gettime(CLOCK_MONOTONIC).
+#define _POSIX_C_SOURCE 199309L
+
+#include "../j2.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <locale.h>
+#include <time.h>
+
+#define BENCH_ALIGNMENT 64
+#define BENCH_REPEAT    5
+#define BENCH_MIN_SIZE  8
+#define BENCH_MAX_SIZE  (64 * 1024 * 1024)
+
+#ifdef __VERSION__
+#define BENCH_COMPILER  __VERSION__
+#else
+#define BENCH_COMPILER  "unknown"
+#endif
+
+/**
+ * @brief 
+ * Everything a single operation works on, set up once for every size,
+ * mix and alignment.
+ */
+struct bench_input {
+
+        size_t   bytes;
+        /// Raw NUL terminated copy of the data, @c "align" bytes past a 
+        /// cache line.
+        char *   src;
+        char *   dst;
+        /// The same data as static j2strings, dst fits all of it.
+        j2string jsrc;
+        j2string jsrc2;
+        j2string jdst;
+        /// Every byte of the data / none of the bytes of the data.
+        j2string accept;
+        j2string reject;
+        unsigned char present;
+        unsigned char absent;
+
+};
+
+typedef size_t (*bench_op)(struct bench_input * in);
+
+static size_t op_strlen_sn(struct bench_input * in) {
+        return j2string_strlen_sn(in->src, in->bytes + 1);
+}
+static size_t op_strlen(struct bench_input * in) {
+        return strlen(in->src);
+}
+static size_t op_strcpy_sn(struct bench_input * in) {
+        return j2string_strcpy_sn(in->dst, in->src, in->bytes);
+}
+static size_t op_strcpy(struct bench_input * in) {
+        return (size_t)strcpy(in->dst, in->src);
+}
+static size_t op_utf8_strlen_sn(struct bench_input * in) {
+        return j2string_utf8_strlen_sn(in->src, in->bytes + 1, NULL);
+}
+static size_t op_mbstowcs(struct bench_input * in) {
+        return mbstowcs(NULL, in->src, 0);
+}
+static size_t op_utf8_strcpy_sn(struct bench_input * in) {
+        return j2string_utf8_strcpy_sn(in->dst, in->src, in->bytes, NULL);
+}
+static size_t op_utf8_nhbc_strcpy_sn(struct bench_input * in) {
+        return j2string_utf8_nhbc_strcpy_sn(in->dst, in->src, in->bytes, 
+                                            NULL);
+}
+static size_t op_cpy(struct bench_input * in) {
+        return (size_t)j2string_cpy(&in->jdst, in->jsrc);
+}
+static size_t op_noutf8_cpy(struct bench_input * in) {
+        return (size_t)j2string_noutf8_cpy(&in->jdst, in->jsrc);
+}
+static size_t op_jstrcpy(struct bench_input * in) {
+        return (size_t)strcpy(in->jdst, in->jsrc);
+}
+static size_t op_cat(struct bench_input * in) {
+        j2string_clear(in->jdst);
+        return (size_t)j2string_cat(&in->jdst, in->jsrc);
+}
+static size_t op_noutf8_cat(struct bench_input * in) {
+        j2string_clear(in->jdst);
+        return (size_t)j2string_noutf8_cat(&in->jdst, in->jsrc);
+}
+static size_t op_ccat(struct bench_input * in) {
+        j2string_clear(in->jdst);
+        return (size_t)j2string_ccat(&in->jdst, in->src);
+}
+static size_t op_noutf8_ccat(struct bench_input * in) {
+        j2string_clear(in->jdst);
+        return (size_t)j2string_noutf8_ccat(&in->jdst, in->src);
+}
+static size_t op_strcat(struct bench_input * in) {
+        in->jdst[0] = '\0';
+        return (size_t)strcat(in->jdst, in->jsrc);
+}
+static size_t op_cmp(struct bench_input * in) {
+        return (size_t)j2string_cmp(in->jsrc, in->jsrc2);
+}
+static size_t op_strcmp(struct bench_input * in) {
+        return (size_t)strcmp(in->jsrc, in->jsrc2);
+}
+static size_t op_chrs(struct bench_input * in) {
+        return (size_t)j2string_chrs(in->jsrc, in->absent, 0);
+}
+static size_t op_strchr(struct bench_input * in) {
+        return (size_t)strchr(in->jsrc, in->absent);
+}
+static size_t op_rchrs(struct bench_input * in) {
+        return (size_t)j2string_rchrs(in->jsrc, in->absent, 
+                                      (long)in->bytes - 1);
+}
+static size_t op_strrchr(struct bench_input * in) {
+        return (size_t)strrchr(in->jsrc, in->absent);
+}
+static size_t op_cnt(struct bench_input * in) {
+        return (size_t)j2string_cnt(in->jsrc, in->present);
+}
+static size_t op_memchr_count(struct bench_input * in) {
+        size_t       count = 0;
+        const char * at    = in->jsrc;
+        const char * end   = in->jsrc + in->bytes;
+        while((at = memchr(at, in->present, (size_t)(end - at)))) {
+                count++;
+                at++;
+        }
+        return count;
+}
+static size_t op_spn(struct bench_input * in) {
+        return (size_t)j2string_spn(in->jsrc, in->accept);
+}
+static size_t op_strspn(struct bench_input * in) {
+        return strspn(in->jsrc, in->accept);
+}
+static size_t op_cspn(struct bench_input * in) {
+        return (size_t)j2string_cspn(in->jsrc, in->reject);
+}
+static size_t op_strcspn(struct bench_input * in) {
+        return strcspn(in->jsrc, in->reject);
+}
+
+/**
+ * @brief 
+ * A j2 primitive and its libc equivalent. Raw benchmarks take plain 
+ * char* and are run at every alignment, the rest work on j2strings whose
+ * alignment is fixed by the header in front of them.
+ */
+struct bench_case {
+
+        const char * name;
+        const char * j2_function;
+        bench_op     j2_op;
+        const char * libc_function;
+        bench_op     libc_op;
+        bool         raw;
+        bool         locale;
+
+};
+
+static const struct bench_case bench_cases[] = {
+        {"strlen_sn",           "j2string_strlen_sn",      op_strlen_sn,
+         "strlen",              op_strlen,                 true,  false},
+        {"strcpy_sn",           "j2string_strcpy_sn",      op_strcpy_sn,
+         "strcpy",              op_strcpy,                 true,  false},
+        {"utf8_strlen_sn",      "j2string_utf8_strlen_sn", op_utf8_strlen_sn,
+         "mbstowcs",            op_mbstowcs,               true,  true },
+        {"utf8_strcpy_sn",      "j2string_utf8_strcpy_sn", op_utf8_strcpy_sn,
+         "strcpy",              op_strcpy,                 true,  false},
+        {"utf8_nhbc_strcpy_sn", "j2string_utf8_nhbc_strcpy_sn", 
+         op_utf8_nhbc_strcpy_sn,
+         "strcpy",              op_strcpy,                 true,  false},
+        {"cpy",                 "j2string_cpy",            op_cpy,
+         "strcpy",              op_jstrcpy,                false, false},
+        {"noutf8_cpy",          "j2string_noutf8_cpy",     op_noutf8_cpy,
+         "strcpy",              op_jstrcpy,                false, false},
+        {"cat",                 "j2string_cat",            op_cat,
+         "strcat",              op_strcat,                 false, false},
+        {"noutf8_cat",          "j2string_noutf8_cat",     op_noutf8_cat,
+         "strcat",              op_strcat,                 false, false},
+        {"ccat",                "j2string_ccat",           op_ccat,
+         "strcat",              op_strcat,                 false, false},
+        {"noutf8_ccat",         "j2string_noutf8_ccat",    op_noutf8_ccat,
+         "strcat",              op_strcat,                 false, false},
+        {"cmp",                 "j2string_cmp",            op_cmp,
+         "strcmp",              op_strcmp,                 false, false},
+        {"chrs",                "j2string_chrs",           op_chrs,
+         "strchr",              op_strchr,                 false, false},
+        {"rchrs",               "j2string_rchrs",          op_rchrs,
+         "strrchr",             op_strrchr,                false, false},
+        {"cnt",                 "j2string_cnt",            op_cnt,
+         "memchr loop",         op_memchr_count,           false, false},
+        {"spn",                 "j2string_spn",            op_spn,
+         "strspn",              op_strspn,                 false, false},
+        {"cspn",                "j2string_cspn",           op_cspn,
+         "strcspn",             op_strcspn,                false, false},
+};
+
+#define BENCH_CASES (sizeof(bench_cases) / sizeof(bench_cases[0]))
+
+static const size_t bench_alignments[] = {0, 1, 7};
+#define BENCH_ALIGNMENTS (sizeof(bench_alignments) / sizeof(size_t))
+
+static const char * const bench_mixes[] = {"ascii", "utf8"};
+
+static volatile size_t bench_sink;
+
+static uint64_t
+bench_now(
+        void )
+{
+        struct timespec now;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        return (uint64_t)now.tv_sec * 1000000000u + (uint64_t)now.tv_nsec;
+}
+
+static uint64_t
+bench_run(
+        bench_op op,
+        struct bench_input * in,
+        size_t iterations )
+{
+
+        size_t   sink  = 0;
+        uint64_t start = bench_now();
+        for(size_t i = 0; i < iterations; i++) sink += op(in);
+        uint64_t time  = bench_now() - start;
+
+        bench_sink += sink;
+        return time ? time : 1;
+
+}
+
+/**
+ * @brief 
+ * Find an amount of iterations that takes about @c "target" ns, then 
+ * return the best ns per operation out of @c "repeat" runs of it.
+ */
+static double
+bench_measure(
+        bench_op op,
+        struct bench_input * in,
+        uint64_t target,
+        unsigned repeat,
+        size_t * iterations )
+{
+
+        size_t   n    = 1;
+        uint64_t time = bench_run(op, in, n);
+
+        while(time < target / 8 && n < ((size_t)1 << 40)) {
+                n   *= 2;
+                time = bench_run(op, in, n);
+        }
+        if(time < target) n = (size_t)((double)n * target / time) + 1;
+
+        double best = (double)time / n;
+        for(unsigned r = 0; r < repeat; r++) {
+                double ns = (double)bench_run(op, in, n) / n;
+                if(ns < best) best = ns;
+        }
+
+        (*iterations) = n;
+        return best;
+
+}
+
+/**
+ * @brief 
+ * Fill @c "data" with @c "bytes" of random text of a mix, ASCII letters 
+ * or letters with 2, 3 and 4 byte UTF-8 characters in between. Never 
+ * holds '#', '$' or '%'.
+ */
+static void
+bench_generate(
+        char * data,
+        size_t bytes,
+        bool utf8 )
+{
+
+        static const char * const wide[] = {"\xc5\xa1", "\xe2\x82\xac", 
+                                            "\xf0\x9f\x8d\x8c"};
+        uint64_t state = 0x9e3779b97f4a7c15u;
+        size_t   at    = 0;
+
+        while(at < bytes) {
+                state ^= state << 13;
+                state ^= state >> 7;
+                state ^= state << 17;
+
+                unsigned pick = (unsigned)(state >> 32) % 32;
+                if(utf8 && pick >= 26) {
+                        const char * c   = wide[pick % 3];
+                        size_t       len = strlen(c);
+                        if(at + len > bytes) break;
+                        memcpy(data + at, c, len);
+                        at += len;
+                }
+                else data[at++] = (char)('a' + pick % 26);
+        }
+
+        while(at < bytes) data[at++] = 'a';
+        data[bytes] = '\0';
+
+}
+
+/**
+ * @brief 
+ * Static j2string holding @c "text", or NULL if it couldn't be made.
+ */
+static j2string
+bench_string(
+        const char * text,
+        size_t bytes )
+{
+
+        j2string string = j2string_allocate((j2string_param){
+                .allocate = bytes + 1,
+                .padding  = 0,
+                .max      = bytes + 1
+        });
+        if(!string) return NULL;
+
+        j2string_noutf8_ccpy(&string, text);
+        if(J2_STRING_INFO(string)->filled != bytes) {
+                j2string_free(string);
+                return NULL;
+        }
+
+        return string;
+
+}
+
+/**
+ * @brief 
+ * Copy the first @c "bytes" of the master text into @c "out", without 
+ * cutting a UTF-8 character in half at the end.
+ */
+static void
+bench_prefix(
+        char * out,
+        const char * master,
+        size_t bytes )
+{
+
+        memcpy(out, master, bytes);
+
+        size_t end = bytes;
+        while(end > 0 && ((unsigned char)out[end - 1] & 0xC0) == 0x80) end--;
+        if(end > 0 && (unsigned char)out[end - 1] >= 0xC0) end--;
+        memset(out + end, 'a', bytes - end);
+        out[bytes] = '\0';
+
+}
+
+/**
+ * @brief 
+ * Sizes grow 8 times at a time, the last one is always @c "max". Returns 
+ * 0 after it.
+ */
+static size_t
+bench_next_size(
+        size_t bytes,
+        size_t max )
+{
+        if(bytes >= max) return 0;
+        return bytes * 8 > max ? max : bytes * 8;
+}
+
+struct bench_options {
+
+        size_t       max;
+        const char * filter;
+        uint64_t     target;
+        unsigned     repeat;
+        FILE *       out;
+
+};
+
+static bool
+bench_options(
+        int argc,
+        char ** argv,
+        struct bench_options * options )
+{
+
+        for(int i = 1; i < argc; i++) {
+                if(!strcmp(argv[i], "--quick")) {
+                        options->max    = 1024 * 1024;
+                        options->repeat = 2;
+                }
+                else if(!strcmp(argv[i], "--max") && i + 1 < argc) 
+                        options->max = strtoull(argv[++i], NULL, 10);
+                else if(!strcmp(argv[i], "--filter") && i + 1 < argc) 
+                        options->filter = argv[++i];
+                else if(!strcmp(argv[i], "--time") && i + 1 < argc) 
+                        options->target = strtoull(argv[++i], NULL, 10) 
+                                        * 1000000u;
+                else if(!strcmp(argv[i], "-o") && i + 1 < argc) {
+                        options->out = fopen(argv[++i], "w");
+                        if(!options->out) {
+                                perror(argv[i]);
+                                return false;
+                        }
+                }
+                else {
+                        fprintf(stderr, "usage: %s [--quick] [--max BYTES]"
+                                " [--filter NAME] [--time MS] [-o FILE]\n", 
+                                argv[0]);
+                        return false;
+                }
+        }
+
+        if(options->max > BENCH_MAX_SIZE) options->max = BENCH_MAX_SIZE;
+        if(options->max < BENCH_MIN_SIZE) options->max = BENCH_MIN_SIZE;
+        if(!options->target) options->target = 1000000u;
+
+        return true;
+
+}
+
+static void
+bench_print(
+        FILE * out,
+        bool * first,
+        const char * name,
+        const char * impl,
+        const char * function,
+        const char * mix,
+        const struct bench_input * in,
+        size_t align,
+        size_t iterations,
+        double ns )
+{
+
+        fprintf(out, "%s\n    {\"name\": \"%s\", \"impl\": \"%s\","
+                " \"function\": \"%s\", \"mix\": \"%s\", \"bytes\": %zu,"
+                " \"align\": %zu, \"iterations\": %zu, \"ns_per_op\": %.3f,"
+                " \"gb_per_s\": %.3f}",
+                (*first) ? "" : ",", name, impl, function, mix, in->bytes, 
+                align, iterations, ns, (double)in->bytes / ns);
+        fflush(out);
+        (*first) = false;
+
+}
+
+int 
+main(
+        int argc, 
+        char ** argv )
+{
+
+        struct bench_options options = {
+                .max    = BENCH_MAX_SIZE,
+                .filter = NULL,
+                .target = 5000000u,
+                .repeat = BENCH_REPEAT,
+                .out    = stdout
+        };
+        if(!bench_options(argc, argv, &options)) return 1;
+
+        bool utf8_locale = setlocale(LC_CTYPE, "C.UTF-8") 
+                        || setlocale(LC_CTYPE, "en_US.UTF-8");
+        if(!utf8_locale) 
+                fprintf(stderr, "bench: no UTF-8 locale, mbstowcs is"
+                                " skipped.\n");
+
+        size_t pad    = BENCH_ALIGNMENT * 2;
+        char * master = malloc(options.max + 1);
+        char * src    = aligned_alloc(BENCH_ALIGNMENT, options.max + pad);
+        char * dst    = aligned_alloc(BENCH_ALIGNMENT, options.max + pad);
+        if(!master || !src || !dst) {
+                fprintf(stderr, "bench: out of memory.\n");
+                return 1;
+        }
+        memset(dst, 0, options.max + pad);
+
+#ifdef __J2_DEV__
+        const char * build = "dev";
+        fprintf(stderr, "bench: library built with DEBUG=t, use"
+                        " \"make bench DEBUG=f\" for real numbers.\n");
+#else
+        const char * build = "release";
+#endif
+
+        fprintf(options.out, "{\n  \"suite\": \"j2string\",\n"
+                "  \"build\": \"%s\",\n  \"compiler\": \"%s\",\n"
+                "  \"results\": [", build, BENCH_COMPILER);
+
+        bool first = true;
+
+        for(size_t m = 0; m < 2; m++) {
+
+                bench_generate(master, options.max, m == 1);
+
+                for(size_t bytes = BENCH_MIN_SIZE; bytes; 
+                    bytes = bench_next_size(bytes, options.max)) {
+
+                        struct bench_input in = {
+                                .bytes   = bytes,
+                                .present = 'e',
+                                .absent  = '#'
+                        };
+
+                        bench_prefix(src, master, bytes);
+                        in.jsrc  = bench_string(src, bytes);
+                        in.jsrc2 = bench_string(src, bytes);
+                        in.jdst  = bench_string(src, bytes);
+                        in.reject = bench_string("#$%", 3);
+
+                        /// Every distinct byte of the text.
+                        char   seen[257] = {0};
+                        bool   have[256] = {0};
+                        size_t kinds     = 0;
+                        for(size_t i = 0; i < bytes; i++) {
+                                unsigned char c = (unsigned char)src[i];
+                                if(!have[c]) {
+                                        have[c] = true;
+                                        seen[kinds++] = (char)c;
+                                }
+                        }
+                        in.accept = bench_string(seen, kinds);
+
+                        if(!in.jsrc || !in.jsrc2 || !in.jdst 
+                        || !in.reject || !in.accept) {
+                                fprintf(stderr, "bench: out of memory.\n");
+                                return 1;
+                        }
+
+                        for(size_t c = 0; c < BENCH_CASES; c++) {
+
+                                const struct bench_case * bc = 
+                                        &bench_cases[c];
+                                if(options.filter 
+                                && !strstr(bc->name, options.filter))
+                                        continue;
+
+                                size_t aligns = bc->raw ? 
+                                                BENCH_ALIGNMENTS : 1;
+
+                                for(size_t a = 0; a < aligns; a++) {
+
+                                        size_t align;
+                                        if(bc->raw) {
+                                                align  = bench_alignments[a];
+                                                in.src = src + pad / 2 
+                                                       + align;
+                                                in.dst = dst + pad / 2 
+                                                       + align;
+                                                bench_prefix(in.src, master,
+                                                             bytes);
+                                        }
+                                        else {
+                                                align  = (uintptr_t)in.jsrc 
+                                                       % BENCH_ALIGNMENT;
+                                                in.src = in.jsrc;
+                                                in.dst = in.jdst;
+                                        }
+
+                                        fprintf(stderr, "bench: %-20s %-5s"
+                                                " %9zu B, align %zu\n", 
+                                                bc->name, bench_mixes[m], 
+                                                bytes, align);
+
+                                        size_t n;
+                                        double ns = bench_measure(bc->j2_op,
+                                                &in, options.target, 
+                                                options.repeat, &n);
+                                        bench_print(options.out, &first, 
+                                                bc->name, "j2", bc->j2_function, 
+                                                bench_mixes[m], &in, align,
+                                                n, ns);
+
+                                        if(bc->locale && !utf8_locale) 
+                                                continue;
+
+                                        ns = bench_measure(bc->libc_op, &in,
+                                                options.target, 
+                                                options.repeat, &n);
+                                        bench_print(options.out, &first, 
+                                                bc->name, "libc", bc->libc_function, 
+                                                bench_mixes[m], &in, align,
+                                                n, ns);
+
+                                }
+
+                        }
+
+                        j2string_free(in.jsrc);
+                        j2string_free(in.jsrc2);
+                        j2string_free(in.jdst);
+                        j2string_free(in.reject);
+                        j2string_free(in.accept);
+
+                }
+
+        }
+
+        fprintf(options.out, "\n  ]\n}\n");
+        if(options.out != stdout) fclose(options.out);
+
+        free(master);
+        free(src);
+        free(dst);
+
+        return 0;
+
+}
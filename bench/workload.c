@@ -0,0 +1,861 @@
+/*** LICENSE: LGPLV2. *************************************
+ *                                                        *
+ *                                                        *
+ * This file is a part of the j2 project.                 *
+ * Copyright (C) 2022 Joško Križanović                    *
+ * <jkriza02@fesb.com>                                    *
+ *                                                        *
+ * This library is free software; you can redistribute    *
+ * it and/or modify it under the terms of the GNU Lesser  *
+ * General Public License as published by the Free        *
+ * Software Foundation; either version 2.1 of the         *
+ * License, or (at your option) any later version.        *
+ *                                                        *
+ * This library is distributed in the hope that it will   *
+ * be useful,                                             *
+ * but WITHOUT ANY WARRANTY; without even the implied     *
+ * warranty of MERCHANTABILITY or FITNESS FOR A           *
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public  *
+ * License for more details.                              *
+ *                                                        *
+ * You should have received a copy of the GNU Lesser      *
+ * General Public License along with this library; if     *
+ * not, write to the Free Software Foundation, Inc.,      *
+ * 51 Franklin Street, Fifth Floor, Boston,               *
+ * MA  02110-1301  USA                                    *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: FILE, AUTHOR & DATE INFORMATION. *********
+ *                                                        *
+ *                                                        *
+ * FILE:                                                  *
+ * Workload benchmarks of j2 against plain char* and      *
+ * libc.                                                  *
+ *                                                        *
+ *                                                        *
+ * AUTHOR:                                                *
+ *      NAME:  Joško Križanović                           *
+ *      EMAIL: jkriza02@fesb.com                          *
+ *                                                        *
+ *                                                        *
+ * DATE:                                                  *
+ * 19.10.2026.                                            *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+
+/**
+ * @brief 
+ * Run with @c "make bench-workload", results are written as JSON to 
+ * @c bench/workload.json (or @c -o FILE), progress goes to stderr.
+ * 
+ *      --quick        a tenth of the default amount of work,
+ *      --scale X      X times the default amount of work,
+ *      --filter NAME  only workloads whose name contains NAME,
+ *      -o FILE        where to write the JSON to, default stdout.
+ * 
+ * Every workload runs once on top of j2 and once on plain char* and libc,
+ * each time in a child process of its own so its peak RSS isn't mixed up
+ * with the others. The peak includes the generated input, which is the 
+ * same for both. Allocations are counted by wrapping malloc, calloc, 
+ * realloc and aligned_alloc at link time (-Wl,--wrap, see the makefile);
+ * without it they are reported as null. Allocations libc makes for 
+ * itself are not seen. The checksum of both runs must be the same.
+ */
+
+/// clock_gettime(), fork() and hsearch().
+#define _XOPEN_SOURCE 700
+
+#include "../j2.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <locale.h>
+#include <search.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+
+static size_t workload_allocs;
+static size_t workload_alloc_bytes;
+
+#ifdef BENCH_WRAP
+void * __real_malloc(size_t size);
+void * __real_calloc(size_t count, size_t size);
+void * __real_realloc(void * ptr, size_t size);
+void * __real_aligned_alloc(size_t alignment, size_t size);
+void * __wrap_malloc(size_t size);
+void * __wrap_calloc(size_t count, size_t size);
+void * __wrap_realloc(void * ptr, size_t size);
+void * __wrap_aligned_alloc(size_t alignment, size_t size);
+
+void * __wrap_malloc(size_t size) {
+        workload_allocs++;
+        workload_alloc_bytes += size;
+        return __real_malloc(size);
+}
+void * __wrap_calloc(size_t count, size_t size) {
+        workload_allocs++;
+        workload_alloc_bytes += count * size;
+        return __real_calloc(count, size);
+}
+void * __wrap_realloc(void * ptr, size_t size) {
+        workload_allocs++;
+        workload_alloc_bytes += size;
+        return __real_realloc(ptr, size);
+}
+void * __wrap_aligned_alloc(size_t alignment, size_t size) {
+        workload_allocs++;
+        workload_alloc_bytes += size;
+        return __real_aligned_alloc(alignment, size);
+}
+#endif
+
+/**
+ * @brief 
+ * What a single run of a workload hands back to the parent process.
+ */
+struct workload_result {
+
+        bool     ok;
+        size_t   ops;
+        size_t   bytes;
+        uint64_t ns;
+        size_t   allocs;
+        size_t   alloc_bytes;
+        long     peak_rss_kib;
+        uint64_t checksum;
+
+};
+
+/**
+ * @brief 
+ * A workload generates its input with @c "setup" (not timed), then the 
+ * timed @c "run" of one of the implementations fills @c "ops", 
+ * @c "bytes" and @c "checksum" of the result.
+ */
+struct workload {
+
+        const char * name;
+        const char * op;
+        void * (*setup)(size_t ops);
+        void   (*run_j2)(void * input, struct workload_result * result);
+        void   (*run_libc)(void * input, struct workload_result * result);
+        size_t ops;
+
+};
+
+static uint64_t workload_state = 0x9e3779b97f4a7c15u;
+
+static uint32_t
+workload_random(
+        void )
+{
+        workload_state ^= workload_state << 13;
+        workload_state ^= workload_state >> 7;
+        workload_state ^= workload_state << 17;
+        return (uint32_t)(workload_state >> 32);
+}
+
+/**
+ * @brief 
+ * Write a random word of @c "min" to @c "max" bytes to @c "out", every 
+ * eighth character a 2 or 3 byte UTF-8 one if @c "utf8". Returns the 
+ * amount of bytes written, @c "out" is NUL terminated.
+ */
+static size_t
+workload_word(
+        char * out,
+        size_t min,
+        size_t max,
+        bool utf8 )
+{
+
+        size_t target = min + workload_random() % (max - min + 1);
+        size_t at     = 0;
+
+        while(at < target) {
+                uint32_t pick = workload_random();
+                if(utf8 && pick % 8 == 0 && at + 3 <= target) {
+                        const char * c = pick & 8 ? "\xc5\xa1" : "\xe2\x82\xac";
+                        size_t len = strlen(c);
+                        memcpy(out + at, c, len);
+                        at += len;
+                }
+                else out[at++] = (char)('a' + pick % 26);
+        }
+
+        out[at] = '\0';
+        return at;
+
+}
+
+static char *
+workload_strdup(
+        const char * text )
+{
+        size_t bytes = strlen(text) + 1;
+        char * copy  = malloc(bytes);
+        if(copy) memcpy(copy, text, bytes);
+        return copy;
+}
+
+static j2string
+workload_j2string(
+        const char * text )
+{
+        return j2string_init(text, (j2string_param){
+                .allocate = 0,
+                .padding  = 0,
+                .max      = 0
+        });
+}
+
+/*** LOG: ***************************************************************
+ * Assemble log lines out of a timestamp, level, module and message with
+ * repeated concatenation, append them to a 64 KiB buffer which is 
+ * "flushed" (checksummed and emptied) whenever it is full.
+ */
+
+#define WORKLOAD_LOG_BUFFER (64 * 1024)
+#define WORKLOAD_LOG_PARTS  256
+
+struct workload_log {
+
+        size_t ops;
+        char * stamps[WORKLOAD_LOG_PARTS];
+        char * modules[WORKLOAD_LOG_PARTS];
+        char * messages[WORKLOAD_LOG_PARTS];
+
+};
+
+static const char * const workload_levels[] = {
+        "TRACE", "DEBUG", "INFO", "WARN", "ERROR"
+};
+
+static void *
+workload_log_setup(
+        size_t ops )
+{
+
+        struct workload_log * in = calloc(1, sizeof(struct workload_log));
+        char text[256];
+
+        in->ops = ops;
+        for(size_t i = 0; i < WORKLOAD_LOG_PARTS; i++) {
+                snprintf(text, sizeof(text), "2026-10-19T12:%02zu:%02zu.%06u",
+                         i / 60 % 60, i % 60, workload_random() % 1000000);
+                in->stamps[i] = workload_strdup(text);
+                workload_word(text, 3, 12, false);
+                in->modules[i] = workload_strdup(text);
+                workload_word(text, 20, 120, true);
+                in->messages[i] = workload_strdup(text);
+        }
+
+        return in;
+
+}
+
+static void
+workload_log_j2(
+        void * input,
+        struct workload_result * result )
+{
+
+        struct workload_log * in = input;
+
+        j2string line = j2string_init("", (j2string_param){
+                .allocate = 128,
+                .padding  = 64,
+                .max      = 4096
+        });
+        j2string log  = j2string_init("", (j2string_param){
+                .allocate = WORKLOAD_LOG_BUFFER,
+                .padding  = WORKLOAD_LOG_BUFFER,
+                .max      = WORKLOAD_LOG_BUFFER
+        });
+
+        for(size_t i = 0; i < in->ops; i++) {
+
+                size_t p = i % WORKLOAD_LOG_PARTS;
+                j2string_clear(line);
+                j2string_ccat(&line, in->stamps[p]);
+                j2string_ccat(&line, " ");
+                j2string_ccat(&line, workload_levels[i % 5]);
+                j2string_ccat(&line, " ");
+                j2string_ccat(&line, in->modules[(p * 7) % WORKLOAD_LOG_PARTS]);
+                j2string_ccat(&line, ": ");
+                j2string_ccat(&line, in->messages[(p * 13) % 
+                                                  WORKLOAD_LOG_PARTS]);
+                j2string_ccat(&line, "\n");
+
+                size_t filled = J2_STRING_INFO(line)->filled;
+                if(J2_STRING_INFO(log)->filled + filled 
+                >= WORKLOAD_LOG_BUFFER) {
+                        result->checksum += J2_STRING_INFO(log)->filled;
+                        j2string_clear(log);
+                }
+                j2string_cat(&log, line);
+                result->bytes += filled;
+
+        }
+
+        result->checksum += J2_STRING_INFO(log)->filled;
+        result->ops       = in->ops;
+
+        j2string_free(line);
+        j2string_free(log);
+
+}
+
+static void
+workload_log_libc(
+        void * input,
+        struct workload_result * result )
+{
+
+        struct workload_log * in = input;
+
+        char   line[4096];
+        char * log    = malloc(WORKLOAD_LOG_BUFFER);
+        size_t filled = 0;
+
+        for(size_t i = 0; i < in->ops; i++) {
+
+                size_t p = i % WORKLOAD_LOG_PARTS;
+                line[0] = '\0';
+                strcat(line, in->stamps[p]);
+                strcat(line, " ");
+                strcat(line, workload_levels[i % 5]);
+                strcat(line, " ");
+                strcat(line, in->modules[(p * 7) % WORKLOAD_LOG_PARTS]);
+                strcat(line, ": ");
+                strcat(line, in->messages[(p * 13) % WORKLOAD_LOG_PARTS]);
+                strcat(line, "\n");
+
+                size_t bytes = strlen(line);
+                if(filled + bytes >= WORKLOAD_LOG_BUFFER) {
+                        result->checksum += filled;
+                        filled = 0;
+                }
+                memcpy(log + filled, line, bytes + 1);
+                filled        += bytes;
+                result->bytes += bytes;
+
+        }
+
+        result->checksum += filled;
+        result->ops       = in->ops;
+
+        free(log);
+
+}
+
+/*** CSV: ***************************************************************
+ * Split rows of 8 comma separated fields. cspn only scans from the start
+ * of a j2string, so on the j2 side what is left of the row after every 
+ * field is moved into a second string.
+ */
+
+#define WORKLOAD_CSV_FIELDS 8
+
+struct workload_csv {
+
+        size_t     ops;
+        j2string * rows;
+        char **    crows;
+
+};
+
+static void *
+workload_csv_setup(
+        size_t ops )
+{
+
+        struct workload_csv * in = calloc(1, sizeof(struct workload_csv));
+        char row[1024], word[128];
+
+        in->ops   = ops;
+        in->rows  = malloc(ops * sizeof(j2string));
+        in->crows = malloc(ops * sizeof(char *));
+
+        for(size_t i = 0; i < ops; i++) {
+                size_t at = 0;
+                for(size_t f = 0; f < WORKLOAD_CSV_FIELDS; f++) {
+                        if(f % 3 == 0) snprintf(word, sizeof(word), "%u", 
+                                                workload_random() % 100000);
+                        else workload_word(word, 1, 24, f == 4);
+                        at += (size_t)snprintf(row + at, sizeof(row) - at,
+                                               f ? ",%s" : "%s", word);
+                }
+                in->rows[i]  = workload_j2string(row);
+                in->crows[i] = workload_strdup(row);
+        }
+
+        return in;
+
+}
+
+static void
+workload_csv_j2(
+        void * input,
+        struct workload_result * result )
+{
+
+        struct workload_csv * in = input;
+        j2string_param param = {
+                .allocate = 1024,
+                .padding  = 0,
+                .max      = 1024
+        };
+        j2string rest  = j2string_init("", param);
+        j2string other = j2string_init("", param);
+        j2string comma = workload_j2string(",");
+
+        for(size_t i = 0; i < in->ops; i++) {
+
+                j2string_noutf8_cpy(&rest, in->rows[i]);
+                result->bytes += J2_STRING_INFO(in->rows[i])->filled;
+
+                for(;;) {
+                        long length = j2string_cspn(rest, comma);
+                        result->checksum += (uint64_t)length 
+                                          + (unsigned char)rest[0];
+                        if(rest[length] == '\0') break;
+
+                        j2string_noutf8_ccpy(&other, rest + length + 1);
+                        j2string swap = rest;
+                        rest  = other;
+                        other = swap;
+                }
+
+        }
+
+        result->ops = in->ops;
+
+        j2string_free(rest);
+        j2string_free(other);
+        j2string_free(comma);
+
+}
+
+static void
+workload_csv_libc(
+        void * input,
+        struct workload_result * result )
+{
+
+        struct workload_csv * in = input;
+
+        for(size_t i = 0; i < in->ops; i++) {
+
+                const char * rest = in->crows[i];
+                result->bytes += strlen(rest);
+
+                for(;;) {
+                        size_t length = strcspn(rest, ",");
+                        result->checksum += (uint64_t)length 
+                                          + (unsigned char)rest[0];
+                        if(rest[length] == '\0') break;
+                        rest += length + 1;
+                }
+
+        }
+
+        result->ops = in->ops;
+
+}
+
+/*** MAP: ***************************************************************
+ * Count the occurrences of every word of a token stream with a string 
+ * keyed hash map. Every token is a string of its own, as it would come 
+ * out of a tokenizer. libc has hsearch(), a single global table without
+ * removal, its keys are copied by hand.
+ */
+
+#define WORKLOAD_MAP_VOCABULARY 50000
+
+struct workload_map {
+
+        size_t     ops;
+        j2string * tokens;
+        char **    ctokens;
+
+};
+
+static void *
+workload_map_setup(
+        size_t ops )
+{
+
+        struct workload_map * in = calloc(1, sizeof(struct workload_map));
+        char ** words = malloc(WORKLOAD_MAP_VOCABULARY * sizeof(char *));
+        char    word[64];
+
+        for(size_t i = 0; i < WORKLOAD_MAP_VOCABULARY; i++) {
+                workload_word(word, 4, 16, false);
+                words[i] = workload_strdup(word);
+        }
+
+        in->ops     = ops;
+        in->tokens  = malloc(ops * sizeof(j2string));
+        in->ctokens = malloc(ops * sizeof(char *));
+
+        /// Skewed towards the front of the vocabulary like real text.
+        for(size_t i = 0; i < ops; i++) {
+                uint32_t r = workload_random() % WORKLOAD_MAP_VOCABULARY;
+                const char * pick = words[(uint64_t)r * r 
+                                          / WORKLOAD_MAP_VOCABULARY];
+                in->tokens[i]  = workload_j2string(pick);
+                in->ctokens[i] = workload_strdup(pick);
+        }
+
+        return in;
+
+}
+
+static void
+workload_map_j2(
+        void * input,
+        struct workload_result * result )
+{
+
+        struct workload_map * in = input;
+        j2hashtable * table = j2hashtable_new(J2_HASHTABLE_STRING, 0);
+
+        for(size_t i = 0; i < in->ops; i++) {
+                void ** count = j2hashtable_get(table, in->tokens[i]);
+                if(count) (*count) = (void *)((uintptr_t)(*count) + 1);
+                else j2hashtable_set(table, in->tokens[i], (void *)1);
+                result->bytes += J2_STRING_INFO(in->tokens[i])->filled;
+        }
+
+        size_t it = 0;
+        struct j2hashtable_slot * slot;
+        while((slot = j2hashtable_next(table, &it))) 
+                result->checksum += (uintptr_t)slot->value 
+                                  * (unsigned char)slot->key.string[0];
+        result->checksum += j2hashtable_count(table) << 32;
+        result->ops       = in->ops;
+
+        j2hashtable_free(table);
+
+}
+
+static void
+workload_map_libc(
+        void * input,
+        struct workload_result * result )
+{
+
+        struct workload_map * in = input;
+        char ** keys  = malloc(WORKLOAD_MAP_VOCABULARY * sizeof(char *));
+        size_t  count = 0;
+
+        hcreate(WORKLOAD_MAP_VOCABULARY * 2);
+
+        for(size_t i = 0; i < in->ops; i++) {
+                ENTRY   entry = {.key = in->ctokens[i], .data = NULL};
+                ENTRY * found = hsearch(entry, FIND);
+                if(found) found->data = (char *)found->data + 1;
+                else {
+                        entry.key   = workload_strdup(in->ctokens[i]);
+                        entry.data  = (void *)1;
+                        keys[count++] = entry.key;
+                        hsearch(entry, ENTER);
+                }
+                result->bytes += strlen(in->ctokens[i]);
+        }
+
+        for(size_t i = 0; i < count; i++) {
+                ENTRY * found = hsearch((ENTRY){.key = keys[i]}, FIND);
+                result->checksum += (uintptr_t)found->data 
+                                  * (unsigned char)keys[i][0];
+        }
+        result->checksum += (uint64_t)count << 32;
+        result->ops       = in->ops;
+
+        hdestroy();
+        for(size_t i = 0; i < count; i++) free(keys[i]);
+        free(keys);
+
+}
+
+/*** INGEST: ************************************************************
+ * Turn lines of mixed UTF-8 text into strings that know their length in 
+ * characters and keep all of them, as when loading a corpus. libc copies
+ * and counts with mbstowcs().
+ */
+
+struct workload_ingest {
+
+        size_t ops;
+        char * text;
+        char ** lines;
+
+};
+
+static void *
+workload_ingest_setup(
+        size_t ops )
+{
+
+        struct workload_ingest * in = calloc(1, sizeof(*in));
+
+        in->ops   = ops;
+        in->text  = malloc(ops * 201);
+        in->lines = malloc(ops * sizeof(char *));
+
+        char * at = in->text;
+        for(size_t i = 0; i < ops; i++) {
+                in->lines[i] = at;
+                at += workload_word(at, 20, 200, true) + 1;
+        }
+
+        return in;
+
+}
+
+static void
+workload_ingest_j2(
+        void * input,
+        struct workload_result * result )
+{
+
+        struct workload_ingest * in = input;
+        j2string * corpus = malloc(in->ops * sizeof(j2string));
+
+        for(size_t i = 0; i < in->ops; i++) {
+                corpus[i] = workload_j2string(in->lines[i]);
+                result->checksum += J2_STRING_INFO(corpus[i])->length;
+                result->bytes    += J2_STRING_INFO(corpus[i])->filled;
+        }
+
+        result->ops = in->ops;
+
+        for(size_t i = 0; i < in->ops; i++) j2string_free(corpus[i]);
+        free(corpus);
+
+}
+
+static void
+workload_ingest_libc(
+        void * input,
+        struct workload_result * result )
+{
+
+        struct workload_ingest * in = input;
+        char ** corpus = malloc(in->ops * sizeof(char *));
+
+        for(size_t i = 0; i < in->ops; i++) {
+                corpus[i] = workload_strdup(in->lines[i]);
+                result->checksum += mbstowcs(NULL, corpus[i], 0);
+                result->bytes    += strlen(corpus[i]);
+        }
+
+        result->ops = in->ops;
+
+        for(size_t i = 0; i < in->ops; i++) free(corpus[i]);
+        free(corpus);
+
+}
+
+static const struct workload workloads[] = {
+        {"log",    "line",  workload_log_setup,    workload_log_j2, 
+         workload_log_libc,    500000},
+        {"csv",    "row",   workload_csv_setup,    workload_csv_j2, 
+         workload_csv_libc,    200000},
+        {"map",    "token", workload_map_setup,    workload_map_j2, 
+         workload_map_libc,    500000},
+        {"ingest", "line",  workload_ingest_setup, workload_ingest_j2, 
+         workload_ingest_libc, 200000},
+};
+
+#define WORKLOADS (sizeof(workloads) / sizeof(workloads[0]))
+
+static uint64_t
+workload_now(
+        void )
+{
+        struct timespec now;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        return (uint64_t)now.tv_sec * 1000000000u + (uint64_t)now.tv_nsec;
+}
+
+/**
+ * @brief 
+ * Run the j2 (@c "library") or the libc side of @c "w" in a child 
+ * process and collect its result through a pipe.
+ */
+static bool
+workload_spawn(
+        const struct workload * w,
+        bool library,
+        size_t ops,
+        struct workload_result * result )
+{
+
+        int pipes[2];
+        if(pipe(pipes)) return false;
+
+        pid_t child = fork();
+        if(child < 0) return false;
+
+        if(child == 0) {
+
+                close(pipes[0]);
+
+                struct workload_result r = {0};
+                void * input = w->setup(ops);
+
+                workload_allocs      = 0;
+                workload_alloc_bytes = 0;
+
+                uint64_t start = workload_now();
+                (library ? w->run_j2 : w->run_libc)(input, &r);
+                r.ns = workload_now() - start;
+
+                r.allocs      = workload_allocs;
+                r.alloc_bytes = workload_alloc_bytes;
+
+                struct rusage usage;
+                getrusage(RUSAGE_SELF, &usage);
+                r.peak_rss_kib = usage.ru_maxrss;
+                r.ok           = true;
+
+                ssize_t wrote = write(pipes[1], &r, sizeof(r));
+                _exit(wrote == (ssize_t)sizeof(r) ? 0 : 1);
+
+        }
+
+        close(pipes[1]);
+        ssize_t got = read(pipes[0], result, sizeof(*result));
+        close(pipes[0]);
+
+        int status;
+        waitpid(child, &status, 0);
+
+        return got == (ssize_t)sizeof(*result) && result->ok;
+
+}
+
+int 
+main(
+        int argc, 
+        char ** argv )
+{
+
+        double       scale  = 1.0;
+        const char * filter = NULL;
+        FILE *       out    = stdout;
+
+        for(int i = 1; i < argc; i++) {
+                if(!strcmp(argv[i], "--quick")) scale = 0.1;
+                else if(!strcmp(argv[i], "--scale") && i + 1 < argc) 
+                        scale = strtod(argv[++i], NULL);
+                else if(!strcmp(argv[i], "--filter") && i + 1 < argc) 
+                        filter = argv[++i];
+                else if(!strcmp(argv[i], "-o") && i + 1 < argc) {
+                        out = fopen(argv[++i], "w");
+                        if(!out) {
+                                perror(argv[i]);
+                                return 1;
+                        }
+                }
+                else {
+                        fprintf(stderr, "usage: %s [--quick] [--scale X]"
+                                " [--filter NAME] [-o FILE]\n", argv[0]);
+                        return 1;
+                }
+        }
+
+        if(!setlocale(LC_CTYPE, "C.UTF-8") 
+        && !setlocale(LC_CTYPE, "en_US.UTF-8"))
+                fprintf(stderr, "workload: no UTF-8 locale, the libc"
+                                " ingest checksum will differ.\n");
+
+#ifdef __J2_DEV__
+        const char * build = "dev";
+#else
+        const char * build = "release";
+#endif
+#ifdef BENCH_WRAP
+        bool counted = true;
+#else
+        bool counted = false;
+#endif
+
+        fprintf(out, "{\n  \"suite\": \"workload\",\n  \"build\": \"%s\",\n"
+                "  \"results\": [", build);
+
+        bool first = true;
+
+        for(size_t i = 0; i < WORKLOADS; i++) {
+
+                const struct workload * w = &workloads[i];
+                if(filter && !strstr(w->name, filter)) continue;
+
+                size_t ops = (size_t)((double)w->ops * scale);
+                if(ops < 1) ops = 1;
+
+                uint64_t checksum[2] = {0};
+
+                for(int side = 0; side < 2; side++) {
+
+                        const char * impl = side ? "libc" : "j2";
+                        struct workload_result r;
+
+                        fprintf(stderr, "workload: %-6s %-4s %zu %ss\n", 
+                                w->name, impl, ops, w->op);
+                        if(!workload_spawn(w, !side, ops, &r)) {
+                                fprintf(stderr, "workload: %s %s failed.\n",
+                                        w->name, impl);
+                                continue;
+                        }
+                        checksum[side] = r.checksum;
+
+                        double seconds = (double)r.ns / 1e9;
+                        fprintf(out, "%s\n    {\"workload\": \"%s\","
+                                " \"impl\": \"%s\", \"op\": \"%s\","
+                                " \"ops\": %zu, \"bytes\": %zu,"
+                                " \"seconds\": %.6f, \"ops_per_s\": %.1f,"
+                                " \"mb_per_s\": %.3f, ",
+                                first ? "" : ",", w->name, impl, w->op,
+                                r.ops, r.bytes, seconds, 
+                                (double)r.ops / seconds, 
+                                (double)r.bytes / 1e6 / seconds);
+                        if(counted) 
+                                fprintf(out, "\"allocs_per_op\": %.4f,"
+                                        " \"alloc_bytes_per_op\": %.1f, ",
+                                        (double)r.allocs / r.ops,
+                                        (double)r.alloc_bytes / r.ops);
+                        else 
+                                fprintf(out, "\"allocs_per_op\": null,"
+                                        " \"alloc_bytes_per_op\": null, ");
+                        fprintf(out, "\"peak_rss_kib\": %ld,"
+                                " \"checksum\": %llu}", r.peak_rss_kib,
+                                (unsigned long long)r.checksum);
+                        fflush(out);
+                        first = false;
+
+                }
+
+                if(checksum[0] != checksum[1]) 
+                        fprintf(stderr, "workload: %s checksums differ,"
+                                " j2 %llu and libc %llu.\n", w->name,
+                                (unsigned long long)checksum[0],
+                                (unsigned long long)checksum[1]);
+
+        }
+
+        fprintf(out, "\n  ]\n}\n");
+        if(out != stdout) fclose(out);
+
+        return 0;
+
+}
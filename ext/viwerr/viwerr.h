@@ -0,0 +1,10 @@
+/* local compile-check stub, not part of the repo */
+#ifndef VIWERR_STUB_H
+#define VIWERR_STUB_H
+#include <errno.h>
+typedef struct viwerr_package { int code; char * group; char * name; char * message; } viwerr_package;
+#define VIWERR_PUSH 1
+#define VIWERR_OCCURED 2
+#define VIWERR_PRINT 3
+static inline viwerr_package * viwerr(int op, viwerr_package * p) { (void)op; (void)p; return 0; }
+#endif
@@ -160,14 +160,20 @@
  *********************************************************/
 
 #include "lib/string/string.h"
+#include "lib/rope/rope.h"
+#include "lib/hashtable/hashtable.h"
+#include "lib/chashtable/chashtable.h"
+#include "lib/queue/queue.h"
+#include "lib/cqueue/cqueue.h"
+#include "lib/list/list.h"
+#include "lib/plett/plett.h"
+#include "lib/art/art.h"
+#include "lib/stats/stats.h"
+#include "lib/diag/diag.h"
 #include <stdlib.h>
 #include <assert.h>
 #include <assert.h>
 
-#ifdef __J2_DEV__
-#include "ext/viwerr/viwerr.h"
-#endif
-
 
 #ifndef J2_INCLUDE
 #define J2_INCLUDE     
@@ -187,6 +193,16 @@ struct j2_interface{
                       j2string (*dy)( 
                                 const char * cstr);  
                 } create;
+                j2string (*reserve)(
+                        j2string string,
+                        long size
+                );
+                j2string (*shrink_to_fit)(
+                        j2string string
+                );
+                void (*clear)(
+                        j2string string
+                );
                 // long (*rchrs)(
                 //         const_j2string string,
                 //         unsigned char c,
@@ -217,10 +233,23 @@ struct j2_interface{
                         restrict_j2string* destination,
                         const_restrict_j2string source
                 );
+                long (*catn)(
+                        restrict_j2string* destination,
+                        const j2string * source,
+                        size_t count
+                );
+                long (*ccatn)(
+                        restrict_j2string* destination,
+                        const char * const * source,
+                        size_t count
+                );
                 long (*cmp)(
                         const_restrict_j2string str1, 
                         const_restrict_j2string str2
                 );
+                uint64_t (*hash)(
+                        const_j2string string
+                );
                 struct {
                         
                         long (*ccpy)(
@@ -243,6 +272,168 @@ struct j2_interface{
 
                 } noutf8;
 
+                struct {
+
+                        long (*integer)(
+                                restrict_j2string* destination,
+                                int value
+                        );
+                        long (*i8)(
+                                restrict_j2string* destination,
+                                int8_t value
+                        );
+                        long (*i16)(
+                                restrict_j2string* destination,
+                                int16_t value
+                        );
+                        long (*i32)(
+                                restrict_j2string* destination,
+                                int32_t value
+                        );
+                        long (*i64)(
+                                restrict_j2string* destination,
+                                int64_t value
+                        );
+                        long (*u8)(
+                                restrict_j2string* destination,
+                                uint8_t value
+                        );
+                        long (*u16)(
+                                restrict_j2string* destination,
+                                uint16_t value
+                        );
+                        long (*u32)(
+                                restrict_j2string* destination,
+                                uint32_t value
+                        );
+                        long (*u64)(
+                                restrict_j2string* destination,
+                                uint64_t value
+                        );
+                        long (*hex)(
+                                restrict_j2string* destination,
+                                uint64_t value
+                        );
+                        long (*f32)(
+                                restrict_j2string* destination,
+                                float value
+                        );
+                        long (*f64)(
+                                restrict_j2string* destination,
+                                double value
+                        );
+
+                } write;
+
+                struct {
+
+                        int64_t (*i64)(
+                                const_j2string string,
+                                size_t offset,
+                                size_t * bytelen
+                        );
+                        uint64_t (*u64)(
+                                const_j2string string,
+                                size_t offset,
+                                size_t * bytelen
+                        );
+                        double (*f64)(
+                                const_j2string string,
+                                size_t offset,
+                                size_t * bytelen
+                        );
+
+                } read;
+
+                struct {
+                        j2string_intern_pool * (*create)(
+                                bool refcount
+                        );
+                        void (*free)(
+                                j2string_intern_pool * pool
+                        );
+                        const_j2string (*get)(
+                                j2string_intern_pool * pool,
+                                const_j2string string
+                        );
+                        const_j2string (*cget)(
+                                j2string_intern_pool * pool,
+                                const char * cstr
+                        );
+                        void (*release)(
+                                j2string_intern_pool * pool,
+                                const_j2string string
+                        );
+                        size_t (*count)(
+                                j2string_intern_pool * pool
+                        );
+                } intern;
+
+                struct {
+                        long (*read_fd)(
+                                restrict_j2string * string,
+                                int fd
+                        );
+                        j2string (*read_file)(
+                                const char * path,
+                                j2string_param parameters
+                        );
+                        long (*getline)(
+                                restrict_j2string * line,
+                                FILE * stream
+                        );
+                        long (*writev)(
+                                int fd,
+                                const const_j2string * strings,
+                                size_t count
+                        );
+                } io;
+
+                struct {
+                        const_j2string (*file)(
+                                const char * path,
+                                int flags
+                        );
+                        const_j2string (*fd)(
+                                int fd,
+                                int flags
+                        );
+                        int (*advise)(
+                                const_j2string string,
+                                int flags
+                        );
+                        void (*unmap)(
+                                const_j2string string
+                        );
+                } map;
+
+                struct {
+                        j2string (*create)(
+                                size_t highwater,
+                                j2string_sink_fn write,
+                                void * data
+                        );
+                        j2string (*fd)(
+                                size_t highwater,
+                                int fd
+                        );
+                        long (*flush)(
+                                j2string string
+                        );
+                        long (*close)(
+                                j2string string
+                        );
+                } sink;
+
+                struct {
+                        int (*pin)(
+                                const char * spec
+                        );
+                        const char * (*name)(
+                                enum j2string_primitive primitive
+                        );
+                } kernel;
+
                 // long (*cspn)(
                 //         const_restrict_j2string string,
                 //         const_restrict_j2string reject
@@ -259,62 +450,724 @@ struct j2_interface{
                 //         size_t max
                 // );
         } string;
+
+        struct {
+                j2rope * (*create)(
+                        const char * cstr
+                );
+                j2rope * (*from)(
+                        const_j2string string
+                );
+                void (*free)(
+                        j2rope * rope
+                );
+                size_t (*bytes)(
+                        const j2rope * rope
+                );
+                size_t (*length)(
+                        const j2rope * rope
+                );
+                long (*insert)(
+                        j2rope * rope,
+                        size_t position,
+                        const_j2string string
+                );
+                long (*cinsert)(
+                        j2rope * rope,
+                        size_t position,
+                        const char * cstr
+                );
+                long (*erase)(
+                        j2rope * rope,
+                        size_t position,
+                        size_t count
+                );
+                j2string (*slice)(
+                        const j2rope * rope,
+                        size_t position,
+                        size_t count
+                );
+                j2string (*flatten)(
+                        const j2rope * rope
+                );
+                long (*write)(
+                        const j2rope * rope,
+                        int fd
+                );
+                j2rope * (*split)(
+                        j2rope * rope,
+                        size_t position
+                );
+                void (*concat)(
+                        j2rope * dst,
+                        j2rope * src
+                );
+        } rope;
+
+        struct {
+                j2hashtable * (*create)(
+                        enum j2hashtable_key type,
+                        size_t reserve
+                );
+                void (*free)(
+                        j2hashtable * table
+                );
+                int (*reserve)(
+                        j2hashtable * table,
+                        size_t count
+                );
+                void (*clear)(
+                        j2hashtable * table
+                );
+                size_t (*count)(
+                        const j2hashtable * table
+                );
+                struct j2hashtable_slot * (*next)(
+                        const j2hashtable * table,
+                        size_t * iterator
+                );
+                void ** (*get)(
+                        const j2hashtable * table,
+                        const_j2string key
+                );
+                void ** (*cget)(
+                        const j2hashtable * table,
+                        const char * key
+                );
+                int (*set)(
+                        j2hashtable * table,
+                        const_j2string key,
+                        void * value
+                );
+                int (*cset)(
+                        j2hashtable * table,
+                        const char * key,
+                        void * value
+                );
+                bool (*remove)(
+                        j2hashtable * table,
+                        const_j2string key,
+                        void ** value
+                );
+                bool (*cremove)(
+                        j2hashtable * table,
+                        const char * key,
+                        void ** value
+                );
+                struct {
+                        void ** (*get)(
+                                const j2hashtable * table,
+                                uint64_t key
+                        );
+                        int (*set)(
+                                j2hashtable * table,
+                                uint64_t key,
+                                void * value
+                        );
+                        bool (*remove)(
+                                j2hashtable * table,
+                                uint64_t key,
+                                void ** value
+                        );
+                } integer;
+        } hashtable;
+
+        struct {
+                j2chashtable * (*create)(
+                        enum j2chashtable_key type,
+                        size_t reserve
+                );
+                void (*free)(
+                        j2chashtable * table
+                );
+                size_t (*count)(
+                        const j2chashtable * table
+                );
+                void (*synchronize)(
+                        j2chashtable * table
+                );
+                bool (*get)(
+                        j2chashtable * table,
+                        const_j2string key,
+                        void ** value
+                );
+                bool (*cget)(
+                        j2chashtable * table,
+                        const char * key,
+                        void ** value
+                );
+                int (*set)(
+                        j2chashtable * table,
+                        const_j2string key,
+                        void * value
+                );
+                int (*cset)(
+                        j2chashtable * table,
+                        const char * key,
+                        void * value
+                );
+                bool (*remove)(
+                        j2chashtable * table,
+                        const_j2string key,
+                        void ** value
+                );
+                bool (*cremove)(
+                        j2chashtable * table,
+                        const char * key,
+                        void ** value
+                );
+                struct {
+                        bool (*get)(
+                                j2chashtable * table,
+                                uint64_t key,
+                                void ** value
+                        );
+                        int (*set)(
+                                j2chashtable * table,
+                                uint64_t key,
+                                void * value
+                        );
+                        bool (*remove)(
+                                j2chashtable * table,
+                                uint64_t key,
+                                void ** value
+                        );
+                } integer;
+        } chashtable;
+
+        struct {
+                j2queue * (*create)(
+                        size_t size,
+                        size_t reserve
+                );
+                void (*free)(
+                        j2queue * queue
+                );
+                int (*reserve)(
+                        j2queue * queue,
+                        size_t count
+                );
+                void (*clear)(
+                        j2queue * queue
+                );
+                size_t (*count)(
+                        const j2queue * queue
+                );
+                int (*push)(
+                        j2queue * queue,
+                        const void * element
+                );
+                bool (*pop)(
+                        j2queue * queue,
+                        void * element
+                );
+                void * (*front)(
+                        const j2queue * queue
+                );
+                int (*push_n)(
+                        j2queue * queue,
+                        const void * elements,
+                        size_t count
+                );
+                size_t (*pop_n)(
+                        j2queue * queue,
+                        void * elements,
+                        size_t count
+                );
+        } queue;
+
+        struct {
+                struct {
+                        j2cqueue_spsc * (*create)(
+                                size_t size,
+                                size_t capacity
+                        );
+                        void (*free)(
+                                j2cqueue_spsc * queue
+                        );
+                        bool (*push)(
+                                j2cqueue_spsc * queue,
+                                const void * element
+                        );
+                        bool (*pop)(
+                                j2cqueue_spsc * queue,
+                                void * element
+                        );
+                        size_t (*push_n)(
+                                j2cqueue_spsc * queue,
+                                const void * elements,
+                                size_t count
+                        );
+                        size_t (*pop_n)(
+                                j2cqueue_spsc * queue,
+                                void * elements,
+                                size_t count
+                        );
+                        size_t (*count)(
+                                j2cqueue_spsc * queue
+                        );
+                } spsc;
+                struct {
+                        j2cqueue_mpmc * (*create)(
+                                size_t size,
+                                size_t capacity
+                        );
+                        void (*free)(
+                                j2cqueue_mpmc * queue
+                        );
+                        bool (*push)(
+                                j2cqueue_mpmc * queue,
+                                const void * element
+                        );
+                        bool (*pop)(
+                                j2cqueue_mpmc * queue,
+                                void * element
+                        );
+                        size_t (*count)(
+                                j2cqueue_mpmc * queue
+                        );
+                } mpmc;
+        } cqueue;
+
+        struct {
+                struct {
+                        j2list_pool * (*create)(
+                                size_t size
+                        );
+                        void (*free)(
+                                j2list_pool * pool
+                        );
+                        void * (*get)(
+                                j2list_pool * pool
+                        );
+                        void (*put)(
+                                j2list_pool * pool,
+                                void * node
+                        );
+                } pool;
+                struct j2slist_node * (*snode)(
+                        j2list_pool * pool,
+                        void * value
+                );
+                struct j2dlist_node * (*dnode)(
+                        j2list_pool * pool,
+                        void * value
+                );
+        } list;
+
+        struct {
+                j2plett * (*create)(
+                        size_t size
+                );
+                void (*free)(
+                        j2plett * list
+                );
+                void (*clear)(
+                        j2plett * list
+                );
+                size_t (*count)(
+                        const j2plett * list
+                );
+                int (*append)(
+                        j2plett * list,
+                        const void * element
+                );
+                int (*insert)(
+                        j2plett * list,
+                        size_t index,
+                        const void * element
+                );
+                bool (*erase)(
+                        j2plett * list,
+                        size_t index,
+                        void * element
+                );
+                void * (*at)(
+                        const j2plett * list,
+                        size_t index
+                );
+                void * (*next)(
+                        const j2plett * list,
+                        struct j2plett_cursor * cursor
+                );
+        } plett;
+
+        struct {
+                j2art * (*create)(
+                        void
+                );
+                void (*free)(
+                        j2art * tree
+                );
+                size_t (*count)(
+                        const j2art * tree
+                );
+                void ** (*get)(
+                        const j2art * tree,
+                        const_j2string key
+                );
+                void ** (*cget)(
+                        const j2art * tree,
+                        const char * key
+                );
+                int (*set)(
+                        j2art * tree,
+                        const_j2string key,
+                        void * value
+                );
+                int (*cset)(
+                        j2art * tree,
+                        const char * key,
+                        void * value
+                );
+                bool (*remove)(
+                        j2art * tree,
+                        const_j2string key,
+                        void ** value
+                );
+                bool (*cremove)(
+                        j2art * tree,
+                        const char * key,
+                        void ** value
+                );
+                void ** (*longest_prefix)(
+                        const j2art * tree,
+                        const char * key,
+                        size_t * bytes
+                );
+                int (*walk)(
+                        const j2art * tree,
+                        j2art_callback callback,
+                        void * data
+                );
+                int (*walk_prefix)(
+                        const j2art * tree,
+                        const char * prefix,
+                        j2art_callback callback,
+                        void * data
+                );
+                int (*walk_range)(
+                        const j2art * tree,
+                        const char * low,
+                        const char * high,
+                        j2art_callback callback,
+                        void * data
+                );
+        } art;
+
+        struct {
+                bool (*enabled)(
+                        void
+                );
+                void (*snapshot)(
+                        j2stats * stats
+                );
+                void (*reset)(
+                        void
+                );
+                const char * (*name)(
+                        enum j2stats_counter counter
+                );
+                int (*dump)(
+                        FILE * stream
+                );
+        } stats;
+
+        struct {
+                void (*set_hook)(
+                        j2diag_hook hook,
+                        void * data
+                );
+                const char * (*message)(
+                        enum j2diag_code code
+                );
+                int (*errno_of)(
+                        enum j2diag_code code
+                );
+        } diag;
 };
 
+/**
+ * @brief 
+ * Every function of the enviorment, resolved at compile time. The table is
+ * a constant the compiler can see into, so a call through @c "j2" is 
+ * folded into a direct call of the function and inlined like one when the
+ * function is visible to it (make LTO=t).
+ */
 #ifdef __GNUC__
-__attribute__((constructor))
+__attribute__((unused))
 #endif
-struct j2_interface *
-_j2()
-{
-        static struct j2_interface * interface = NULL;
-        if(interface == NULL) {
-                interface = malloc(sizeof(struct j2_interface));
-                
-                /// @a String_setup:
-                interface->string.init   = &j2string_init;
-                interface->string.create.st = &j2string_new_st;
-                interface->string.create.dy = &j2string_new_dy;
+static const struct j2_interface _j2_interface = {
+        /// @a String_setup:
+        .string = {
+                .init = &j2string_init,
+                .create = {
+                        .st = &j2string_new_st,
+                        .dy = &j2string_new_dy,
+                },
 
-                interface->string.ccpy   = &j2string_ccpy;
-                interface->string.cpy    = &j2string_cpy;
+                .reserve       = &j2string_reserve,
+                .shrink_to_fit = &j2string_shrink_to_fit,
+                .clear         = &j2string_clear,
 
-                interface->string.cat    = &j2string_cat;
-                interface->string.ccat   = &j2string_ccat;
+                .ccpy = &j2string_ccpy,
+                .cpy  = &j2string_cpy,
 
-                // interface->string.chrs   = &j2string_chrs;
-                // interface->string.rchrs  = &j2string_rchrs;
+                .cat   = &j2string_cat,
+                .ccat  = &j2string_ccat,
+                .catn  = &j2string_catn,
+                .ccatn = &j2string_ccatn,
 
-                // interface->string.cnt    = &j2string_cnt;
-                interface->string.cmp    = &j2string_cmp;
+                // .chrs  = &j2string_chrs,
+                // .rchrs = &j2string_rchrs,
 
-                // interface->string.cspn   = &j2string_cspn;
-                // interface->string.spn    = &j2string_spn;
-                
-                // interface->string.len    = &j2string_len;
-                // interface->string.clen   = &j2string_strlen_sn;
+                // .cnt  = &j2string_cnt,
+                .cmp  = &j2string_cmp,
+                .hash = &j2string_hash,
 
+                // .cspn = &j2string_cspn,
+                // .spn  = &j2string_spn,
+
+                // .len  = &j2string_len,
+                // .clen = &j2string_strlen_sn,
 
                 /// @a Noutf8_setup:
-                interface->string.noutf8.ccpy   = &j2string_noutf8_ccpy;
-                interface->string.noutf8.cpy    = &j2string_noutf8_cpy;
-                interface->string.noutf8.cat    = &j2string_noutf8_cat;
-                interface->string.noutf8.ccat   = &j2string_noutf8_ccat;
-
-        }
-        assert(interface != NULL);
-        return interface;
-}
+                .noutf8 = {
+                        .ccpy = &j2string_noutf8_ccpy,
+                        .cpy  = &j2string_noutf8_cpy,
+                        .cat  = &j2string_noutf8_cat,
+                        .ccat = &j2string_noutf8_ccat,
+                },
 
-#ifdef __GNUC__
-__attribute__((destructor))
-#endif
-void
-_j2_free(){
-        free(_j2());
+                /// @a Write_setup:
+                .write = {
+                        .integer = &j2string_write_int,
+                        .i8      = &j2string_write_i8,
+                        .i16     = &j2string_write_i16,
+                        .i32     = &j2string_write_i32,
+                        .i64     = &j2string_write_i64,
+                        .u8      = &j2string_write_u8,
+                        .u16     = &j2string_write_u16,
+                        .u32     = &j2string_write_u32,
+                        .u64     = &j2string_write_u64,
+                        .hex     = &j2string_write_hex,
+                        .f32     = &j2string_write_float,
+                        .f64     = &j2string_write_double,
+                },
+
+                /// @a Read_setup:
+                .read = {
+                        .i64 = &j2string_read_i64,
+                        .u64 = &j2string_read_u64,
+                        .f64 = &j2string_read_double,
+                },
+
+                /// @a Intern_setup:
+                .intern = {
+                        .create  = &j2string_intern_new,
+                        .free    = &j2string_intern_free,
+                        .get     = &j2string_intern,
+                        .cget    = &j2string_cintern,
+                        .release = &j2string_intern_release,
+                        .count   = &j2string_intern_count,
+                },
+
+                /// @a Io_setup:
+                .io = {
+                        .read_fd   = &j2string_read_fd,
+                        .read_file = &j2string_read_file,
+                        .getline   = &j2string_getline,
+                        .writev    = &j2string_writev,
+                },
+
+                /// @a Map_setup:
+                .map = {
+                        .file   = &j2string_map,
+                        .fd     = &j2string_map_fd,
+                        .advise = &j2string_map_advise,
+                        .unmap  = &j2string_unmap,
+                },
+
+                /// @a Sink_setup:
+                .sink = {
+                        .create = &j2string_sink,
+                        .fd     = &j2string_sink_fd,
+                        .flush  = &j2string_sink_flush,
+                        .close  = &j2string_sink_close,
+                },
+
+                /// @a Kernel_setup:
+                .kernel = {
+                        .pin  = &j2string_kernel_pin,
+                        .name = &j2string_kernel_name,
+                },
+        },
+
+        /// @a Rope_setup:
+        .rope = {
+                .create  = &j2rope_new,
+                .from    = &j2rope_from,
+                .free    = &j2rope_free,
+                .bytes   = &j2rope_bytes,
+                .length  = &j2rope_length,
+                .insert  = &j2rope_insert,
+                .cinsert = &j2rope_cinsert,
+                .erase   = &j2rope_erase,
+                .slice   = &j2rope_slice,
+                .flatten = &j2rope_flatten,
+                .write   = &j2rope_write,
+                .split   = &j2rope_split,
+                .concat  = &j2rope_concat,
+        },
+
+        /// @a Hashtable_setup:
+        .hashtable = {
+                .create  = &j2hashtable_new,
+                .free    = &j2hashtable_free,
+                .reserve = &j2hashtable_reserve,
+                .clear   = &j2hashtable_clear,
+                .count   = &j2hashtable_count,
+                .next    = &j2hashtable_next,
+                .get     = &j2hashtable_get,
+                .cget    = &j2hashtable_cget,
+                .set     = &j2hashtable_set,
+                .cset    = &j2hashtable_cset,
+                .remove  = &j2hashtable_remove,
+                .cremove = &j2hashtable_cremove,
+                .integer = {
+                        .get    = &j2hashtable_int_get,
+                        .set    = &j2hashtable_int_set,
+                        .remove = &j2hashtable_int_remove,
+                },
+        },
+
+        /// @a Chashtable_setup:
+        .chashtable = {
+                .create      = &j2chashtable_new,
+                .free        = &j2chashtable_free,
+                .count       = &j2chashtable_count,
+                .synchronize = &j2chashtable_synchronize,
+                .get         = &j2chashtable_get,
+                .cget        = &j2chashtable_cget,
+                .set         = &j2chashtable_set,
+                .cset        = &j2chashtable_cset,
+                .remove      = &j2chashtable_remove,
+                .cremove     = &j2chashtable_cremove,
+                .integer = {
+                        .get    = &j2chashtable_int_get,
+                        .set    = &j2chashtable_int_set,
+                        .remove = &j2chashtable_int_remove,
+                },
+        },
+
+        /// @a Queue_setup:
+        .queue = {
+                .create  = &j2queue_new,
+                .free    = &j2queue_free,
+                .reserve = &j2queue_reserve,
+                .clear   = &j2queue_clear,
+                .count   = &j2queue_count,
+                .push    = &j2queue_push,
+                .pop     = &j2queue_pop,
+                .front   = &j2queue_front,
+                .push_n  = &j2queue_push_n,
+                .pop_n   = &j2queue_pop_n,
+        },
+
+        /// @a Cqueue_setup:
+        .cqueue = {
+                .spsc = {
+                        .create = &j2cqueue_spsc_new,
+                        .free   = &j2cqueue_spsc_free,
+                        .push   = &j2cqueue_spsc_push,
+                        .pop    = &j2cqueue_spsc_pop,
+                        .push_n = &j2cqueue_spsc_push_n,
+                        .pop_n  = &j2cqueue_spsc_pop_n,
+                        .count  = &j2cqueue_spsc_count,
+                },
+                .mpmc = {
+                        .create = &j2cqueue_mpmc_new,
+                        .free   = &j2cqueue_mpmc_free,
+                        .push   = &j2cqueue_mpmc_push,
+                        .pop    = &j2cqueue_mpmc_pop,
+                        .count  = &j2cqueue_mpmc_count,
+                },
+        },
+
+        /// @a List_setup:
+        .list = {
+                .pool = {
+                        .create = &j2list_pool_new,
+                        .free   = &j2list_pool_free,
+                        .get    = &j2list_pool_get,
+                        .put    = &j2list_pool_put,
+                },
+                .snode = &j2slist_node_new,
+                .dnode = &j2dlist_node_new,
+        },
+
+        /// @a Plett_setup:
+        .plett = {
+                .create = &j2plett_new,
+                .free   = &j2plett_free,
+                .clear  = &j2plett_clear,
+                .count  = &j2plett_count,
+                .append = &j2plett_append,
+                .insert = &j2plett_insert,
+                .erase  = &j2plett_erase,
+                .at     = &j2plett_at,
+                .next   = &j2plett_next,
+        },
+
+        /// @a Art_setup:
+        .art = {
+                .create         = &j2art_new,
+                .free           = &j2art_free,
+                .count          = &j2art_count,
+                .get            = &j2art_get,
+                .cget           = &j2art_cget,
+                .set            = &j2art_set,
+                .cset           = &j2art_cset,
+                .remove         = &j2art_remove,
+                .cremove        = &j2art_cremove,
+                .longest_prefix = &j2art_longest_prefix,
+                .walk           = &j2art_walk,
+                .walk_prefix    = &j2art_walk_prefix,
+                .walk_range     = &j2art_walk_range,
+        },
+
+        /// @a Stats_setup:
+        .stats = {
+                .enabled  = &j2stats_enabled,
+                .snapshot = &j2stats_snapshot,
+                .reset    = &j2stats_reset,
+                .name     = &j2stats_name,
+                .dump     = &j2stats_dump,
+        },
+
+        /// @a Diag_setup:
+        .diag = {
+                .set_hook = &j2diag_set_hook,
+                .message  = &j2diag_message,
+                .errno_of = &j2diag_errno,
+        },
+};
+
+/**
+ * @fn @c _j2(0)
+ * 
+ *      @brief Address of the interface, for code that wants to pass it 
+ *      around.
+ * 
+ */
+static inline const struct j2_interface *
+_j2(
+        void )
+{
+        return &_j2_interface;
 }
 
-#define j2 (*_j2())
+#define j2 (_j2_interface)
 
 
 #endif /** @c J2_INCLUDE */
@@ -0,0 +1,410 @@
+/*** LICENSE: LGPLV2. *************************************
+ *                                                        *
+ *                                                        *
+ * This file is a part of the j2 project.                 *
+ * Copyright (C) 2022 Joško Križanović                    *
+ * <jkriza02@fesb.com>                                    *
+ *                                                        *
+ * This library is free software; you can redistribute    *
+ * it and/or modify it under the terms of the GNU Lesser  *
+ * General Public License as published by the Free        *
+ * Software Foundation; either version 2.1 of the         *
+ * License, or (at your option) any later version.        *
+ *                                                        *
+ * This library is distributed in the hope that it will   *
+ * be useful,                                             *
+ * but WITHOUT ANY WARRANTY; without even the implied     *
+ * warranty of MERCHANTABILITY or FITNESS FOR A           *
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public  *
+ * License for more details.                              *
+ *                                                        *
+ * You should have received a copy of the GNU Lesser      *
+ * General Public License along with this library; if     *
+ * not, write to the Free Software Foundation, Inc.,      *
+ * 51 Franklin Street, Fifth Floor, Boston,               *
+ * MA  02110-1301  USA                                    *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: FILE, AUTHOR & DATE INFORMATION. *********
+ *                                                        *
+ *                                                        *
+ * FILE:                                                  *
+ * Adaptive radix tree, an ordered map from byte string   *
+ * keys to values with prefix, range and longest prefix   *
+ * queries.                                               *
+ *                                                        *
+ *                                                        *
+ * AUTHOR:                                                *
+ *      NAME:  Joško Križanović                           *
+ *      EMAIL: jkriza02@fesb.com                          *
+ *                                                        *
+ *                                                        *
+ * DATE:                                                  *
+ * 19.10.2026.                                            *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: COMPATIBILITY. ***************************
+ *                                                        *
+ *                                                        *
+ * C:                                                     *
+ * This library is written in compliance to the limited   *
+ * functionality at the disposal of the C99 standard.     *
+ *                                                        *
+ *                                                        *
+ * POSIX:                                                 *
+ * This libraries creator has yet to inscribe the minimum *
+ * POSIX compatibilty version that this library requires. *
+ * In its absance the user of the library is free to use  *
+ * any compatibilty version of the POSIX standard that is *
+ * deemed to work through trial and error.                *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: USED NAMESPACE ***************************
+ *                                                        *
+ *                                                        *
+ * Used namespaces, ... indicates that all characters     *
+ * that come after do not belong to that namespace:       *
+ * -> j2art...                                            *
+ * -> J2_ART...                                           *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: EXTERNAL FILES CALLED & PURPOSE **********
+ *                                                        *
+ *                                                        *
+ * Name                     Description                   *
+ * ----                     -----------                   *
+ * <stdint.h>               fixed size integers           *
+ *                                                        *
+ * <stdbool.h>              booleans                      *
+ *                                                        *
+ * "../string/string.h"     j2string keys                 *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: DEVELOPMENT HISTORY/VERSIONS PUBLISHED ***
+ *                                                        *
+ *                                                        *
+ * Author  Release & Date  Description of modifications   *
+ * ------  --------------  ----------------------------   *
+ * josko3  V0.0            Inital creation.               *
+ * 567     19.10.2026.                                    *
+ * ------  --------------  ----------------------------   *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "../diag/diag.h"
+
+#include "../string/string.h"
+
+#ifndef J2_ART_INCLUDE
+#define J2_ART_INCLUDE
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 
+ * Bytes of a compressed path kept inside of a node. Longer paths are still
+ * skipped in one step, their remaining bytes are checked against a leaf.
+ */
+#define J2_ART_PREFIX 12
+
+/**
+ * @enum @c j2art_type
+ * 
+ *      @brief Inner node types, named after the amount of children they 
+ *      fit.
+ * 
+ */
+enum j2art_type {
+
+        J2_ART_NODE4 = 1,
+        J2_ART_NODE16,
+        J2_ART_NODE48,
+        J2_ART_NODE256
+
+};
+
+/**
+ * @struct @c j2art_leaf
+ * 
+ *      @brief A whole key with its value. The key is NUL terminated so it 
+ *      can be read as a C string.
+ * 
+ */
+struct j2art_leaf {
+
+        void * value;
+        size_t bytes;
+        char key[];
+
+};
+
+/**
+ * @struct @c j2art_node
+ * 
+ *      @brief Header every inner node starts with. Children are either 
+ *      inner nodes or leaves, a leaf pointer has its lowest bit set.
+ * 
+ * 
+ *      @tparam @b type
+ *      @tparam @b count
+ *      @tparam @b prefix_length
+ *      @tparam @b prefix
+ *      @tparam @b leaf
+ *   
+ */
+struct j2art_node {
+
+        /**
+         * @tparam @b type
+         * enum j2art_type.
+         */
+        uint8_t type;
+
+        /**
+         * @tparam @b count
+         * Amount of children.
+         */
+        uint16_t count;
+
+        /**
+         * @tparam @b prefix_length
+         * Length of the compressed path every key below shares, the first
+         * J2_ART_PREFIX bytes of it are in @c "prefix".
+         */
+        uint32_t prefix_length;
+        unsigned char prefix[J2_ART_PREFIX];
+
+        /**
+         * @tparam @b leaf
+         * The key that ends right after the compressed path, if any. It 
+         * comes before every child in order.
+         */
+        struct j2art_leaf * leaf;
+
+};
+
+struct j2art_node4 {
+
+        struct j2art_node node;
+        unsigned char keys[4];
+        void * children[4];
+
+};
+
+struct j2art_node16 {
+
+        struct j2art_node node;
+        unsigned char keys[16];
+        void * children[16];
+
+};
+
+struct j2art_node48 {
+
+        struct j2art_node node;
+        /// Slot + 1 of the child of every byte, 0 for none.
+        unsigned char index[256];
+        void * children[48];
+
+};
+
+struct j2art_node256 {
+
+        struct j2art_node node;
+        void * children[256];
+
+};
+
+/**
+ * @brief 
+ * Telling leaves and inner nodes apart by the lowest pointer bit.
+ */
+#define J2_ART_IS_LEAF(child)  ((uintptr_t)(child) & 1)
+#define J2_ART_LEAF(child)     ((struct j2art_leaf *)((uintptr_t)(child) - 1))
+#define J2_ART_TAG(leaf)       ((void *)((uintptr_t)(leaf) + 1))
+
+/**
+ * @struct @c j2art
+ * 
+ *      @brief Adaptive radix tree, see j2art_new().
+ * 
+ */
+typedef struct j2art {
+
+        void * root;
+        size_t count;
+
+} j2art;
+
+/**
+ * @brief 
+ * Called for every key of a walk in order, a non 0 return value stops the
+ * walk and is returned by it.
+ */
+typedef int (*j2art_callback)(
+        void * data,
+        const char * key,
+        size_t bytes,
+        void * value
+);
+
+j2art *
+j2art_new(
+        void
+);
+
+void
+j2art_free(
+        j2art * tree
+);
+
+size_t
+j2art_count(
+        const j2art * tree
+);
+
+void **
+j2art_get(
+        const j2art * tree,
+        const_j2string key
+);
+
+void **
+j2art_cget(
+        const j2art * tree,
+        const char * key
+);
+
+int
+j2art_set(
+        j2art * tree,
+        const_j2string key,
+        void * value
+);
+
+int
+j2art_cset(
+        j2art * tree,
+        const char * key,
+        void * value
+);
+
+bool
+j2art_remove(
+        j2art * tree,
+        const_j2string key,
+        void ** value
+);
+
+bool
+j2art_cremove(
+        j2art * tree,
+        const char * key,
+        void ** value
+);
+
+void **
+j2art_longest_prefix(
+        const j2art * tree,
+        const char * key,
+        size_t * bytes
+);
+
+int
+j2art_walk(
+        const j2art * tree,
+        j2art_callback callback,
+        void * data
+);
+
+int
+j2art_walk_prefix(
+        const j2art * tree,
+        const char * prefix,
+        j2art_callback callback,
+        void * data
+);
+
+int
+j2art_walk_range(
+        const j2art * tree,
+        const char * low,
+        const char * high,
+        j2art_callback callback,
+        void * data
+);
+
+struct j2art_node *
+j2art_node_new(
+        enum j2art_type type
+);
+
+void
+j2art_node_free(
+        void * child
+);
+
+void **
+j2art_node_find(
+        const struct j2art_node * node,
+        unsigned char byte
+);
+
+int
+j2art_node_add(
+        void ** reference,
+        unsigned char byte,
+        void * child
+);
+
+void
+j2art_node_remove(
+        void ** reference,
+        unsigned char byte
+);
+
+void
+j2art_node_compact(
+        void ** reference
+);
+
+struct j2art_leaf *
+j2art_minimum(
+        const void * child
+);
+
+struct j2art_leaf *
+j2art_maximum(
+        const void * child
+);
+
+size_t
+j2art_prefix_mismatch(
+        const struct j2art_node * node,
+        const char * key,
+        size_t bytes,
+        size_t depth
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /** @c J2_ART_INCLUDE */
@@ -0,0 +1,449 @@
+/*** LICENSE: LGPLV2. *************************************
+ *                                                        *
+ *                                                        *
+ * This file is a part of the j2 project.                 *
+ * Copyright (C) 2022 Joško Križanović                    *
+ * <jkriza02@fesb.com>                                    *
+ *                                                        *
+ * This library is free software; you can redistribute    *
+ * it and/or modify it under the terms of the GNU Lesser  *
+ * General Public License as published by the Free        *
+ * Software Foundation; either version 2.1 of the         *
+ * License, or (at your option) any later version.        *
+ *                                                        *
+ * This library is distributed in the hope that it will   *
+ * be useful,                                             *
+ * but WITHOUT ANY WARRANTY; without even the implied     *
+ * warranty of MERCHANTABILITY or FITNESS FOR A           *
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public  *
+ * License for more details.                              *
+ *                                                        *
+ * You should have received a copy of the GNU Lesser      *
+ * General Public License along with this library; if     *
+ * not, write to the Free Software Foundation, Inc.,      *
+ * 51 Franklin Street, Fifth Floor, Boston,               *
+ * MA  02110-1301  USA                                    *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: FILE, AUTHOR & DATE INFORMATION. *********
+ *                                                        *
+ *                                                        *
+ * FILE:                                                  *
+ * Inserting and removing keys of adaptive radix trees,   *
+ * splitting and merging compressed paths.                *
+ *                                                        *
+ *                                                        *
+ * AUTHOR:                                                *
+ *      NAME:  Joško Križanović                           *
+ *      EMAIL: jkriza02@fesb.com                          *
+ *                                                        *
+ *                                                        *
+ * DATE:                                                  *
+ * 19.10.2026.                                            *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+
+#include "../art.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#ifdef __J2_DEV__
+#define AINSERT_CHECK(valid, text, fail)                                       \
+        if(!(valid)) {                                                         \
+                errno = EINVAL;                                                \
+                J2_DIAG(J2_DIAG_INVALID, text);                                \
+                return fail;                                                   \
+        }
+#else
+#define AINSERT_CHECK(valid, text, fail)
+#endif
+
+/**
+ * @brief 
+ * New leaf holding a NUL terminated copy of the key.
+ */
+static struct j2art_leaf *
+ainsert_leaf(
+        const char * key,
+        size_t bytes,
+        void * value )
+{
+
+        struct j2art_leaf * leaf = malloc(sizeof(struct j2art_leaf) 
+                                        + bytes + 1);
+        if(!leaf) {
+                errno = ENOMEM;
+                return NULL;
+        }
+
+        leaf->value = value;
+        leaf->bytes = bytes;
+        memcpy(leaf->key, key, bytes);
+        leaf->key[bytes] = '\0';
+
+        return leaf;
+
+}
+
+/**
+ * @brief 
+ * Put @c "leaf" into a fresh 4 wide @c "node" whose path ends at 
+ * @c "depth", as its leaf if the key ends there or as a child.
+ */
+static void
+ainsert_place(
+        struct j2art_node * node,
+        void ** reference,
+        struct j2art_leaf * leaf,
+        size_t depth )
+{
+        if(leaf->bytes == depth) node->leaf = leaf;
+        else j2art_node_add(reference, (unsigned char)leaf->key[depth], 
+                            J2_ART_TAG(leaf));
+}
+
+/**
+ * @brief 
+ * New 4 wide node with a compressed path of @c "length" bytes starting at
+ * @c "path".
+ */
+static struct j2art_node *
+ainsert_split_node(
+        const char * path,
+        size_t length )
+{
+
+        struct j2art_node * node = j2art_node_new(J2_ART_NODE4);
+        if(!node) return NULL;
+
+        node->prefix_length = (uint32_t)length;
+        memcpy(node->prefix, path, 
+               length < J2_ART_PREFIX ? length : J2_ART_PREFIX);
+
+        return node;
+
+}
+
+/**
+ * @brief 
+ * Insert @c "key" below the slot @c "reference" at @c "depth".
+ * 
+ * @returns 1 if the key was added, 0 if its value was replaced and -1 on
+ * failure.
+ */
+static int
+ainsert(
+        void ** reference,
+        const char * key,
+        size_t bytes,
+        size_t depth,
+        void * value )
+{
+
+        void * child = (*reference);
+
+        if(!child) {
+                struct j2art_leaf * leaf = ainsert_leaf(key, bytes, value);
+                if(!leaf) return -1;
+                (*reference) = J2_ART_TAG(leaf);
+                return 1;
+        }
+
+        /// Two keys meet at a leaf, a node with their shared path takes 
+        /// its place.
+        if(J2_ART_IS_LEAF(child)) {
+
+                struct j2art_leaf * old = J2_ART_LEAF(child);
+                if(old->bytes == bytes && !memcmp(old->key, key, bytes)) {
+                        old->value = value;
+                        return 0;
+                }
+
+                size_t limit  = (old->bytes < bytes ? old->bytes : bytes) 
+                              - depth;
+                size_t shared = 0;
+                while(shared < limit 
+                   && old->key[depth + shared] == key[depth + shared])
+                        shared++;
+
+                struct j2art_leaf * leaf = ainsert_leaf(key, bytes, value);
+                void * node = ainsert_split_node(key + depth, shared);
+                if(!leaf || !node) {
+                        free(leaf);
+                        free(node);
+                        return -1;
+                }
+
+                ainsert_place(node, &node, old,  depth + shared);
+                ainsert_place(node, &node, leaf, depth + shared);
+                (*reference) = node;
+                return 1;
+
+        }
+
+        struct j2art_node * node = child;
+
+        /// The key leaves the compressed path halfway, split the path 
+        /// with a new node at the point they part.
+        if(node->prefix_length) {
+
+                size_t shared = j2art_prefix_mismatch(node, key, bytes, depth);
+
+                if(shared < node->prefix_length) {
+
+                        struct j2art_leaf * leaf = 
+                                ainsert_leaf(key, bytes, value);
+                        void * split = ainsert_split_node(key + depth, shared);
+                        if(!leaf || !split) {
+                                free(leaf);
+                                free(split);
+                                return -1;
+                        }
+
+                        /// The old node keeps what comes after the byte it
+                        /// is now filed under.
+                        unsigned char byte;
+                        size_t        rest = node->prefix_length - shared - 1;
+
+                        if(node->prefix_length <= J2_ART_PREFIX) {
+                                byte = node->prefix[shared];
+                                memmove(node->prefix, 
+                                        node->prefix + shared + 1, rest);
+                        }
+                        else {
+                                const struct j2art_leaf * any = 
+                                        j2art_minimum(node);
+                                byte = (unsigned char)
+                                        any->key[depth + shared];
+                                memcpy(node->prefix, 
+                                       any->key + depth + shared + 1,
+                                       rest < J2_ART_PREFIX ? 
+                                       rest : J2_ART_PREFIX);
+                        }
+                        node->prefix_length = (uint32_t)rest;
+
+                        j2art_node_add(&split, byte, node);
+                        ainsert_place(split, &split, leaf, depth + shared);
+                        (*reference) = split;
+                        return 1;
+
+                }
+
+                depth += node->prefix_length;
+
+        }
+
+        if(depth == bytes) {
+                if(node->leaf) {
+                        node->leaf->value = value;
+                        return 0;
+                }
+                node->leaf = ainsert_leaf(key, bytes, value);
+                return node->leaf ? 1 : -1;
+        }
+
+        void ** slot = j2art_node_find(node, (unsigned char)key[depth]);
+        if(slot) return ainsert(slot, key, bytes, depth + 1, value);
+
+        struct j2art_leaf * leaf = ainsert_leaf(key, bytes, value);
+        if(!leaf) return -1;
+
+        if(j2art_node_add(reference, (unsigned char)key[depth], 
+                          J2_ART_TAG(leaf))) {
+                free(leaf);
+                return -1;
+        }
+
+        return 1;
+
+}
+
+/**
+ * @brief 
+ * Remove @c "key" from below the slot @c "reference" at @c "depth".
+ * 
+ * @returns The unlinked leaf of the key or NULL if it isn't inside.
+ */
+static struct j2art_leaf *
+aremove(
+        void ** reference,
+        const char * key,
+        size_t bytes,
+        size_t depth )
+{
+
+        void * child = (*reference);
+        if(!child) return NULL;
+
+        if(J2_ART_IS_LEAF(child)) {
+                struct j2art_leaf * leaf = J2_ART_LEAF(child);
+                if(leaf->bytes != bytes || memcmp(leaf->key, key, bytes)) 
+                        return NULL;
+                (*reference) = NULL;
+                return leaf;
+        }
+
+        struct j2art_node * node = child;
+
+        if(node->prefix_length) {
+                size_t stored = node->prefix_length < J2_ART_PREFIX ?
+                                node->prefix_length : J2_ART_PREFIX;
+                if(depth + node->prefix_length > bytes
+                || memcmp(node->prefix, key + depth, stored))
+                        return NULL;
+                depth += node->prefix_length;
+        }
+
+        if(depth == bytes) {
+                struct j2art_leaf * leaf = node->leaf;
+                if(!leaf || leaf->bytes != bytes 
+                || memcmp(leaf->key, key, bytes))
+                        return NULL;
+                node->leaf = NULL;
+                j2art_node_compact(reference);
+                return leaf;
+        }
+
+        unsigned char byte = (unsigned char)key[depth];
+        void ** slot = j2art_node_find(node, byte);
+        if(!slot) return NULL;
+
+        if(!J2_ART_IS_LEAF(*slot)) 
+                return aremove(slot, key, bytes, depth + 1);
+
+        struct j2art_leaf * leaf = J2_ART_LEAF(*slot);
+        if(leaf->bytes != bytes || memcmp(leaf->key, key, bytes)) 
+                return NULL;
+
+        j2art_node_remove(reference, byte);
+        return leaf;
+
+}
+
+/**
+ * @fn @c j2art_set(3)
+ * 
+ *      @brief Set the value of the j2string @c "key", adding a copy of it 
+ *      if it isn't inside yet.
+ * 
+ * 
+ *      @throw @a EINVAL - If @c "tree" or @c "key" are NULL ptrs.
+ *      @throw @a ENOMEM - Exhausted all memory spaces, the tree stays as
+ *                         it was.
+ * 
+ * 
+ *      @returns 1 if @c "key" was added, 0 if its value was replaced and 
+ *      -1 on failure.
+ * 
+ */
+int
+j2art_set(
+        j2art * tree,
+        const_j2string key,
+        void * value )
+{
+
+        AINSERT_CHECK(tree && key, "j2art_set() / j2.art.set() parameter"
+                " tree/key is a NULL ptr.", -1);
+
+        int added = ainsert(&tree->root, key, J2_STRING_INFO(key)->filled, 
+                            0, value);
+        if(added > 0) tree->count++;
+
+        return added;
+
+}
+
+/**
+ * @fn @c j2art_cset(3)
+ * 
+ *      @brief Same as @c j2art_set(3) but for a C string key.
+ * 
+ */
+int
+j2art_cset(
+        j2art * tree,
+        const char * key,
+        void * value )
+{
+
+        AINSERT_CHECK(tree && key, "j2art_cset() / j2.art.cset() parameter"
+                " tree/key is a NULL ptr.", -1);
+
+        int added = ainsert(&tree->root, key, strlen(key), 0, value);
+        if(added > 0) tree->count++;
+
+        return added;
+
+}
+
+/**
+ * @fn @c j2art_remove(3)
+ * 
+ *      @brief Remove the j2string @c "key" and free the trees copy of it.
+ * 
+ * 
+ *      @param @b value
+ *             If not NULL the removed value is stored here.
+ * 
+ * 
+ *      @throw @a EINVAL - If @c "tree" or @c "key" are NULL ptrs.
+ * 
+ * 
+ *      @returns true if @c "key" was inside.
+ * 
+ */
+bool
+j2art_remove(
+        j2art * tree,
+        const_j2string key,
+        void ** value )
+{
+
+        AINSERT_CHECK(tree && key, "j2art_remove() / j2.art.remove()"
+                " parameter tree/key is a NULL ptr.", false);
+
+        struct j2art_leaf * leaf = aremove(&tree->root, key, 
+                J2_STRING_INFO(key)->filled, 0);
+        if(!leaf) return false;
+
+        if(value) (*value) = leaf->value;
+        free(leaf);
+        tree->count--;
+
+        return true;
+
+}
+
+/**
+ * @fn @c j2art_cremove(3)
+ * 
+ *      @brief Same as @c j2art_remove(3) but for a C string key.
+ * 
+ */
+bool
+j2art_cremove(
+        j2art * tree,
+        const char * key,
+        void ** value )
+{
+
+        AINSERT_CHECK(tree && key, "j2art_cremove() / j2.art.cremove()"
+                " parameter tree/key is a NULL ptr.", false);
+
+        struct j2art_leaf * leaf = aremove(&tree->root, key, strlen(key), 0);
+        if(!leaf) return false;
+
+        if(value) (*value) = leaf->value;
+        free(leaf);
+        tree->count--;
+
+        return true;
+
+}
@@ -0,0 +1,637 @@
+/*** LICENSE: LGPLV2. *************************************
+ *                                                        *
+ *                                                        *
+ * This file is a part of the j2 project.                 *
+ * Copyright (C) 2022 Joško Križanović                    *
+ * <jkriza02@fesb.com>                                    *
+ *                                                        *
+ * This library is free software; you can redistribute    *
+ * it and/or modify it under the terms of the GNU Lesser  *
+ * General Public License as published by the Free        *
+ * Software Foundation; either version 2.1 of the         *
+ * License, or (at your option) any later version.        *
+ *                                                        *
+ * This library is distributed in the hope that it will   *
+ * be useful,                                             *
+ * but WITHOUT ANY WARRANTY; without even the implied     *
+ * warranty of MERCHANTABILITY or FITNESS FOR A           *
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public  *
+ * License for more details.                              *
+ *                                                        *
+ * You should have received a copy of the GNU Lesser      *
+ * General Public License along with this library; if     *
+ * not, write to the Free Software Foundation, Inc.,      *
+ * 51 Franklin Street, Fifth Floor, Boston,               *
+ * MA  02110-1301  USA                                    *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: FILE, AUTHOR & DATE INFORMATION. *********
+ *                                                        *
+ *                                                        *
+ * FILE:                                                  *
+ * Adaptive radix tree nodes, finding children with SIMD  *
+ * inside of 16 wide nodes, growing and shrinking between *
+ * node types.                                            *
+ *                                                        *
+ *                                                        *
+ * AUTHOR:                                                *
+ *      NAME:  Joško Križanović                           *
+ *      EMAIL: jkriza02@fesb.com                          *
+ *                                                        *
+ *                                                        *
+ * DATE:                                                  *
+ * 19.10.2026.                                            *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+
+#include "../art.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+/**
+ * @brief 
+ * Define J2_ART_NO_SIMD to always search 16 wide nodes byte by byte.
+ */
+#if defined(__SSE2__) && !defined(J2_ART_NO_SIMD)
+#define J2_ART_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__) && !defined(J2_ART_NO_SIMD)
+#define J2_ART_NEON
+#include <arm_neon.h>
+#endif
+
+/**
+ * @brief 
+ * Shrink a node once it holds fewer children than this, a bit under the 
+ * size of the smaller type so a key going in and out doesn't flip it.
+ */
+#define ANODE_SHRINK_256 37
+#define ANODE_SHRINK_48  12
+#define ANODE_SHRINK_16  3
+
+/**
+ * @brief 
+ * Slot of @c "byte" inside of the sorted keys of a 16 wide node, -1 if it
+ * isn't there. One compare of all 16 keys at once.
+ */
+static inline int
+anode_search16(
+        const struct j2art_node16 * node,
+        unsigned char byte )
+{
+
+        unsigned count = node->node.count;
+
+#if defined(J2_ART_SSE2)
+        __m128i  keys  = _mm_loadu_si128((const __m128i *)node->keys);
+        __m128i  match = _mm_cmpeq_epi8(keys, _mm_set1_epi8((char)byte));
+        unsigned mask  = (unsigned)_mm_movemask_epi8(match) 
+                       & ((1u << count) - 1);
+        return mask ? __builtin_ctz(mask) : -1;
+#elif defined(J2_ART_NEON)
+        uint8x16_t match = vceqq_u8(vld1q_u8(node->keys), vdupq_n_u8(byte));
+        uint64_t   mask  = vget_lane_u64(vreinterpret_u64_u8(
+                vshrn_n_u16(vreinterpretq_u16_u8(match), 4)), 0);
+        if(count < 16) mask &= (1ULL << (count * 4)) - 1;
+        return mask ? __builtin_ctzll(mask) / 4 : -1;
+#else
+        for(unsigned i = 0; i < count; i++) 
+                if(node->keys[i] == byte) return (int)i;
+        return -1;
+#endif
+
+}
+
+/**
+ * @brief 
+ * Copy the header of @c "src" into @c "dst" of another type.
+ */
+static inline void
+anode_copy_header(
+        struct j2art_node * dst,
+        const struct j2art_node * src )
+{
+        dst->count         = src->count;
+        dst->prefix_length = src->prefix_length;
+        dst->leaf          = src->leaf;
+        memcpy(dst->prefix, src->prefix, J2_ART_PREFIX);
+}
+
+/**
+ * @brief 
+ * Insert @c "child" under @c "byte" into the sorted arrays of a 4 or 16 
+ * wide node that has room.
+ */
+static inline void
+anode_insert_sorted(
+        struct j2art_node * node,
+        unsigned char * keys,
+        void ** children,
+        unsigned char byte,
+        void * child )
+{
+
+        unsigned at = 0;
+        while(at < node->count && keys[at] < byte) at++;
+
+        memmove(keys + at + 1, keys + at, node->count - at);
+        memmove(children + at + 1, children + at, 
+                (node->count - at) * sizeof(void *));
+
+        keys[at]     = byte;
+        children[at] = child;
+        node->count++;
+
+}
+
+/**
+ * @fn @c j2art_node_new(1)
+ * 
+ *      @brief Allocate an empty inner node of @c "type".
+ * 
+ *      @returns The node or NULL on failure.
+ * 
+ */
+struct j2art_node *
+j2art_node_new(
+        enum j2art_type type )
+{
+
+        size_t size = type == J2_ART_NODE4  ? sizeof(struct j2art_node4)
+                    : type == J2_ART_NODE16 ? sizeof(struct j2art_node16)
+                    : type == J2_ART_NODE48 ? sizeof(struct j2art_node48)
+                    :                         sizeof(struct j2art_node256);
+
+        struct j2art_node * node = calloc(1, size);
+        if(!node) {
+                errno = ENOMEM;
+                return NULL;
+        }
+
+        node->type = (uint8_t)type;
+
+        return node;
+
+}
+
+/**
+ * @fn @c j2art_node_free(1)
+ * 
+ *      @brief Free a leaf or an inner node with everything below it.
+ * 
+ */
+void
+j2art_node_free(
+        void * child )
+{
+
+        if(!child) return;
+
+        if(J2_ART_IS_LEAF(child)) {
+                free(J2_ART_LEAF(child));
+                return;
+        }
+
+        struct j2art_node * node = child;
+        free(node->leaf);
+
+        switch(node->type) {
+        case J2_ART_NODE4:
+                for(unsigned i = 0; i < node->count; i++) 
+                        j2art_node_free(((struct j2art_node4 *)node)
+                                ->children[i]);
+                break;
+        case J2_ART_NODE16:
+                for(unsigned i = 0; i < node->count; i++) 
+                        j2art_node_free(((struct j2art_node16 *)node)
+                                ->children[i]);
+                break;
+        case J2_ART_NODE48:
+                for(unsigned i = 0; i < 48; i++) 
+                        j2art_node_free(((struct j2art_node48 *)node)
+                                ->children[i]);
+                break;
+        case J2_ART_NODE256:
+                for(unsigned i = 0; i < 256; i++) 
+                        j2art_node_free(((struct j2art_node256 *)node)
+                                ->children[i]);
+                break;
+        }
+
+        free(node);
+
+}
+
+/**
+ * @fn @c j2art_node_find(2)
+ * 
+ *      @brief Slot of the child under @c "byte".
+ * 
+ *      @returns Pointer to the slot or NULL if there is no such child.
+ * 
+ */
+void **
+j2art_node_find(
+        const struct j2art_node * node,
+        unsigned char byte )
+{
+
+        switch(node->type) {
+        case J2_ART_NODE4: {
+                struct j2art_node4 * n4 = (struct j2art_node4 *)node;
+                for(unsigned i = 0; i < node->count; i++) 
+                        if(n4->keys[i] == byte) return &n4->children[i];
+                return NULL;
+        }
+        case J2_ART_NODE16: {
+                struct j2art_node16 * n16 = (struct j2art_node16 *)node;
+                int at = anode_search16(n16, byte);
+                return at < 0 ? NULL : &n16->children[at];
+        }
+        case J2_ART_NODE48: {
+                struct j2art_node48 * n48 = (struct j2art_node48 *)node;
+                return n48->index[byte] ? 
+                        &n48->children[n48->index[byte] - 1] : NULL;
+        }
+        default: {
+                struct j2art_node256 * n256 = (struct j2art_node256 *)node;
+                return n256->children[byte] ? &n256->children[byte] : NULL;
+        }
+        }
+
+}
+
+/**
+ * @fn @c j2art_node_add(3)
+ * 
+ *      @brief Add @c "child" under @c "byte" to the node @c "(*reference)",
+ *      which must not have a child under it yet. A full node is replaced 
+ *      by the next bigger type and @c "(*reference)" updated.
+ * 
+ *      @returns 0 on success, -1 on failure.
+ * 
+ */
+int
+j2art_node_add(
+        void ** reference,
+        unsigned char byte,
+        void * child )
+{
+
+        struct j2art_node * node = (*reference);
+
+        switch(node->type) {
+        case J2_ART_NODE4: {
+                struct j2art_node4 * n4 = (struct j2art_node4 *)node;
+                if(node->count < 4) {
+                        anode_insert_sorted(node, n4->keys, n4->children, 
+                                            byte, child);
+                        return 0;
+                }
+
+                struct j2art_node16 * n16 = (struct j2art_node16 *)
+                        j2art_node_new(J2_ART_NODE16);
+                if(!n16) return -1;
+
+                anode_copy_header(&n16->node, node);
+                memcpy(n16->keys, n4->keys, 4);
+                memcpy(n16->children, n4->children, 4 * sizeof(void *));
+                anode_insert_sorted(&n16->node, n16->keys, n16->children, 
+                                    byte, child);
+
+                (*reference) = n16;
+                free(n4);
+                return 0;
+        }
+        case J2_ART_NODE16: {
+                struct j2art_node16 * n16 = (struct j2art_node16 *)node;
+                if(node->count < 16) {
+                        anode_insert_sorted(node, n16->keys, n16->children, 
+                                            byte, child);
+                        return 0;
+                }
+
+                struct j2art_node48 * n48 = (struct j2art_node48 *)
+                        j2art_node_new(J2_ART_NODE48);
+                if(!n48) return -1;
+
+                anode_copy_header(&n48->node, node);
+                for(unsigned i = 0; i < 16; i++) {
+                        n48->children[i]         = n16->children[i];
+                        n48->index[n16->keys[i]] = (unsigned char)(i + 1);
+                }
+                n48->children[16] = child;
+                n48->index[byte]  = 17;
+                n48->node.count++;
+
+                (*reference) = n48;
+                free(n16);
+                return 0;
+        }
+        case J2_ART_NODE48: {
+                struct j2art_node48 * n48 = (struct j2art_node48 *)node;
+                if(node->count < 48) {
+                        unsigned at = 0;
+                        while(n48->children[at]) at++;
+                        n48->children[at] = child;
+                        n48->index[byte]  = (unsigned char)(at + 1);
+                        node->count++;
+                        return 0;
+                }
+
+                struct j2art_node256 * n256 = (struct j2art_node256 *)
+                        j2art_node_new(J2_ART_NODE256);
+                if(!n256) return -1;
+
+                anode_copy_header(&n256->node, node);
+                for(unsigned i = 0; i < 256; i++) 
+                        if(n48->index[i]) 
+                                n256->children[i] = 
+                                        n48->children[n48->index[i] - 1];
+                n256->children[byte] = child;
+                n256->node.count++;
+
+                (*reference) = n256;
+                free(n48);
+                return 0;
+        }
+        default: {
+                struct j2art_node256 * n256 = (struct j2art_node256 *)node;
+                n256->children[byte] = child;
+                node->count++;
+                return 0;
+        }
+        }
+
+}
+
+/**
+ * @brief 
+ * Replace a 4 wide node that is left with a single child and no leaf by 
+ * that child, its compressed path is joined onto the front of the childs.
+ */
+static void
+anode_collapse(
+        void ** reference )
+{
+
+        struct j2art_node4 * n4   = (*reference);
+        void *               only = n4->children[0];
+
+        if(!J2_ART_IS_LEAF(only)) {
+
+                struct j2art_node * child = only;
+                unsigned char joined[J2_ART_PREFIX];
+                size_t        have = n4->node.prefix_length < J2_ART_PREFIX ?
+                                     n4->node.prefix_length : J2_ART_PREFIX;
+
+                memcpy(joined, n4->node.prefix, have);
+                if(have < J2_ART_PREFIX) joined[have++] = n4->keys[0];
+                if(have < J2_ART_PREFIX) {
+                        size_t rest = J2_ART_PREFIX - have;
+                        if(rest > child->prefix_length) 
+                                rest = child->prefix_length;
+                        memcpy(joined + have, child->prefix, rest);
+                }
+
+                memcpy(child->prefix, joined, J2_ART_PREFIX);
+                child->prefix_length += n4->node.prefix_length + 1;
+
+        }
+
+        (*reference) = only;
+        free(n4);
+
+}
+
+/**
+ * @fn @c j2art_node_compact(1)
+ * 
+ *      @brief After a child or the leaf of @c "(*reference)" was removed,
+ *      move it to a smaller type if it got sparse or replace it by what
+ *      little it still holds.
+ * 
+ */
+void
+j2art_node_compact(
+        void ** reference )
+{
+
+        struct j2art_node * node = (*reference);
+
+        switch(node->type) {
+        case J2_ART_NODE4: {
+                if(node->count == 0) {
+                        (*reference) = node->leaf ? J2_ART_TAG(node->leaf) 
+                                                  : NULL;
+                        free(node);
+                }
+                else if(node->count == 1 && !node->leaf) 
+                        anode_collapse(reference);
+                return;
+        }
+        case J2_ART_NODE16: {
+                if(node->count >= ANODE_SHRINK_16) return;
+
+                struct j2art_node16 * n16 = (struct j2art_node16 *)node;
+                struct j2art_node4  * n4  = (struct j2art_node4 *)
+                        j2art_node_new(J2_ART_NODE4);
+                if(!n4) return;
+
+                anode_copy_header(&n4->node, node);
+                memcpy(n4->keys, n16->keys, node->count);
+                memcpy(n4->children, n16->children, 
+                       node->count * sizeof(void *));
+
+                (*reference) = n4;
+                free(n16);
+                j2art_node_compact(reference);
+                return;
+        }
+        case J2_ART_NODE48: {
+                if(node->count >= ANODE_SHRINK_48) return;
+
+                struct j2art_node48 * n48 = (struct j2art_node48 *)node;
+                struct j2art_node16 * n16 = (struct j2art_node16 *)
+                        j2art_node_new(J2_ART_NODE16);
+                if(!n16) return;
+
+                anode_copy_header(&n16->node, node);
+                unsigned at = 0;
+                for(unsigned i = 0; i < 256; i++) 
+                        if(n48->index[i]) {
+                                n16->keys[at]     = (unsigned char)i;
+                                n16->children[at] = 
+                                        n48->children[n48->index[i] - 1];
+                                at++;
+                        }
+
+                (*reference) = n16;
+                free(n48);
+                return;
+        }
+        default: {
+                if(node->count >= ANODE_SHRINK_256) return;
+
+                struct j2art_node256 * n256 = (struct j2art_node256 *)node;
+                struct j2art_node48  * n48  = (struct j2art_node48 *)
+                        j2art_node_new(J2_ART_NODE48);
+                if(!n48) return;
+
+                anode_copy_header(&n48->node, node);
+                unsigned at = 0;
+                for(unsigned i = 0; i < 256; i++) 
+                        if(n256->children[i]) {
+                                n48->children[at] = n256->children[i];
+                                n48->index[i]     = (unsigned char)++at;
+                        }
+
+                (*reference) = n48;
+                free(n256);
+                return;
+        }
+        }
+
+}
+
+/**
+ * @fn @c j2art_node_remove(2)
+ * 
+ *      @brief Take the child under @c "byte" out of @c "(*reference)" 
+ *      without freeing it and compact the node.
+ * 
+ */
+void
+j2art_node_remove(
+        void ** reference,
+        unsigned char byte )
+{
+
+        struct j2art_node * node = (*reference);
+
+        switch(node->type) {
+        case J2_ART_NODE4: 
+        case J2_ART_NODE16: {
+                unsigned char * keys = node->type == J2_ART_NODE4 ?
+                        ((struct j2art_node4 *)node)->keys :
+                        ((struct j2art_node16 *)node)->keys;
+                void ** children = node->type == J2_ART_NODE4 ?
+                        ((struct j2art_node4 *)node)->children :
+                        ((struct j2art_node16 *)node)->children;
+
+                unsigned at = 0;
+                while(keys[at] != byte) at++;
+
+                memmove(keys + at, keys + at + 1, node->count - at - 1);
+                memmove(children + at, children + at + 1, 
+                        (node->count - at - 1) * sizeof(void *));
+                node->count--;
+                break;
+        }
+        case J2_ART_NODE48: {
+                struct j2art_node48 * n48 = (struct j2art_node48 *)node;
+                n48->children[n48->index[byte] - 1] = NULL;
+                n48->index[byte] = 0;
+                node->count--;
+                break;
+        }
+        default: {
+                ((struct j2art_node256 *)node)->children[byte] = NULL;
+                node->count--;
+                break;
+        }
+        }
+
+        j2art_node_compact(reference);
+
+}
+
+/**
+ * @brief 
+ * First or last child of an inner node in key order, ignoring its leaf.
+ */
+static void *
+anode_edge(
+        const struct j2art_node * node,
+        bool last )
+{
+
+        switch(node->type) {
+        case J2_ART_NODE4: 
+                return ((struct j2art_node4 *)node)->children[
+                        last ? node->count - 1 : 0];
+        case J2_ART_NODE16: 
+                return ((struct j2art_node16 *)node)->children[
+                        last ? node->count - 1 : 0];
+        case J2_ART_NODE48: {
+                const struct j2art_node48 * n48 = 
+                        (const struct j2art_node48 *)node;
+                for(unsigned i = 0; i < 256; i++) {
+                        unsigned byte = last ? 255 - i : i;
+                        if(n48->index[byte]) 
+                                return n48->children[n48->index[byte] - 1];
+                }
+                return NULL;
+        }
+        default: {
+                const struct j2art_node256 * n256 = 
+                        (const struct j2art_node256 *)node;
+                for(unsigned i = 0; i < 256; i++) {
+                        unsigned byte = last ? 255 - i : i;
+                        if(n256->children[byte]) 
+                                return n256->children[byte];
+                }
+                return NULL;
+        }
+        }
+
+}
+
+/**
+ * @fn @c j2art_minimum(1)
+ * 
+ *      @brief Leaf with the smallest key below @c "child".
+ * 
+ */
+struct j2art_leaf *
+j2art_minimum(
+        const void * child )
+{
+
+        while(child && !J2_ART_IS_LEAF(child)) {
+                const struct j2art_node * node = child;
+                if(node->leaf) return node->leaf;
+                if(!node->count) return NULL;
+                child = anode_edge(node, false);
+        }
+
+        return child ? J2_ART_LEAF(child) : NULL;
+
+}
+
+/**
+ * @fn @c j2art_maximum(1)
+ * 
+ *      @brief Leaf with the biggest key below @c "child".
+ * 
+ */
+struct j2art_leaf *
+j2art_maximum(
+        const void * child )
+{
+
+        while(child && !J2_ART_IS_LEAF(child)) {
+                const struct j2art_node * node = child;
+                if(!node->count) return node->leaf;
+                child = anode_edge(node, true);
+        }
+
+        return child ? J2_ART_LEAF(child) : NULL;
+
+}
@@ -0,0 +1,342 @@
+/*** LICENSE: LGPLV2. *************************************
+ *                                                        *
+ *                                                        *
+ * This file is a part of the j2 project.                 *
+ * Copyright (C) 2022 Joško Križanović                    *
+ * <jkriza02@fesb.com>                                    *
+ *                                                        *
+ * This library is free software; you can redistribute    *
+ * it and/or modify it under the terms of the GNU Lesser  *
+ * General Public License as published by the Free        *
+ * Software Foundation; either version 2.1 of the         *
+ * License, or (at your option) any later version.        *
+ *                                                        *
+ * This library is distributed in the hope that it will   *
+ * be useful,                                             *
+ * but WITHOUT ANY WARRANTY; without even the implied     *
+ * warranty of MERCHANTABILITY or FITNESS FOR A           *
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public  *
+ * License for more details.                              *
+ *                                                        *
+ * You should have received a copy of the GNU Lesser      *
+ * General Public License along with this library; if     *
+ * not, write to the Free Software Foundation, Inc.,      *
+ * 51 Franklin Street, Fifth Floor, Boston,               *
+ * MA  02110-1301  USA                                    *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: FILE, AUTHOR & DATE INFORMATION. *********
+ *                                                        *
+ *                                                        *
+ * FILE:                                                  *
+ * Creating adaptive radix trees, looking keys up and     *
+ * longest prefix matching.                               *
+ *                                                        *
+ *                                                        *
+ * AUTHOR:                                                *
+ *      NAME:  Joško Križanović                           *
+ *      EMAIL: jkriza02@fesb.com                          *
+ *                                                        *
+ *                                                        *
+ * DATE:                                                  *
+ * 19.10.2026.                                            *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+
+#include "../art.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#ifdef __J2_DEV__
+#define ART_CHECK(valid, text, fail)                                           \
+        if(!(valid)) {                                                         \
+                errno = EINVAL;                                                \
+                J2_DIAG(J2_DIAG_INVALID, text);                                \
+                return fail;                                                   \
+        }
+#else
+#define ART_CHECK(valid, text, fail)
+#endif
+
+/**
+ * @brief 
+ * Leaf holding exactly the @c "bytes" bytes of @c "key" or NULL.
+ */
+static struct j2art_leaf *
+art_search(
+        const j2art * tree,
+        const char * key,
+        size_t bytes )
+{
+
+        const void * child = tree->root;
+        size_t       depth = 0;
+
+        while(child) {
+
+                if(J2_ART_IS_LEAF(child)) {
+                        struct j2art_leaf * leaf = J2_ART_LEAF(child);
+                        return leaf->bytes == bytes 
+                            && !memcmp(leaf->key, key, bytes) ? leaf : NULL;
+                }
+
+                const struct j2art_node * node = child;
+
+                /// Only the stored part of a long path is compared here, 
+                /// the leaf at the end checks the whole key anyway.
+                if(node->prefix_length) {
+                        size_t stored = node->prefix_length < J2_ART_PREFIX ?
+                                        node->prefix_length : J2_ART_PREFIX;
+                        if(depth + node->prefix_length > bytes
+                        || memcmp(node->prefix, key + depth, stored))
+                                return NULL;
+                        depth += node->prefix_length;
+                }
+
+                if(depth == bytes) {
+                        struct j2art_leaf * leaf = node->leaf;
+                        return leaf && leaf->bytes == bytes 
+                            && !memcmp(leaf->key, key, bytes) ? leaf : NULL;
+                }
+
+                void ** slot = j2art_node_find(node, (unsigned char)key[depth]);
+                child = slot ? (*slot) : NULL;
+                depth++;
+
+        }
+
+        return NULL;
+
+}
+
+/**
+ * @fn @c j2art_prefix_mismatch(4)
+ * 
+ *      @brief Amount of bytes of the compressed path of @c "node" that 
+ *      match @c "key" from @c "depth" on, at most the rest of the key. 
+ *      Bytes past the stored part of the path are read from a leaf below.
+ * 
+ */
+size_t
+j2art_prefix_mismatch(
+        const struct j2art_node * node,
+        const char * key,
+        size_t bytes,
+        size_t depth )
+{
+
+        size_t limit = node->prefix_length;
+        if(limit > bytes - depth) limit = bytes - depth;
+
+        size_t stored = limit < J2_ART_PREFIX ? limit : J2_ART_PREFIX;
+        size_t at     = 0;
+
+        for(; at < stored; at++) 
+                if(node->prefix[at] != (unsigned char)key[depth + at]) 
+                        return at;
+
+        if(at < limit) {
+                const struct j2art_leaf * leaf = j2art_minimum(node);
+                for(; at < limit; at++) 
+                        if(leaf->key[depth + at] != key[depth + at]) 
+                                return at;
+        }
+
+        return at;
+
+}
+
+/**
+ * @fn @c j2art_new(0)
+ * 
+ *      @brief Create an empty adaptive radix tree. Keys are kept in byte
+ *      order, looking one up takes time in the length of the key and not
+ *      in the amount of keys.
+ * 
+ * 
+ *      @throw @a ENOMEM - Exhausted all memory spaces.
+ * 
+ * 
+ *      @returns The new tree or NULL on failure.
+ * 
+ */
+j2art *
+j2art_new(
+        void )
+{
+
+        j2art * tree = malloc(sizeof(j2art));
+        if(!tree) {
+                errno = ENOMEM;
+                return NULL;
+        }
+
+        tree->root  = NULL;
+        tree->count = 0;
+
+        return tree;
+
+}
+
+/**
+ * @fn @c j2art_free(1)
+ * 
+ *      @brief Free the tree and its copies of the keys, values are left to
+ *      the user.
+ * 
+ */
+void
+j2art_free(
+        j2art * tree )
+{
+
+        if(!tree) return;
+
+        j2art_node_free(tree->root);
+        free(tree);
+
+}
+
+/**
+ * @fn @c j2art_count(1)
+ * 
+ *      @brief Amount of keys inside of @c "tree".
+ * 
+ */
+size_t
+j2art_count(
+        const j2art * tree )
+{
+        return tree ? tree->count : 0;
+}
+
+/**
+ * @fn @c j2art_get(2)
+ * 
+ *      @brief Look up the j2string @c "key".
+ * 
+ * 
+ *      @throw @a EINVAL - If @c "tree" or @c "key" are NULL ptrs.
+ * 
+ * 
+ *      @returns Pointer to the value of @c "key" which can be changed in 
+ *      place, or NULL if it isn't inside.
+ * 
+ */
+void **
+j2art_get(
+        const j2art * tree,
+        const_j2string key )
+{
+
+        ART_CHECK(tree && key, "j2art_get() / j2.art.get() parameter"
+                " tree/key is a NULL ptr.", NULL);
+
+        struct j2art_leaf * leaf = art_search(tree, key, 
+                J2_STRING_INFO(key)->filled);
+
+        return leaf ? &leaf->value : NULL;
+
+}
+
+/**
+ * @fn @c j2art_cget(2)
+ * 
+ *      @brief Same as @c j2art_get(2) but for a C string key.
+ * 
+ */
+void **
+j2art_cget(
+        const j2art * tree,
+        const char * key )
+{
+
+        ART_CHECK(tree && key, "j2art_cget() / j2.art.cget() parameter"
+                " tree/key is a NULL ptr.", NULL);
+
+        struct j2art_leaf * leaf = art_search(tree, key, strlen(key));
+
+        return leaf ? &leaf->value : NULL;
+
+}
+
+/**
+ * @fn @c j2art_longest_prefix(3)
+ * 
+ *      @brief Find the longest key inside of @c "tree" that @c "key" 
+ *      starts with, e.g. the most specific route of a path.
+ * 
+ * 
+ *      @param @b bytes
+ *             If not NULL gets the length of the matched key.
+ * 
+ * 
+ *      @throw @a EINVAL - If @c "tree" or @c "key" are NULL ptrs.
+ * 
+ * 
+ *      @returns Pointer to the value of the matched key or NULL if no key
+ *      is a prefix of @c "key".
+ * 
+ */
+void **
+j2art_longest_prefix(
+        const j2art * tree,
+        const char * key,
+        size_t * bytes )
+{
+
+        ART_CHECK(tree && key, "j2art_longest_prefix() /"
+                " j2.art.longest_prefix() parameter tree/key is a NULL ptr.",
+                NULL);
+
+        size_t length = strlen(key);
+        size_t depth  = 0;
+        struct j2art_leaf * best  = NULL;
+        const void *        child = tree->root;
+
+        while(child) {
+
+                if(J2_ART_IS_LEAF(child)) {
+                        struct j2art_leaf * leaf = J2_ART_LEAF(child);
+                        if(leaf->bytes <= length 
+                        && !memcmp(leaf->key, key, leaf->bytes))
+                                best = leaf;
+                        break;
+                }
+
+                const struct j2art_node * node = child;
+
+                if(node->prefix_length) {
+                        size_t stored = node->prefix_length < J2_ART_PREFIX ?
+                                        node->prefix_length : J2_ART_PREFIX;
+                        if(depth + node->prefix_length > length
+                        || memcmp(node->prefix, key + depth, stored))
+                                break;
+                        depth += node->prefix_length;
+                }
+
+                /// Comparing the whole leaf also covers a long path that was
+                /// only partly compared above.
+                struct j2art_leaf * leaf = node->leaf;
+                if(leaf && !memcmp(leaf->key, key, leaf->bytes)) best = leaf;
+                else if(leaf) break;
+
+                if(depth == length) break;
+
+                void ** slot = j2art_node_find(node, (unsigned char)key[depth]);
+                child = slot ? (*slot) : NULL;
+                depth++;
+
+        }
+
+        if(best && bytes) (*bytes) = best->bytes;
+
+        return best ? &best->value : NULL;
+
+}
@@ -0,0 +1,394 @@
+/*** LICENSE: LGPLV2. *************************************
+ *                                                        *
+ *                                                        *
+ * This file is a part of the j2 project.                 *
+ * Copyright (C) 2022 Joško Križanović                    *
+ * <jkriza02@fesb.com>                                    *
+ *                                                        *
+ * This library is free software; you can redistribute    *
+ * it and/or modify it under the terms of the GNU Lesser  *
+ * General Public License as published by the Free        *
+ * Software Foundation; either version 2.1 of the         *
+ * License, or (at your option) any later version.        *
+ *                                                        *
+ * This library is distributed in the hope that it will   *
+ * be useful,                                             *
+ * but WITHOUT ANY WARRANTY; without even the implied     *
+ * warranty of MERCHANTABILITY or FITNESS FOR A           *
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public  *
+ * License for more details.                              *
+ *                                                        *
+ * You should have received a copy of the GNU Lesser      *
+ * General Public License along with this library; if     *
+ * not, write to the Free Software Foundation, Inc.,      *
+ * 51 Franklin Street, Fifth Floor, Boston,               *
+ * MA  02110-1301  USA                                    *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: FILE, AUTHOR & DATE INFORMATION. *********
+ *                                                        *
+ *                                                        *
+ * FILE:                                                  *
+ * Walking adaptive radix trees in key order, whole,      *
+ * under a prefix or inside of a range.                   *
+ *                                                        *
+ *                                                        *
+ * AUTHOR:                                                *
+ *      NAME:  Joško Križanović                           *
+ *      EMAIL: jkriza02@fesb.com                          *
+ *                                                        *
+ *                                                        *
+ * DATE:                                                  *
+ * 19.10.2026.                                            *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+
+#include "../art.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#ifdef __J2_DEV__
+#define AWALK_CHECK(valid, text, fail)                                         \
+        if(!(valid)) {                                                         \
+                errno = EINVAL;                                                \
+                J2_DIAG(J2_DIAG_INVALID, text);                                \
+                return fail;                                                   \
+        }
+#else
+#define AWALK_CHECK(valid, text, fail)
+#endif
+
+/**
+ * @brief 
+ * Byte order comparison of two keys, a key sorts before every longer key
+ * it is a prefix of.
+ */
+static int
+awalk_compare(
+        const char * a,
+        size_t a_bytes,
+        const char * b,
+        size_t b_bytes )
+{
+
+        int order = memcmp(a, b, a_bytes < b_bytes ? a_bytes : b_bytes);
+        if(order) return order;
+
+        return (a_bytes > b_bytes) - (a_bytes < b_bytes);
+
+}
+
+/**
+ * @brief 
+ * Call @c "callback" for every key below @c "child" in order.
+ */
+static int
+awalk(
+        const void * child,
+        j2art_callback callback,
+        void * data )
+{
+
+        if(!child) return 0;
+
+        if(J2_ART_IS_LEAF(child)) {
+                struct j2art_leaf * leaf = J2_ART_LEAF(child);
+                return callback(data, leaf->key, leaf->bytes, leaf->value);
+        }
+
+        const struct j2art_node * node = child;
+        int stop;
+
+        if(node->leaf && (stop = callback(data, node->leaf->key, 
+                node->leaf->bytes, node->leaf->value)))
+                return stop;
+
+        switch(node->type) {
+        case J2_ART_NODE4: {
+                const struct j2art_node4 * n4 = (const void *)node;
+                for(unsigned i = 0; i < node->count; i++) 
+                        if((stop = awalk(n4->children[i], callback, data)))
+                                return stop;
+                break;
+        }
+        case J2_ART_NODE16: {
+                const struct j2art_node16 * n16 = (const void *)node;
+                for(unsigned i = 0; i < node->count; i++) 
+                        if((stop = awalk(n16->children[i], callback, data)))
+                                return stop;
+                break;
+        }
+        case J2_ART_NODE48: {
+                const struct j2art_node48 * n48 = (const void *)node;
+                for(unsigned i = 0; i < 256; i++) 
+                        if(n48->index[i] && (stop = awalk(
+                                n48->children[n48->index[i] - 1], 
+                                callback, data)))
+                                return stop;
+                break;
+        }
+        default: {
+                const struct j2art_node256 * n256 = (const void *)node;
+                for(unsigned i = 0; i < 256; i++) 
+                        if((stop = awalk(n256->children[i], callback, data)))
+                                return stop;
+                break;
+        }
+        }
+
+        return 0;
+
+}
+
+/**
+ * @brief 
+ * Bounds of a range walk, NULL for an open end.
+ */
+struct awalk_range {
+
+        const char * low;
+        size_t       low_bytes;
+        const char * high;
+        size_t       high_bytes;
+        j2art_callback callback;
+        void *       data;
+
+};
+
+/**
+ * @brief 
+ * Is @c "leaf" at or after the low bound and before the high bound.
+ */
+static inline bool
+awalk_inside(
+        const struct awalk_range * range,
+        const struct j2art_leaf * leaf )
+{
+        return (!range->low 
+             || awalk_compare(leaf->key, leaf->bytes, 
+                              range->low, range->low_bytes) >= 0)
+            && (!range->high 
+             || awalk_compare(leaf->key, leaf->bytes, 
+                              range->high, range->high_bytes) < 0);
+}
+
+/**
+ * @brief 
+ * Walk the keys below @c "child" that are inside of @c "range". Subtrees 
+ * entirely inside are walked without any more comparisons, subtrees 
+ * entirely outside are skipped, only the ones on the edges of the range 
+ * are looked into.
+ */
+static int
+awalk_range(
+        const void * child,
+        const struct awalk_range * range )
+{
+
+        if(!child) return 0;
+
+        if(J2_ART_IS_LEAF(child)) {
+                struct j2art_leaf * leaf = J2_ART_LEAF(child);
+                return awalk_inside(range, leaf) ? range->callback(
+                        range->data, leaf->key, leaf->bytes, leaf->value) : 0;
+        }
+
+        const struct j2art_leaf * first = j2art_minimum(child);
+        const struct j2art_leaf * last  = j2art_maximum(child);
+
+        if(range->low && awalk_compare(last->key, last->bytes, 
+                range->low, range->low_bytes) < 0)
+                return 0;
+        if(range->high && awalk_compare(first->key, first->bytes, 
+                range->high, range->high_bytes) >= 0)
+                return 0;
+        if(awalk_inside(range, first) && awalk_inside(range, last))
+                return awalk(child, range->callback, range->data);
+
+        const struct j2art_node * node = child;
+        int stop;
+
+        if(node->leaf && (stop = awalk_range(J2_ART_TAG(node->leaf), range)))
+                return stop;
+
+        switch(node->type) {
+        case J2_ART_NODE4: {
+                const struct j2art_node4 * n4 = (const void *)node;
+                for(unsigned i = 0; i < node->count; i++) 
+                        if((stop = awalk_range(n4->children[i], range)))
+                                return stop;
+                break;
+        }
+        case J2_ART_NODE16: {
+                const struct j2art_node16 * n16 = (const void *)node;
+                for(unsigned i = 0; i < node->count; i++) 
+                        if((stop = awalk_range(n16->children[i], range)))
+                                return stop;
+                break;
+        }
+        case J2_ART_NODE48: {
+                const struct j2art_node48 * n48 = (const void *)node;
+                for(unsigned i = 0; i < 256; i++) 
+                        if(n48->index[i] && (stop = awalk_range(
+                                n48->children[n48->index[i] - 1], range)))
+                                return stop;
+                break;
+        }
+        default: {
+                const struct j2art_node256 * n256 = (const void *)node;
+                for(unsigned i = 0; i < 256; i++) 
+                        if((stop = awalk_range(n256->children[i], range)))
+                                return stop;
+                break;
+        }
+        }
+
+        return 0;
+
+}
+
+/**
+ * @fn @c j2art_walk(3)
+ * 
+ *      @brief Call @c "callback" for every key of @c "tree" in byte order.
+ * 
+ * 
+ *      @throw @a EINVAL - If @c "tree" or @c "callback" are NULL ptrs.
+ * 
+ * 
+ *      @returns 0 or the first non 0 value returned by @c "callback".
+ * 
+ */
+int
+j2art_walk(
+        const j2art * tree,
+        j2art_callback callback,
+        void * data )
+{
+
+        AWALK_CHECK(tree && callback, "j2art_walk() / j2.art.walk()"
+                " parameter tree/callback is a NULL ptr.", -1);
+
+        return awalk(tree->root, callback, data);
+
+}
+
+/**
+ * @fn @c j2art_walk_prefix(4)
+ * 
+ *      @brief Call @c "callback" in byte order for every key of @c "tree"
+ *      that starts with @c "prefix". The tree is descended along the 
+ *      prefix, only the subtree below it is walked.
+ * 
+ * 
+ *      @throw @a EINVAL - If @c "tree", @c "prefix" or @c "callback" are 
+ *                         NULL ptrs.
+ * 
+ * 
+ *      @returns 0 or the first non 0 value returned by @c "callback".
+ * 
+ */
+int
+j2art_walk_prefix(
+        const j2art * tree,
+        const char * prefix,
+        j2art_callback callback,
+        void * data )
+{
+
+        AWALK_CHECK(tree && prefix && callback, "j2art_walk_prefix() /"
+                " j2.art.walk_prefix() parameter"
+                " tree/prefix/callback is a NULL ptr.", -1);
+
+        size_t       bytes = strlen(prefix);
+        size_t       depth = 0;
+        const void * child = tree->root;
+
+        while(child) {
+
+                if(J2_ART_IS_LEAF(child)) {
+                        struct j2art_leaf * leaf = J2_ART_LEAF(child);
+                        if(leaf->bytes < bytes 
+                        || memcmp(leaf->key, prefix, bytes))
+                                return 0;
+                        return callback(data, leaf->key, leaf->bytes, 
+                                        leaf->value);
+                }
+
+                const struct j2art_node * node = child;
+
+                if(node->prefix_length) {
+                        size_t shared = j2art_prefix_mismatch(node, prefix, 
+                                                              bytes, depth);
+                        /// The prefix ends inside of the compressed path, 
+                        /// every key below starts with it.
+                        if(depth + shared == bytes) 
+                                return awalk(child, callback, data);
+                        if(shared < node->prefix_length) return 0;
+                        depth += node->prefix_length;
+                }
+
+                if(depth == bytes) return awalk(child, callback, data);
+
+                void ** slot = j2art_node_find(node, 
+                                               (unsigned char)prefix[depth]);
+                child = slot ? (*slot) : NULL;
+                depth++;
+
+        }
+
+        return 0;
+
+}
+
+/**
+ * @fn @c j2art_walk_range(4)
+ * 
+ *      @brief Call @c "callback" in byte order for every key of @c "tree"
+ *      from @c "low" up to but without @c "high".
+ * 
+ * 
+ *      @param @b low
+ *             First key of the range, NULL to start at the first key.
+ * 
+ *      @param @b high
+ *             Key right after the range, NULL to go on to the last key.
+ * 
+ * 
+ *      @throw @a EINVAL - If @c "tree" or @c "callback" are NULL ptrs.
+ * 
+ * 
+ *      @returns 0 or the first non 0 value returned by @c "callback".
+ * 
+ */
+int
+j2art_walk_range(
+        const j2art * tree,
+        const char * low,
+        const char * high,
+        j2art_callback callback,
+        void * data )
+{
+
+        AWALK_CHECK(tree && callback, "j2art_walk_range() /"
+                " j2.art.walk_range() parameter"
+                " tree/callback is a NULL ptr.", -1);
+
+        struct awalk_range range = {
+                .low        = low,
+                .low_bytes  = low  ? strlen(low)  : 0,
+                .high       = high,
+                .high_bytes = high ? strlen(high) : 0,
+                .callback   = callback,
+                .data       = data
+        };
+
+        return awalk_range(tree->root, &range);
+
+}
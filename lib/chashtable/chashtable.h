@@ -0,0 +1,239 @@
+/*** LICENSE: LGPLV2. *************************************
+ *                                                        *
+ *                                                        *
+ * This file is a part of the j2 project.                 *
+ * Copyright (C) 2022 Joško Križanović                    *
+ * <jkriza02@fesb.com>                                    *
+ *                                                        *
+ * This library is free software; you can redistribute    *
+ * it and/or modify it under the terms of the GNU Lesser  *
+ * General Public License as published by the Free        *
+ * Software Foundation; either version 2.1 of the         *
+ * License, or (at your option) any later version.        *
+ *                                                        *
+ * This library is distributed in the hope that it will   *
+ * be useful,                                             *
+ * but WITHOUT ANY WARRANTY; without even the implied     *
+ * warranty of MERCHANTABILITY or FITNESS FOR A           *
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public  *
+ * License for more details.                              *
+ *                                                        *
+ * You should have received a copy of the GNU Lesser      *
+ * General Public License along with this library; if     *
+ * not, write to the Free Software Foundation, Inc.,      *
+ * 51 Franklin Street, Fifth Floor, Boston,               *
+ * MA  02110-1301  USA                                    *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: FILE, AUTHOR & DATE INFORMATION. *********
+ *                                                        *
+ *                                                        *
+ * FILE:                                                  *
+ * Concurrent hash table, readers never lock or write     *
+ * shared memory other than their own stripe counter      *
+ * while a single writer at a time updates it.            *
+ *                                                        *
+ *                                                        *
+ * AUTHOR:                                                *
+ *      NAME:  Joško Križanović                           *
+ *      EMAIL: jkriza02@fesb.com                          *
+ *                                                        *
+ *                                                        *
+ * DATE:                                                  *
+ * 19.10.2026.                                            *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: COMPATIBILITY. ***************************
+ *                                                        *
+ *                                                        *
+ * C:                                                     *
+ * This library is written in compliance to the limited   *
+ * functionality at the disposal of the C99 standard.     *
+ *                                                        *
+ *                                                        *
+ * POSIX:                                                 *
+ * Writers are serialized with a pthread mutex, readers   *
+ * only use C11 atomics.                                  *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: USED NAMESPACE ***************************
+ *                                                        *
+ *                                                        *
+ * Used namespaces, ... indicates that all characters     *
+ * that come after do not belong to that namespace:       *
+ * -> j2chashtable...                                     *
+ * -> J2_CHASHTABLE...                                    *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: EXTERNAL FILES CALLED & PURPOSE **********
+ *                                                        *
+ *                                                        *
+ * Name                     Description                   *
+ * ----                     -----------                   *
+ * <stdbool.h>              booleans                      *
+ *                                                        *
+ * <stdint.h>               fixed size integers           *
+ *                                                        *
+ * "../string/string.h"     j2string keys and hashing     *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: DEVELOPMENT HISTORY/VERSIONS PUBLISHED ***
+ *                                                        *
+ *                                                        *
+ * Author  Release & Date  Description of modifications   *
+ * ------  --------------  ----------------------------   *
+ * josko3  V0.0            Inital creation.               *
+ * 567     19.10.2026.                                    *
+ * ------  --------------  ----------------------------   *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "../diag/diag.h"
+
+#include "../string/string.h"
+
+#ifndef J2_CHASHTABLE_INCLUDE
+#define J2_CHASHTABLE_INCLUDE
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup Concurrent table tuning
+ * @brief 
+ * Amount of reader counter stripes (threads are spread over them), the
+ * amount of removed entries a writer collects before it waits for readers
+ * and frees them and the smallest table.
+ * @{
+ */
+#define J2_CHASHTABLE_STRIPES 64
+#define J2_CHASHTABLE_RETIRE  64
+#define J2_CHASHTABLE_SLOTS   16
+/**
+ * @}
+ */
+
+/**
+ * @enum @c j2chashtable_key
+ * 
+ *      @brief Type of keys a table holds, fixed when it is created.
+ * 
+ */
+enum j2chashtable_key {
+
+        J2_CHASHTABLE_INTEGER,
+        J2_CHASHTABLE_STRING
+
+};
+
+/**
+ * @brief 
+ * Concurrent hash table, see j2chashtable_new().
+ */
+typedef struct j2chashtable j2chashtable;
+
+j2chashtable *
+j2chashtable_new(
+        enum j2chashtable_key type,
+        size_t reserve
+);
+
+void
+j2chashtable_free(
+        j2chashtable * table
+);
+
+size_t
+j2chashtable_count(
+        const j2chashtable * table
+);
+
+void
+j2chashtable_synchronize(
+        j2chashtable * table
+);
+
+bool
+j2chashtable_int_get(
+        j2chashtable * table,
+        uint64_t key,
+        void ** value
+);
+
+int
+j2chashtable_int_set(
+        j2chashtable * table,
+        uint64_t key,
+        void * value
+);
+
+bool
+j2chashtable_int_remove(
+        j2chashtable * table,
+        uint64_t key,
+        void ** value
+);
+
+bool
+j2chashtable_get(
+        j2chashtable * table,
+        const_j2string key,
+        void ** value
+);
+
+bool
+j2chashtable_cget(
+        j2chashtable * table,
+        const char * key,
+        void ** value
+);
+
+int
+j2chashtable_set(
+        j2chashtable * table,
+        const_j2string key,
+        void * value
+);
+
+int
+j2chashtable_cset(
+        j2chashtable * table,
+        const char * key,
+        void * value
+);
+
+bool
+j2chashtable_remove(
+        j2chashtable * table,
+        const_j2string key,
+        void ** value
+);
+
+bool
+j2chashtable_cremove(
+        j2chashtable * table,
+        const char * key,
+        void ** value
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /** @c J2_CHASHTABLE_INCLUDE */
@@ -0,0 +1,395 @@
+/*** LICENSE: LGPLV2. *************************************
+ *                                                        *
+ *                                                        *
+ * This file is a part of the j2 project.                 *
+ * Copyright (C) 2022 Joško Križanović                    *
+ * <jkriza02@fesb.com>                                    *
+ *                                                        *
+ * This library is free software; you can redistribute    *
+ * it and/or modify it under the terms of the GNU Lesser  *
+ * General Public License as published by the Free        *
+ * Software Foundation; either version 2.1 of the         *
+ * License, or (at your option) any later version.        *
+ *                                                        *
+ * This library is distributed in the hope that it will   *
+ * be useful,                                             *
+ * but WITHOUT ANY WARRANTY; without even the implied     *
+ * warranty of MERCHANTABILITY or FITNESS FOR A           *
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public  *
+ * License for more details.                              *
+ *                                                        *
+ * You should have received a copy of the GNU Lesser      *
+ * General Public License along with this library; if     *
+ * not, write to the Free Software Foundation, Inc.,      *
+ * 51 Franklin Street, Fifth Floor, Boston,               *
+ * MA  02110-1301  USA                                    *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: FILE, AUTHOR & DATE INFORMATION. *********
+ *                                                        *
+ *                                                        *
+ * FILE:                                                  *
+ * Creating and freeing concurrent hash tables, growing   *
+ * them and freeing removed entries once readers left.    *
+ *                                                        *
+ *                                                        *
+ * AUTHOR:                                                *
+ *      NAME:  Joško Križanović                           *
+ *      EMAIL: jkriza02@fesb.com                          *
+ *                                                        *
+ *                                                        *
+ * DATE:                                                  *
+ * 19.10.2026.                                            *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+
+#include "ctable.h"
+#include "../../stats/stats.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <sched.h>
+
+struct j2chashtable_entry j2chashtable_tombstone;
+_Thread_local unsigned j2chashtable_thread_stripe = UINT_MAX;
+
+/**
+ * @brief 
+ * Stripe the next new reader thread gets.
+ */
+static atomic_uint chashtable_stripe_next;
+
+/**
+ * @brief 
+ * Allocate an empty slot array of @c "capacity" slots, a power of 2.
+ */
+static struct j2chashtable_slots *
+chashtable_slots_new(
+        size_t capacity )
+{
+
+        struct j2chashtable_slots * slots = malloc(
+                sizeof(struct j2chashtable_slots) 
+              + capacity * sizeof(slots->slot[0]));
+        if(!slots) {
+                errno = ENOMEM;
+                return NULL;
+        }
+
+        slots->mask = capacity - 1;
+        for(size_t i = 0; i < capacity; i++) 
+                atomic_init(&slots->slot[i], NULL);
+
+        return slots;
+
+}
+
+/**
+ * @brief 
+ * Smallest power of 2 amount of slots that keeps @c "count" keys at a 
+ * quarter load, so there are count more inserts until the next growth.
+ */
+static size_t
+chashtable_capacity_for(
+        size_t count )
+{
+
+        size_t capacity = J2_CHASHTABLE_SLOTS;
+        while(capacity < count * 4) capacity <<= 1;
+
+        return capacity;
+
+}
+
+/**
+ * @brief 
+ * Free an entry together with the copy of its key.
+ */
+static void
+chashtable_entry_free(
+        j2chashtable * table,
+        struct j2chashtable_entry * entry )
+{
+
+        if(table->type == J2_CHASHTABLE_STRING) 
+                j2string_free(entry->key.string);
+        free(entry);
+
+}
+
+/**
+ * @fn @c j2chashtable_stripe_assign(0)
+ * 
+ *      @brief Give the calling thread a reader stripe, threads are spread
+ *      round robin over all of them.
+ * 
+ */
+unsigned
+j2chashtable_stripe_assign(
+        void )
+{
+
+        j2chashtable_thread_stripe = atomic_fetch_add_explicit(
+                &chashtable_stripe_next, 1, memory_order_relaxed) 
+                % J2_CHASHTABLE_STRIPES;
+
+        return j2chashtable_thread_stripe;
+
+}
+
+/**
+ * @brief 
+ * Move the epoch on, wait for every reader registered under the old one
+ * and free the retired entries. The caller holds the writer lock.
+ */
+static void
+chashtable_grace(
+        j2chashtable * table )
+{
+
+        unsigned epoch = atomic_load_explicit(&table->epoch, 
+                memory_order_relaxed);
+        atomic_store(&table->epoch, epoch + 1);
+
+        /// The counters below can't be read before the store above is seen,
+        /// an acquire load alone doesn't keep it behind a seq_cst store.
+        atomic_thread_fence(memory_order_seq_cst);
+
+        /// New readers register under the other parity and can't reach 
+        /// anything unlinked before the store above.
+        for(size_t i = 0; i < J2_CHASHTABLE_STRIPES; i++) 
+                while(atomic_load_explicit(
+                        &table->stripes[i].readers[epoch & 1],
+                        memory_order_acquire))
+                        sched_yield();
+
+        struct j2chashtable_entry * entry = table->retired;
+        while(entry) {
+                struct j2chashtable_entry * next = entry->retired;
+                chashtable_entry_free(table, entry);
+                entry = next;
+        }
+
+        table->retired       = NULL;
+        table->retired_count = 0;
+
+}
+
+/**
+ * @fn @c j2chashtable_retire(2)
+ * 
+ *      @brief Queue an entry that was just unlinked from the slots to be
+ *      freed after a grace period, running one once enough of them pile
+ *      up. The caller holds the writer lock.
+ * 
+ */
+void
+j2chashtable_retire(
+        j2chashtable * table,
+        struct j2chashtable_entry * entry )
+{
+
+        entry->retired = table->retired;
+        table->retired = entry;
+
+        if(++table->retired_count >= J2_CHASHTABLE_RETIRE) 
+                chashtable_grace(table);
+
+}
+
+/**
+ * @fn @c j2chashtable_grow(1)
+ * 
+ *      @brief Make room for one more used slot. Once half of the slots are
+ *      used a new array is built without the tombstones, published and the
+ *      old one freed after a grace period. The caller holds the writer 
+ *      lock.
+ * 
+ *      @returns 0 on success, -1 on failure.
+ * 
+ */
+int
+j2chashtable_grow(
+        j2chashtable * table )
+{
+
+        struct j2chashtable_slots * old = j2chashtable_slots_get(table);
+        if((table->used + 1) * 2 <= old->mask + 1) return 0;
+
+        size_t count = atomic_load_explicit(&table->count, 
+                memory_order_relaxed);
+        struct j2chashtable_slots * slots = 
+                chashtable_slots_new(chashtable_capacity_for(count + 1));
+        if(!slots) return -1;
+
+        for(size_t i = 0; i <= old->mask; i++) {
+
+                struct j2chashtable_entry * entry = atomic_load_explicit(
+                        &old->slot[i], memory_order_relaxed);
+                if(!entry || entry == &j2chashtable_tombstone) continue;
+
+                size_t index = entry->hash & slots->mask;
+                while(atomic_load_explicit(&slots->slot[index], 
+                        memory_order_relaxed))
+                        index = (index + 1) & slots->mask;
+                atomic_init(&slots->slot[index], entry);
+
+        }
+
+        table->used = count;
+        atomic_store_explicit(&table->slots, slots, memory_order_release);
+
+        J2_STATS_ADD(slots->mask > old->mask ? J2_STATS_GROW 
+                                             : J2_STATS_SHRINK, 1);
+        J2_TRACE2(chashtable_resize, old->mask + 1, slots->mask + 1);
+
+        chashtable_grace(table);
+        free(old);
+
+        return 0;
+
+}
+
+/**
+ * @fn @c j2chashtable_new(2)
+ * 
+ *      @brief Create an empty concurrent hash table. Any amount of threads
+ *      can read it at once without locking, writers take turns. 
+ * 
+ * 
+ *      @param @b type
+ *             J2_CHASHTABLE_INTEGER for @c uint64_t keys or 
+ *             J2_CHASHTABLE_STRING for j2string keys.
+ * 
+ *      @param @b reserve
+ *             Amount of keys the table fits before it first grows, 0 for
+ *             the smallest table.
+ * 
+ * 
+ *      @throw @a ENOMEM - Exhausted all memory spaces.
+ * 
+ * 
+ *      @returns The new table or NULL on failure.
+ * 
+ */
+j2chashtable *
+j2chashtable_new(
+        enum j2chashtable_key type,
+        size_t reserve )
+{
+
+        /// The reader stripes need their cache line alignment, malloc() 
+        /// only gives 16 bytes.
+        j2chashtable * table = aligned_alloc(_Alignof(j2chashtable), 
+                                             sizeof(j2chashtable));
+        if(!table) {
+                errno = ENOMEM;
+                return NULL;
+        }
+
+        struct j2chashtable_slots * slots = 
+                chashtable_slots_new(chashtable_capacity_for(reserve));
+        if(!slots) {
+                free(table);
+                return NULL;
+        }
+
+        if(pthread_mutex_init(&table->writer, NULL)) {
+                free(slots);
+                free(table);
+                errno = ENOMEM;
+                return NULL;
+        }
+
+        table->type          = type;
+        table->used          = 0;
+        table->retired       = NULL;
+        table->retired_count = 0;
+        atomic_init(&table->slots, slots);
+        atomic_init(&table->count, 0);
+        atomic_init(&table->epoch, 0);
+
+        for(size_t i = 0; i < J2_CHASHTABLE_STRIPES; i++) {
+                atomic_init(&table->stripes[i].readers[0], 0);
+                atomic_init(&table->stripes[i].readers[1], 0);
+        }
+
+        return table;
+
+}
+
+/**
+ * @fn @c j2chashtable_free(1)
+ * 
+ *      @brief Free the table, its entries and the copies of its j2string 
+ *      keys, values are left to the user. No other thread may use the 
+ *      table anymore.
+ * 
+ */
+void
+j2chashtable_free(
+        j2chashtable * table )
+{
+
+        if(!table) return;
+
+        struct j2chashtable_slots * slots = j2chashtable_slots_get(table);
+        for(size_t i = 0; i <= slots->mask; i++) {
+                struct j2chashtable_entry * entry = atomic_load_explicit(
+                        &slots->slot[i], memory_order_relaxed);
+                if(entry && entry != &j2chashtable_tombstone)
+                        chashtable_entry_free(table, entry);
+        }
+
+        chashtable_grace(table);
+        pthread_mutex_destroy(&table->writer);
+        free(slots);
+        free(table);
+
+}
+
+/**
+ * @fn @c j2chashtable_count(1)
+ * 
+ *      @brief Amount of keys in the table, may already be stale when 
+ *      writers are running.
+ * 
+ */
+size_t
+j2chashtable_count(
+        const j2chashtable * table )
+{
+
+        if(!table) return 0;
+
+        return atomic_load_explicit(
+                &((j2chashtable *)table)->count, memory_order_relaxed);
+
+}
+
+/**
+ * @fn @c j2chashtable_synchronize(1)
+ * 
+ *      @brief Wait until every reader that could still see a removed entry
+ *      left and free the removed entries. Writers do this by themselves 
+ *      every J2_CHASHTABLE_RETIRE removals, call it to get the memory back
+ *      sooner.
+ * 
+ */
+void
+j2chashtable_synchronize(
+        j2chashtable * table )
+{
+
+        if(!table) return;
+
+        pthread_mutex_lock(&table->writer);
+        chashtable_grace(table);
+        pthread_mutex_unlock(&table->writer);
+
+}
@@ -0,0 +1,284 @@
+/*** LICENSE: LGPLV2. *************************************
+ *                                                        *
+ *                                                        *
+ * This file is a part of the j2 project.                 *
+ * Copyright (C) 2022 Joško Križanović                    *
+ * <jkriza02@fesb.com>                                    *
+ *                                                        *
+ * This library is free software; you can redistribute    *
+ * it and/or modify it under the terms of the GNU Lesser  *
+ * General Public License as published by the Free        *
+ * Software Foundation; either version 2.1 of the         *
+ * License, or (at your option) any later version.        *
+ *                                                        *
+ * This library is distributed in the hope that it will   *
+ * be useful,                                             *
+ * but WITHOUT ANY WARRANTY; without even the implied     *
+ * warranty of MERCHANTABILITY or FITNESS FOR A           *
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public  *
+ * License for more details.                              *
+ *                                                        *
+ * You should have received a copy of the GNU Lesser      *
+ * General Public License along with this library; if     *
+ * not, write to the Free Software Foundation, Inc.,      *
+ * 51 Franklin Street, Fifth Floor, Boston,               *
+ * MA  02110-1301  USA                                    *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: FILE, AUTHOR & DATE INFORMATION. *********
+ *                                                        *
+ *                                                        *
+ * FILE:                                                  *
+ * Concurrent hash table operations for integer keys.     *
+ *                                                        *
+ *                                                        *
+ * AUTHOR:                                                *
+ *      NAME:  Joško Križanović                           *
+ *      EMAIL: jkriza02@fesb.com                          *
+ *                                                        *
+ *                                                        *
+ * DATE:                                                  *
+ * 19.10.2026.                                            *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+
+#include "ctable.h"
+#include "../../hashtable/hashtable.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <errno.h>
+
+#ifdef __J2_DEV__
+#define CINTKEY_CHECK(table, function, fail)                                   \
+        if(!(table) || (table)->type != J2_CHASHTABLE_INTEGER) {               \
+                errno = EINVAL;                                                \
+                J2_DIAG(J2_DIAG_INVALID,                                       \
+                        function "() parameter table is a"                     \
+                        " NULL ptr or doesn't hold integer keys.");            \
+                return fail;                                                   \
+        }
+#else
+#define CINTKEY_CHECK(table, function, fail)
+#endif
+
+/**
+ * @brief 
+ * Entry of @c "key" or NULL. @c "(*index)" gets the slot of the entry or,
+ * when it is missing, the first tombstone or empty slot a new entry can 
+ * take.
+ */
+static inline struct j2chashtable_entry *
+cintkey_find(
+        const struct j2chashtable_slots * slots,
+        uint64_t key,
+        uint64_t hash,
+        size_t * index )
+{
+
+        size_t at    = hash & slots->mask;
+        size_t first = SIZE_MAX;
+
+        for(size_t probed = 0; probed <= slots->mask; probed++) {
+
+                struct j2chashtable_entry * entry = atomic_load_explicit(
+                        &slots->slot[at], memory_order_acquire);
+
+                if(!entry) break;
+                if(entry == &j2chashtable_tombstone) {
+                        if(first == SIZE_MAX) first = at;
+                } 
+                else if(entry->hash == hash && entry->key.integer == key) {
+                        (*index) = at;
+                        return entry;
+                }
+
+                at = (at + 1) & slots->mask;
+
+        }
+
+        (*index) = first != SIZE_MAX ? first : at;
+        return NULL;
+
+}
+
+/**
+ * @fn @c j2chashtable_int_get(3)
+ * 
+ *      @brief Look up @c "key" without taking any lock, safe to call from 
+ *      any amount of threads while writers update the table.
+ * 
+ * 
+ *      @param @b table
+ *             Table with integer keys.
+ * 
+ *      @param @b key
+ *             Key to look up.
+ * 
+ *      @param @b value
+ *             Gets the value of the key if it isn't NULL.
+ * 
+ * 
+ *      @throw @a EINVAL - If @c "table" is a NULL ptr or doesn't hold 
+ *                         integer keys.
+ * 
+ * 
+ *      @returns True if the key is in the table.
+ * 
+ */
+bool
+j2chashtable_int_get(
+        j2chashtable * table,
+        uint64_t key,
+        void ** value )
+{
+
+        CINTKEY_CHECK(table, "j2chashtable_int_get", false);
+
+        uint64_t hash  = j2hashtable_hash_int(key);
+        unsigned token = j2chashtable_read_lock(table);
+
+        size_t index;
+        struct j2chashtable_entry * entry = cintkey_find(
+                j2chashtable_slots_get(table), key, hash, &index);
+
+        if(entry && value) 
+                (*value) = atomic_load_explicit(&entry->value, 
+                        memory_order_acquire);
+
+        j2chashtable_read_unlock(table, token);
+
+        return entry != NULL;
+
+}
+
+/**
+ * @fn @c j2chashtable_int_set(3)
+ * 
+ *      @brief Set the value of @c "key", adding the key if it isn't in the
+ *      table yet. Writers take turns, readers are never blocked.
+ * 
+ * 
+ *      @throw @a EINVAL - If @c "table" is a NULL ptr or doesn't hold 
+ *                         integer keys.
+ *      @throw @a ENOMEM - Exhausted all memory spaces, the table stays as
+ *                         it was.
+ * 
+ * 
+ *      @returns 1 if the key was added, 0 if its value was replaced and -1
+ *      on failure.
+ * 
+ */
+int
+j2chashtable_int_set(
+        j2chashtable * table,
+        uint64_t key,
+        void * value )
+{
+
+        CINTKEY_CHECK(table, "j2chashtable_int_set", -1);
+
+        uint64_t hash = j2hashtable_hash_int(key);
+
+        pthread_mutex_lock(&table->writer);
+
+        size_t index;
+        struct j2chashtable_entry * entry = cintkey_find(
+                j2chashtable_slots_get(table), key, hash, &index);
+
+        if(entry) {
+                atomic_store_explicit(&entry->value, value, 
+                        memory_order_release);
+                pthread_mutex_unlock(&table->writer);
+                return 0;
+        }
+
+        entry = malloc(sizeof(struct j2chashtable_entry));
+        if(!entry) {
+                pthread_mutex_unlock(&table->writer);
+                errno = ENOMEM;
+                return -1;
+        }
+
+        entry->hash        = hash;
+        entry->key.integer = key;
+        entry->retired     = NULL;
+        atomic_init(&entry->value, value);
+
+        if(j2chashtable_grow(table)) {
+                pthread_mutex_unlock(&table->writer);
+                free(entry);
+                return -1;
+        }
+
+        /// The slots may have been rebuilt, look for a free one again.
+        struct j2chashtable_slots * slots = j2chashtable_slots_get(table);
+        cintkey_find(slots, key, hash, &index);
+
+        if(!atomic_load_explicit(&slots->slot[index], memory_order_relaxed))
+                table->used++;
+
+        atomic_store_explicit(&slots->slot[index], entry, 
+                memory_order_release);
+        atomic_fetch_add_explicit(&table->count, 1, memory_order_relaxed);
+
+        pthread_mutex_unlock(&table->writer);
+
+        return 1;
+
+}
+
+/**
+ * @fn @c j2chashtable_int_remove(3)
+ * 
+ *      @brief Remove @c "key", storing its value into @c "(*value)" if 
+ *      @c "value" isn't NULL. The entry is freed once no reader can still
+ *      be looking at it.
+ * 
+ * 
+ *      @throw @a EINVAL - If @c "table" is a NULL ptr or doesn't hold 
+ *                         integer keys.
+ * 
+ * 
+ *      @returns True if the key was in the table.
+ * 
+ */
+bool
+j2chashtable_int_remove(
+        j2chashtable * table,
+        uint64_t key,
+        void ** value )
+{
+
+        CINTKEY_CHECK(table, "j2chashtable_int_remove", false);
+
+        uint64_t hash = j2hashtable_hash_int(key);
+
+        pthread_mutex_lock(&table->writer);
+
+        struct j2chashtable_slots * slots = j2chashtable_slots_get(table);
+        size_t index;
+        struct j2chashtable_entry * entry = cintkey_find(slots, key, hash, 
+                &index);
+
+        if(!entry) {
+                pthread_mutex_unlock(&table->writer);
+                return false;
+        }
+
+        if(value) (*value) = atomic_load_explicit(&entry->value, 
+                memory_order_relaxed);
+
+        atomic_store_explicit(&slots->slot[index], &j2chashtable_tombstone,
+                memory_order_release);
+        atomic_fetch_sub_explicit(&table->count, 1, memory_order_relaxed);
+        j2chashtable_retire(table, entry);
+
+        pthread_mutex_unlock(&table->writer);
+
+        return true;
+
+}
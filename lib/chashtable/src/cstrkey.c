@@ -0,0 +1,436 @@
+/*** LICENSE: LGPLV2. *************************************
+ *                                                        *
+ *                                                        *
+ * This file is a part of the j2 project.                 *
+ * Copyright (C) 2022 Joško Križanović                    *
+ * <jkriza02@fesb.com>                                    *
+ *                                                        *
+ * This library is free software; you can redistribute    *
+ * it and/or modify it under the terms of the GNU Lesser  *
+ * General Public License as published by the Free        *
+ * Software Foundation; either version 2.1 of the         *
+ * License, or (at your option) any later version.        *
+ *                                                        *
+ * This library is distributed in the hope that it will   *
+ * be useful,                                             *
+ * but WITHOUT ANY WARRANTY; without even the implied     *
+ * warranty of MERCHANTABILITY or FITNESS FOR A           *
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public  *
+ * License for more details.                              *
+ *                                                        *
+ * You should have received a copy of the GNU Lesser      *
+ * General Public License along with this library; if     *
+ * not, write to the Free Software Foundation, Inc.,      *
+ * 51 Franklin Street, Fifth Floor, Boston,               *
+ * MA  02110-1301  USA                                    *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: FILE, AUTHOR & DATE INFORMATION. *********
+ *                                                        *
+ *                                                        *
+ * FILE:                                                  *
+ * Concurrent hash table operations for j2string and C    *
+ * string keys.                                           *
+ *                                                        *
+ *                                                        *
+ * AUTHOR:                                                *
+ *      NAME:  Joško Križanović                           *
+ *      EMAIL: jkriza02@fesb.com                          *
+ *                                                        *
+ *                                                        *
+ * DATE:                                                  *
+ * 19.10.2026.                                            *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+
+#include "ctable.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#ifdef __J2_DEV__
+#define CSTRKEY_CHECK(table, key, function, fail)                              \
+        if(!(table) || !(key) || (table)->type != J2_CHASHTABLE_STRING) {      \
+                errno = EINVAL;                                                \
+                J2_DIAG(J2_DIAG_INVALID,                                       \
+                        function "() parameter table/key is"                   \
+                        " a NULL ptr or table doesn't hold string"             \
+                        " keys.");                                             \
+                return fail;                                                   \
+        }
+#else
+#define CSTRKEY_CHECK(table, key, function, fail)
+#endif
+
+/**
+ * @brief 
+ * Entry holding the @c "bytes" bytes of @c "key" or NULL. @c "(*index)" 
+ * gets the slot of the entry or, when it is missing, the first tombstone 
+ * or empty slot a new entry can take.
+ */
+static inline struct j2chashtable_entry *
+cstrkey_find(
+        const struct j2chashtable_slots * slots,
+        const char * key,
+        size_t bytes,
+        uint64_t hash,
+        size_t * index )
+{
+
+        size_t at    = hash & slots->mask;
+        size_t first = SIZE_MAX;
+
+        for(size_t probed = 0; probed <= slots->mask; probed++) {
+
+                struct j2chashtable_entry * entry = atomic_load_explicit(
+                        &slots->slot[at], memory_order_acquire);
+
+                if(!entry) break;
+                if(entry == &j2chashtable_tombstone) {
+                        if(first == SIZE_MAX) first = at;
+                } 
+                else if(entry->hash == hash
+                     && J2_STRING_INFO(entry->key.string)->filled == bytes
+                     && !memcmp(entry->key.string, key, bytes)) {
+                        (*index) = at;
+                        return entry;
+                }
+
+                at = (at + 1) & slots->mask;
+
+        }
+
+        (*index) = first != SIZE_MAX ? first : at;
+        return NULL;
+
+}
+
+/**
+ * @brief 
+ * Lock free lookup shared by j2chashtable_get() and j2chashtable_cget().
+ */
+static bool
+cstrkey_get(
+        j2chashtable * table,
+        const char * key,
+        size_t bytes,
+        uint64_t hash,
+        void ** value )
+{
+
+        unsigned token = j2chashtable_read_lock(table);
+
+        size_t index;
+        struct j2chashtable_entry * entry = cstrkey_find(
+                j2chashtable_slots_get(table), key, bytes, hash, &index);
+
+        if(entry && value) 
+                (*value) = atomic_load_explicit(&entry->value, 
+                        memory_order_acquire);
+
+        j2chashtable_read_unlock(table, token);
+
+        return entry != NULL;
+
+}
+
+/**
+ * @brief 
+ * Set the value of @c "key", new keys get an entry holding a static 
+ * j2string copy of the key with the hash already cached.
+ */
+static int
+cstrkey_set(
+        j2chashtable * table,
+        const char * key,
+        size_t bytes,
+        size_t length,
+        uint64_t hash,
+        void * value )
+{
+
+        pthread_mutex_lock(&table->writer);
+
+        size_t index;
+        struct j2chashtable_entry * entry = cstrkey_find(
+                j2chashtable_slots_get(table), key, bytes, hash, &index);
+
+        if(entry) {
+                atomic_store_explicit(&entry->value, value, 
+                        memory_order_release);
+                pthread_mutex_unlock(&table->writer);
+                return 0;
+        }
+
+        entry = malloc(sizeof(struct j2chashtable_entry));
+        j2string copy = j2string_allocate((j2string_param){
+                .allocate = bytes + 1,
+                .padding  = 0,
+                .max      = bytes + 1
+        });
+        if(!entry || !copy) {
+                pthread_mutex_unlock(&table->writer);
+                free(entry);
+                if(copy) j2string_free(copy);
+                errno = ENOMEM;
+                return -1;
+        }
+
+        memcpy(copy, key, bytes);
+        copy[bytes] = '\0';
+
+        struct j2string_st * info = J2_STRING_INFO(copy);
+        info->filled = bytes;
+        info->length = length != SIZE_MAX ? length 
+                     : bytes ? j2string_utf8_strlen_sn(key, bytes, NULL) 
+                     : 0;
+        info->hash   = hash;
+
+        entry->hash       = hash;
+        entry->key.string = copy;
+        entry->retired    = NULL;
+        atomic_init(&entry->value, value);
+
+        if(j2chashtable_grow(table)) {
+                pthread_mutex_unlock(&table->writer);
+                j2string_free(copy);
+                free(entry);
+                return -1;
+        }
+
+        /// The slots may have been rebuilt, look for a free one again.
+        struct j2chashtable_slots * slots = j2chashtable_slots_get(table);
+        cstrkey_find(slots, key, bytes, hash, &index);
+
+        if(!atomic_load_explicit(&slots->slot[index], memory_order_relaxed))
+                table->used++;
+
+        atomic_store_explicit(&slots->slot[index], entry, 
+                memory_order_release);
+        atomic_fetch_add_explicit(&table->count, 1, memory_order_relaxed);
+
+        pthread_mutex_unlock(&table->writer);
+
+        return 1;
+
+}
+
+/**
+ * @brief 
+ * Unlink @c "key" and retire its entry, storing its value into 
+ * @c "(*value)" if asked.
+ */
+static bool
+cstrkey_remove(
+        j2chashtable * table,
+        const char * key,
+        size_t bytes,
+        uint64_t hash,
+        void ** value )
+{
+
+        pthread_mutex_lock(&table->writer);
+
+        struct j2chashtable_slots * slots = j2chashtable_slots_get(table);
+        size_t index;
+        struct j2chashtable_entry * entry = cstrkey_find(slots, key, bytes, 
+                hash, &index);
+
+        if(!entry) {
+                pthread_mutex_unlock(&table->writer);
+                return false;
+        }
+
+        if(value) (*value) = atomic_load_explicit(&entry->value, 
+                memory_order_relaxed);
+
+        atomic_store_explicit(&slots->slot[index], &j2chashtable_tombstone,
+                memory_order_release);
+        atomic_fetch_sub_explicit(&table->count, 1, memory_order_relaxed);
+        j2chashtable_retire(table, entry);
+
+        pthread_mutex_unlock(&table->writer);
+
+        return true;
+
+}
+
+/**
+ * @fn @c j2chashtable_get(3)
+ * 
+ *      @brief Look up the j2string @c "key" without taking any lock. Its 
+ *      hash is taken from (or cached into) its header, so a key shared 
+ *      between threads should be hashed once before they start.
+ * 
+ * 
+ *      @param @b value
+ *             Gets the value of the key if it isn't NULL.
+ * 
+ * 
+ *      @throw @a EINVAL - If @c "table" or @c "key" are NULL ptrs or the
+ *                         table doesn't hold string keys.
+ * 
+ * 
+ *      @returns True if @c "key" is in the table.
+ * 
+ */
+bool
+j2chashtable_get(
+        j2chashtable * table,
+        const_j2string key,
+        void ** value )
+{
+
+        CSTRKEY_CHECK(table, key, "j2chashtable_get", false);
+
+        return cstrkey_get(
+                table, key, J2_STRING_INFO(key)->filled, 
+                j2string_hash(key), value
+        );
+
+}
+
+/**
+ * @fn @c j2chashtable_cget(3)
+ * 
+ *      @brief Same as @c j2chashtable_get(3) but for a C string key.
+ * 
+ */
+bool
+j2chashtable_cget(
+        j2chashtable * table,
+        const char * key,
+        void ** value )
+{
+
+        CSTRKEY_CHECK(table, key, "j2chashtable_cget", false);
+
+        size_t bytes = strlen(key);
+
+        return cstrkey_get(
+                table, key, bytes, j2string_chash_sn(key, bytes), value
+        );
+
+}
+
+/**
+ * @fn @c j2chashtable_set(3)
+ * 
+ *      @brief Set the value of the j2string @c "key", adding a copy of it 
+ *      if it isn't inside yet. Writers take turns, readers are never 
+ *      blocked.
+ * 
+ * 
+ *      @throw @a EINVAL - If @c "table" or @c "key" are NULL ptrs or the
+ *                         table doesn't hold string keys.
+ *      @throw @a ENOMEM - Exhausted all memory spaces, the table stays as
+ *                         it was.
+ * 
+ * 
+ *      @returns 1 if @c "key" was added, 0 if its value was replaced and 
+ *      -1 on failure.
+ * 
+ */
+int
+j2chashtable_set(
+        j2chashtable * table,
+        const_j2string key,
+        void * value )
+{
+
+        CSTRKEY_CHECK(table, key, "j2chashtable_set", -1);
+
+        const struct j2string_st * info = J2_STRING_INFO(key);
+
+        return cstrkey_set(
+                table, key, info->filled, info->length, 
+                j2string_hash(key), value
+        );
+
+}
+
+/**
+ * @fn @c j2chashtable_cset(3)
+ * 
+ *      @brief Same as @c j2chashtable_set(3) but for a C string key.
+ * 
+ */
+int
+j2chashtable_cset(
+        j2chashtable * table,
+        const char * key,
+        void * value )
+{
+
+        CSTRKEY_CHECK(table, key, "j2chashtable_cset", -1);
+
+        size_t bytes = strlen(key);
+
+        return cstrkey_set(
+                table, key, bytes, SIZE_MAX,
+                j2string_chash_sn(key, bytes), value
+        );
+
+}
+
+/**
+ * @fn @c j2chashtable_remove(3)
+ * 
+ *      @brief Remove the j2string @c "key". The entry and the tables copy
+ *      of the key are freed once no reader can still be looking at them.
+ * 
+ * 
+ *      @param @b value
+ *             If not NULL the removed value is stored here.
+ * 
+ * 
+ *      @throw @a EINVAL - If @c "table" or @c "key" are NULL ptrs or the
+ *                         table doesn't hold string keys.
+ * 
+ * 
+ *      @returns true if @c "key" was inside.
+ * 
+ */
+bool
+j2chashtable_remove(
+        j2chashtable * table,
+        const_j2string key,
+        void ** value )
+{
+
+        CSTRKEY_CHECK(table, key, "j2chashtable_remove", false);
+
+        return cstrkey_remove(
+                table, key, J2_STRING_INFO(key)->filled, 
+                j2string_hash(key), value
+        );
+
+}
+
+/**
+ * @fn @c j2chashtable_cremove(3)
+ * 
+ *      @brief Same as @c j2chashtable_remove(3) but for a C string key.
+ * 
+ */
+bool
+j2chashtable_cremove(
+        j2chashtable * table,
+        const char * key,
+        void ** value )
+{
+
+        CSTRKEY_CHECK(table, key, "j2chashtable_cremove", false);
+
+        size_t bytes = strlen(key);
+
+        return cstrkey_remove(
+                table, key, bytes, j2string_chash_sn(key, bytes), value
+        );
+
+}
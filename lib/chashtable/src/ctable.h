@@ -0,0 +1,262 @@
+/*** LICENSE: LGPLV2. *************************************
+ *                                                        *
+ *                                                        *
+ * This file is a part of the j2 project.                 *
+ * Copyright (C) 2022 Joško Križanović                    *
+ * <jkriza02@fesb.com>                                    *
+ *                                                        *
+ * This library is free software; you can redistribute    *
+ * it and/or modify it under the terms of the GNU Lesser  *
+ * General Public License as published by the Free        *
+ * Software Foundation; either version 2.1 of the         *
+ * License, or (at your option) any later version.        *
+ *                                                        *
+ * This library is distributed in the hope that it will   *
+ * be useful,                                             *
+ * but WITHOUT ANY WARRANTY; without even the implied     *
+ * warranty of MERCHANTABILITY or FITNESS FOR A           *
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public  *
+ * License for more details.                              *
+ *                                                        *
+ * You should have received a copy of the GNU Lesser      *
+ * General Public License along with this library; if     *
+ * not, write to the Free Software Foundation, Inc.,      *
+ * 51 Franklin Street, Fifth Floor, Boston,               *
+ * MA  02110-1301  USA                                    *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: FILE, AUTHOR & DATE INFORMATION. *********
+ *                                                        *
+ *                                                        *
+ * FILE:                                                  *
+ * Private layout of concurrent hash tables and the       *
+ * reader side of their grace periods, shared by the      *
+ * table and key files.                                   *
+ *                                                        *
+ *                                                        *
+ * AUTHOR:                                                *
+ *      NAME:  Joško Križanović                           *
+ *      EMAIL: jkriza02@fesb.com                          *
+ *                                                        *
+ *                                                        *
+ * DATE:                                                  *
+ * 19.10.2026.                                            *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+
+#include "../chashtable.h"
+#include <stdatomic.h>
+#include <pthread.h>
+#include <limits.h>
+
+#ifndef J2_CHASHTABLE_CTABLE_INCLUDE
+#define J2_CHASHTABLE_CTABLE_INCLUDE
+
+/**
+ * @struct @c j2chashtable_entry
+ * 
+ *      @brief A key with its value. Entries are published into a slot 
+ *      whole, only the value changes afterwards so readers never see a
+ *      half written key.
+ * 
+ * 
+ *      @tparam @b hash
+ *      @tparam @b value
+ *      @tparam @b key
+ *      @tparam @b retired
+ *   
+ */
+struct j2chashtable_entry {
+
+        /**
+         * @tparam @b hash
+         * Full hash of the key, compared before the key itself.
+         */
+        uint64_t hash;
+
+        /**
+         * @tparam @b value
+         * User value, replaced in place when an existing key is set.
+         */
+        _Atomic(void *) value;
+
+        /**
+         * @tparam @b key
+         * An integer or a static j2string copy of the key owned by the 
+         * table.
+         */
+        union {
+                uint64_t integer;
+                j2string string;
+        } key;
+
+        /**
+         * @tparam @b retired
+         * Next removed entry waiting for the readers to leave.
+         */
+        struct j2chashtable_entry * retired;
+
+};
+
+/**
+ * @struct @c j2chashtable_slots
+ * 
+ *      @brief Linearly probed array of entry pointers. A NULL slot ends a
+ *      probe, a removed key leaves j2chashtable_tombstone behind. Growing
+ *      builds a new array that shares the same entries.
+ * 
+ */
+struct j2chashtable_slots {
+
+        size_t mask;
+        _Atomic(struct j2chashtable_entry *) slot[];
+
+};
+
+/**
+ * @struct @c j2chashtable_stripe
+ * 
+ *      @brief Amount of readers inside of each of the two epochs, on its
+ *      own cache line so threads on different stripes never share one.
+ * 
+ */
+struct j2chashtable_stripe {
+
+        _Alignas(64) atomic_size_t readers[2];
+
+};
+
+struct j2chashtable {
+
+        /**
+         * @tparam @b type
+         * Type of keys.
+         */
+        enum j2chashtable_key type;
+
+        /**
+         * @tparam @b slots
+         * Current slot array, swapped whole when the table grows.
+         */
+        _Atomic(struct j2chashtable_slots *) slots;
+
+        /**
+         * @tparam @b count
+         * Amount of keys.
+         */
+        atomic_size_t count;
+
+        /**
+         * @tparam @b used
+         * Slots holding a key or a tombstone, only touched by writers.
+         */
+        size_t used;
+
+        /**
+         * @tparam @b epoch
+         * Readers register under the parity of the epoch, a grace period
+         * moves it on and waits for the old parity to drain.
+         */
+        atomic_uint epoch;
+
+        /**
+         * @tparam @b writer
+         * Serializes writers.
+         */
+        pthread_mutex_t writer;
+
+        /**
+         * @tparam @b retired
+         * Removed entries and their amount, freed after the next grace 
+         * period.
+         */
+        struct j2chashtable_entry * retired;
+        size_t retired_count;
+
+        struct j2chashtable_stripe stripes[J2_CHASHTABLE_STRIPES];
+
+};
+
+extern struct j2chashtable_entry j2chashtable_tombstone;
+extern _Thread_local unsigned j2chashtable_thread_stripe;
+
+unsigned
+j2chashtable_stripe_assign(
+        void
+);
+
+void
+j2chashtable_retire(
+        j2chashtable * table,
+        struct j2chashtable_entry * entry
+);
+
+int
+j2chashtable_grow(
+        j2chashtable * table
+);
+
+/**
+ * @brief 
+ * Enter a read side critical section, nothing reachable from the table is
+ * freed until j2chashtable_read_unlock() is called with the returned 
+ * token. Readers only write to their own stripe.
+ */
+static inline unsigned
+j2chashtable_read_lock(
+        j2chashtable * table )
+{
+
+        unsigned stripe = j2chashtable_thread_stripe;
+        if(stripe == UINT_MAX) stripe = j2chashtable_stripe_assign();
+
+        atomic_size_t * readers = table->stripes[stripe].readers;
+
+        while(1) {
+
+                unsigned epoch = atomic_load(&table->epoch);
+                atomic_fetch_add(&readers[epoch & 1], 1);
+
+                /// A writer that moved the epoch on before it could see 
+                /// our count is not waiting for us, register again.
+                if(atomic_load(&table->epoch) == epoch)
+                        return stripe * 2 + (epoch & 1);
+
+                atomic_fetch_sub_explicit(&readers[epoch & 1], 1,
+                        memory_order_release);
+
+        }
+
+}
+
+/**
+ * @brief 
+ * Leave the read side critical section entered with @c "token".
+ */
+static inline void
+j2chashtable_read_unlock(
+        j2chashtable * table,
+        unsigned token )
+{
+        atomic_fetch_sub_explicit(
+                &table->stripes[token / 2].readers[token & 1], 1,
+                memory_order_release);
+}
+
+/**
+ * @brief 
+ * Current slot array for a reader inside of a critical section or for the
+ * writer.
+ */
+static inline struct j2chashtable_slots *
+j2chashtable_slots_get(
+        j2chashtable * table )
+{
+        return atomic_load_explicit(&table->slots, memory_order_acquire);
+}
+
+#endif /** @c J2_CHASHTABLE_CTABLE_INCLUDE */
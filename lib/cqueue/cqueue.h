@@ -0,0 +1,205 @@
+/*** LICENSE: LGPLV2. *************************************
+ *                                                        *
+ *                                                        *
+ * This file is a part of the j2 project.                 *
+ * Copyright (C) 2022 Joško Križanović                    *
+ * <jkriza02@fesb.com>                                    *
+ *                                                        *
+ * This library is free software; you can redistribute    *
+ * it and/or modify it under the terms of the GNU Lesser  *
+ * General Public License as published by the Free        *
+ * Software Foundation; either version 2.1 of the         *
+ * License, or (at your option) any later version.        *
+ *                                                        *
+ * This library is distributed in the hope that it will   *
+ * be useful,                                             *
+ * but WITHOUT ANY WARRANTY; without even the implied     *
+ * warranty of MERCHANTABILITY or FITNESS FOR A           *
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public  *
+ * License for more details.                              *
+ *                                                        *
+ * You should have received a copy of the GNU Lesser      *
+ * General Public License along with this library; if     *
+ * not, write to the Free Software Foundation, Inc.,      *
+ * 51 Franklin Street, Fifth Floor, Boston,               *
+ * MA  02110-1301  USA                                    *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: FILE, AUTHOR & DATE INFORMATION. *********
+ *                                                        *
+ *                                                        *
+ * FILE:                                                  *
+ * Bounded lock free queues for handing elements between  *
+ * threads, a wait free single producer single consumer   *
+ * ring and a multi producer multi consumer ring with per *
+ * cell sequence numbers.                                 *
+ *                                                        *
+ *                                                        *
+ * AUTHOR:                                                *
+ *      NAME:  Joško Križanović                           *
+ *      EMAIL: jkriza02@fesb.com                          *
+ *                                                        *
+ *                                                        *
+ * DATE:                                                  *
+ * 19.10.2026.                                            *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: COMPATIBILITY. ***************************
+ *                                                        *
+ *                                                        *
+ * C:                                                     *
+ * This library is written in compliance to the limited   *
+ * functionality at the disposal of the C99 standard.     *
+ *                                                        *
+ *                                                        *
+ * POSIX:                                                 *
+ * Only C11 atomics are used, no locks.                   *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: USED NAMESPACE ***************************
+ *                                                        *
+ *                                                        *
+ * Used namespaces, ... indicates that all characters     *
+ * that come after do not belong to that namespace:       *
+ * -> j2cqueue...                                         *
+ * -> J2_CQUEUE...                                        *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: EXTERNAL FILES CALLED & PURPOSE **********
+ *                                                        *
+ *                                                        *
+ * Name                     Description                   *
+ * ----                     -----------                   *
+ * <stdbool.h>              booleans                      *
+ *                                                        *
+ * <stddef.h>               size_t                        *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: DEVELOPMENT HISTORY/VERSIONS PUBLISHED ***
+ *                                                        *
+ *                                                        *
+ * Author  Release & Date  Description of modifications   *
+ * ------  --------------  ----------------------------   *
+ * josko3  V0.0            Inital creation.               *
+ * 567     19.10.2026.                                    *
+ * ------  --------------  ----------------------------   *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "../diag/diag.h"
+
+#ifndef J2_CQUEUE_INCLUDE
+#define J2_CQUEUE_INCLUDE
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 
+ * Size of a cache line, fields written by different threads are kept this
+ * far apart.
+ */
+#define J2_CQUEUE_CACHE_LINE 64
+
+/**
+ * @brief 
+ * Single producer single consumer queue, see j2cqueue_spsc_new().
+ */
+typedef struct j2cqueue_spsc j2cqueue_spsc;
+
+/**
+ * @brief 
+ * Multi producer multi consumer queue, see j2cqueue_mpmc_new().
+ */
+typedef struct j2cqueue_mpmc j2cqueue_mpmc;
+
+j2cqueue_spsc *
+j2cqueue_spsc_new(
+        size_t size,
+        size_t capacity
+);
+
+void
+j2cqueue_spsc_free(
+        j2cqueue_spsc * queue
+);
+
+bool
+j2cqueue_spsc_push(
+        j2cqueue_spsc * queue,
+        const void * element
+);
+
+bool
+j2cqueue_spsc_pop(
+        j2cqueue_spsc * queue,
+        void * element
+);
+
+size_t
+j2cqueue_spsc_push_n(
+        j2cqueue_spsc * queue,
+        const void * elements,
+        size_t count
+);
+
+size_t
+j2cqueue_spsc_pop_n(
+        j2cqueue_spsc * queue,
+        void * elements,
+        size_t count
+);
+
+size_t
+j2cqueue_spsc_count(
+        j2cqueue_spsc * queue
+);
+
+j2cqueue_mpmc *
+j2cqueue_mpmc_new(
+        size_t size,
+        size_t capacity
+);
+
+void
+j2cqueue_mpmc_free(
+        j2cqueue_mpmc * queue
+);
+
+bool
+j2cqueue_mpmc_push(
+        j2cqueue_mpmc * queue,
+        const void * element
+);
+
+bool
+j2cqueue_mpmc_pop(
+        j2cqueue_mpmc * queue,
+        void * element
+);
+
+size_t
+j2cqueue_mpmc_count(
+        j2cqueue_mpmc * queue
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /** @c J2_CQUEUE_INCLUDE */
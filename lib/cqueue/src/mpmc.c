@@ -0,0 +1,304 @@
+/*** LICENSE: LGPLV2. *************************************
+ *                                                        *
+ *                                                        *
+ * This file is a part of the j2 project.                 *
+ * Copyright (C) 2022 Joško Križanović                    *
+ * <jkriza02@fesb.com>                                    *
+ *                                                        *
+ * This library is free software; you can redistribute    *
+ * it and/or modify it under the terms of the GNU Lesser  *
+ * General Public License as published by the Free        *
+ * Software Foundation; either version 2.1 of the         *
+ * License, or (at your option) any later version.        *
+ *                                                        *
+ * This library is distributed in the hope that it will   *
+ * be useful,                                             *
+ * but WITHOUT ANY WARRANTY; without even the implied     *
+ * warranty of MERCHANTABILITY or FITNESS FOR A           *
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public  *
+ * License for more details.                              *
+ *                                                        *
+ * You should have received a copy of the GNU Lesser      *
+ * General Public License along with this library; if     *
+ * not, write to the Free Software Foundation, Inc.,      *
+ * 51 Franklin Street, Fifth Floor, Boston,               *
+ * MA  02110-1301  USA                                    *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: FILE, AUTHOR & DATE INFORMATION. *********
+ *                                                        *
+ *                                                        *
+ * FILE:                                                  *
+ * Bounded multi producer multi consumer ring, every cell *
+ * carries a sequence number telling producers and        *
+ * consumers whose turn it is.                            *
+ *                                                        *
+ *                                                        *
+ * AUTHOR:                                                *
+ *      NAME:  Joško Križanović                           *
+ *      EMAIL: jkriza02@fesb.com                          *
+ *                                                        *
+ *                                                        *
+ * DATE:                                                  *
+ * 19.10.2026.                                            *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+
+#include "../cqueue.h"
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <stdalign.h>
+#include <stdatomic.h>
+
+#ifdef __J2_DEV__
+#define MPMC_CHECK(valid, text, fail)                                          \
+        if(!(valid)) {                                                         \
+                errno = EINVAL;                                                \
+                J2_DIAG(J2_DIAG_INVALID, text);                                \
+                return fail;                                                   \
+        }
+#else
+#define MPMC_CHECK(valid, text, fail)
+#endif
+
+/**
+ * @brief 
+ * A cell is its sequence number followed by the element, cells are 
+ * @c "stride" bytes apart.
+ */
+#define MPMC_SEQUENCE(queue, index)                                            \
+        ((atomic_size_t *)((queue)->cells + ((index) & (queue)->mask)          \
+                * (queue)->stride))
+#define MPMC_ELEMENT(queue, index)                                             \
+        ((unsigned char *)MPMC_SEQUENCE(queue, index) + sizeof(atomic_size_t))
+
+/**
+ * @struct @c j2cqueue_mpmc
+ * 
+ *      @brief Ring of cells with a sequence number each. A cell at index 
+ *      @c i is free for the producer that claims position @c p when its 
+ *      sequence is @c p, and full for the consumer that claims @c p when
+ *      it is @c p+1. Claiming a position is one compare and swap on the
+ *      tail or the head, the copy itself happens outside of it.
+ * 
+ */
+struct j2cqueue_mpmc {
+
+        _Alignas(J2_CQUEUE_CACHE_LINE) atomic_size_t tail;
+        _Alignas(J2_CQUEUE_CACHE_LINE) atomic_size_t head;
+
+        _Alignas(J2_CQUEUE_CACHE_LINE) size_t size;
+        size_t stride;
+        size_t mask;
+        unsigned char * cells;
+
+};
+
+/**
+ * @fn @c j2cqueue_mpmc_new(2)
+ * 
+ *      @brief Create a bounded queue any amount of threads can push into 
+ *      and pop from at once without locks. A push into a full queue or a 
+ *      pop from an empty one fails right away.
+ * 
+ * 
+ *      @param @b size
+ *             Size of one element in bytes, usually @c sizeof(type).
+ * 
+ *      @param @b capacity
+ *             Amount of elements the queue holds, rounded up to a power of
+ *             2 of at least 2. The queue never grows.
+ * 
+ * 
+ *      @throw @a EINVAL - If @c "size" or @c "capacity" are 0.
+ *      @throw @a ENOMEM - Exhausted all memory spaces.
+ * 
+ * 
+ *      @returns The new queue or NULL on failure.
+ * 
+ */
+j2cqueue_mpmc *
+j2cqueue_mpmc_new(
+        size_t size,
+        size_t capacity )
+{
+
+        size_t align  = alignof(max_align_t);
+        size_t stride = (sizeof(atomic_size_t) + size + align - 1) 
+                      & ~(align - 1);
+
+        if(!size || !capacity || capacity > SIZE_MAX / 2 / stride) {
+                errno = EINVAL;
+                return NULL;
+        }
+
+        size_t rounded = 2;
+        while(rounded < capacity) rounded <<= 1;
+
+        j2cqueue_mpmc * queue = aligned_alloc(J2_CQUEUE_CACHE_LINE, 
+                sizeof(j2cqueue_mpmc));
+        unsigned char * cells = malloc(rounded * stride);
+        if(!queue || !cells) {
+                free(queue);
+                free(cells);
+                errno = ENOMEM;
+                return NULL;
+        }
+
+        atomic_init(&queue->tail, 0);
+        atomic_init(&queue->head, 0);
+        queue->size   = size;
+        queue->stride = stride;
+        queue->mask   = rounded - 1;
+        queue->cells  = cells;
+
+        for(size_t i = 0; i < rounded; i++) 
+                atomic_init(MPMC_SEQUENCE(queue, i), i);
+
+        return queue;
+
+}
+
+/**
+ * @fn @c j2cqueue_mpmc_free(1)
+ * 
+ *      @brief Free the queue and the elements still inside, no thread may
+ *      use it anymore.
+ * 
+ */
+void
+j2cqueue_mpmc_free(
+        j2cqueue_mpmc * queue )
+{
+
+        if(!queue) return;
+
+        free(queue->cells);
+        free(queue);
+
+}
+
+/**
+ * @fn @c j2cqueue_mpmc_push(2)
+ * 
+ *      @brief Copy @c "element" to the back of @c "queue".
+ * 
+ *      @returns False if the queue is full.
+ * 
+ */
+bool
+j2cqueue_mpmc_push(
+        j2cqueue_mpmc * queue,
+        const void * element )
+{
+
+        MPMC_CHECK(queue && element, "j2cqueue_mpmc_push() parameter"
+                " queue/element is a NULL ptr.", false);
+
+        size_t position = atomic_load_explicit(&queue->tail, 
+                memory_order_relaxed);
+
+        while(1) {
+
+                size_t sequence = atomic_load_explicit(
+                        MPMC_SEQUENCE(queue, position), memory_order_acquire);
+                intptr_t difference = (intptr_t)sequence - (intptr_t)position;
+
+                if(!difference) {
+                        if(atomic_compare_exchange_weak_explicit(&queue->tail,
+                                &position, position + 1, 
+                                memory_order_relaxed, memory_order_relaxed))
+                                break;
+                }
+                /// The consumer of the last lap hasn't emptied the cell.
+                else if(difference < 0) return false;
+                else position = atomic_load_explicit(&queue->tail, 
+                        memory_order_relaxed);
+
+        }
+
+        memcpy(MPMC_ELEMENT(queue, position), element, queue->size);
+        atomic_store_explicit(MPMC_SEQUENCE(queue, position), position + 1,
+                memory_order_release);
+
+        return true;
+
+}
+
+/**
+ * @fn @c j2cqueue_mpmc_pop(2)
+ * 
+ *      @brief Remove the front element of @c "queue" copying it into 
+ *      @c "element" if it isn't NULL.
+ * 
+ *      @returns False if the queue is empty.
+ * 
+ */
+bool
+j2cqueue_mpmc_pop(
+        j2cqueue_mpmc * queue,
+        void * element )
+{
+
+        MPMC_CHECK(queue, "j2cqueue_mpmc_pop() parameter queue is a NULL"
+                " ptr.", false);
+
+        size_t position = atomic_load_explicit(&queue->head, 
+                memory_order_relaxed);
+
+        while(1) {
+
+                size_t sequence = atomic_load_explicit(
+                        MPMC_SEQUENCE(queue, position), memory_order_acquire);
+                intptr_t difference = (intptr_t)sequence 
+                                    - (intptr_t)(position + 1);
+
+                if(!difference) {
+                        if(atomic_compare_exchange_weak_explicit(&queue->head,
+                                &position, position + 1, 
+                                memory_order_relaxed, memory_order_relaxed))
+                                break;
+                }
+                /// No producer filled the cell yet.
+                else if(difference < 0) return false;
+                else position = atomic_load_explicit(&queue->head, 
+                        memory_order_relaxed);
+
+        }
+
+        if(element) memcpy(element, MPMC_ELEMENT(queue, position), 
+                           queue->size);
+        atomic_store_explicit(MPMC_SEQUENCE(queue, position), 
+                position + queue->mask + 1, memory_order_release);
+
+        return true;
+
+}
+
+/**
+ * @fn @c j2cqueue_mpmc_count(1)
+ * 
+ *      @brief Amount of elements inside of @c "queue", already stale if 
+ *      other threads are running.
+ * 
+ */
+size_t
+j2cqueue_mpmc_count(
+        j2cqueue_mpmc * queue )
+{
+
+        if(!queue) return 0;
+
+        size_t head = atomic_load_explicit(&queue->head, memory_order_acquire);
+        size_t tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+
+        return tail > head ? tail - head : 0;
+
+}
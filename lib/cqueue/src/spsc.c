@@ -0,0 +1,361 @@
+/*** LICENSE: LGPLV2. *************************************
+ *                                                        *
+ *                                                        *
+ * This file is a part of the j2 project.                 *
+ * Copyright (C) 2022 Joško Križanović                    *
+ * <jkriza02@fesb.com>                                    *
+ *                                                        *
+ * This library is free software; you can redistribute    *
+ * it and/or modify it under the terms of the GNU Lesser  *
+ * General Public License as published by the Free        *
+ * Software Foundation; either version 2.1 of the         *
+ * License, or (at your option) any later version.        *
+ *                                                        *
+ * This library is distributed in the hope that it will   *
+ * be useful,                                             *
+ * but WITHOUT ANY WARRANTY; without even the implied     *
+ * warranty of MERCHANTABILITY or FITNESS FOR A           *
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public  *
+ * License for more details.                              *
+ *                                                        *
+ * You should have received a copy of the GNU Lesser      *
+ * General Public License along with this library; if     *
+ * not, write to the Free Software Foundation, Inc.,      *
+ * 51 Franklin Street, Fifth Floor, Boston,               *
+ * MA  02110-1301  USA                                    *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: FILE, AUTHOR & DATE INFORMATION. *********
+ *                                                        *
+ *                                                        *
+ * FILE:                                                  *
+ * Wait free single producer single consumer ring, each   *
+ * side caches the index of the other one so it only      *
+ * touches the shared line when it looks full or empty.   *
+ *                                                        *
+ *                                                        *
+ * AUTHOR:                                                *
+ *      NAME:  Joško Križanović                           *
+ *      EMAIL: jkriza02@fesb.com                          *
+ *                                                        *
+ *                                                        *
+ * DATE:                                                  *
+ * 19.10.2026.                                            *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+
+#include "../cqueue.h"
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <stdatomic.h>
+
+#ifdef __J2_DEV__
+#define SPSC_CHECK(valid, text, fail)                                          \
+        if(!(valid)) {                                                         \
+                errno = EINVAL;                                                \
+                J2_DIAG(J2_DIAG_INVALID, text);                                \
+                return fail;                                                   \
+        }
+#else
+#define SPSC_CHECK(valid, text, fail)
+#endif
+
+/**
+ * @struct @c j2cqueue_spsc
+ * 
+ *      @brief Ring buffer with one cache line for the consumer, one for the
+ *      producer and one for the fields both only read. Each side keeps a
+ *      copy of the others index and reloads it only when the ring looks
+ *      full or empty through that copy.
+ * 
+ *      Indices count up forever and are masked on use, tail - head is the
+ *      amount of elements.
+ * 
+ */
+struct j2cqueue_spsc {
+
+        /// Consumer.
+        _Alignas(J2_CQUEUE_CACHE_LINE) atomic_size_t head;
+        size_t tail_cached;
+
+        /// Producer.
+        _Alignas(J2_CQUEUE_CACHE_LINE) atomic_size_t tail;
+        size_t head_cached;
+
+        /// Shared, read only.
+        _Alignas(J2_CQUEUE_CACHE_LINE) size_t size;
+        size_t mask;
+        unsigned char * array;
+
+};
+
+/**
+ * @fn @c j2cqueue_spsc_new(2)
+ * 
+ *      @brief Create a queue for exactly one producer thread and one 
+ *      consumer thread. Neither ever waits on the other, a push into a 
+ *      full queue or a pop from an empty one fails right away.
+ * 
+ * 
+ *      @param @b size
+ *             Size of one element in bytes, usually @c sizeof(type).
+ * 
+ *      @param @b capacity
+ *             Amount of elements the queue holds, rounded up to a power of
+ *             2. The queue never grows.
+ * 
+ * 
+ *      @throw @a EINVAL - If @c "size" or @c "capacity" are 0.
+ *      @throw @a ENOMEM - Exhausted all memory spaces.
+ * 
+ * 
+ *      @returns The new queue or NULL on failure.
+ * 
+ */
+j2cqueue_spsc *
+j2cqueue_spsc_new(
+        size_t size,
+        size_t capacity )
+{
+
+        if(!size || !capacity || capacity > SIZE_MAX / 2 / size) {
+                errno = EINVAL;
+                return NULL;
+        }
+
+        size_t rounded = 1;
+        while(rounded < capacity) rounded <<= 1;
+
+        j2cqueue_spsc * queue = aligned_alloc(J2_CQUEUE_CACHE_LINE, 
+                sizeof(j2cqueue_spsc));
+        unsigned char * array = malloc(rounded * size);
+        if(!queue || !array) {
+                free(queue);
+                free(array);
+                errno = ENOMEM;
+                return NULL;
+        }
+
+        atomic_init(&queue->head, 0);
+        atomic_init(&queue->tail, 0);
+        queue->tail_cached = 0;
+        queue->head_cached = 0;
+        queue->size        = size;
+        queue->mask        = rounded - 1;
+        queue->array       = array;
+
+        return queue;
+
+}
+
+/**
+ * @fn @c j2cqueue_spsc_free(1)
+ * 
+ *      @brief Free the queue and the elements still inside, neither thread
+ *      may use it anymore.
+ * 
+ */
+void
+j2cqueue_spsc_free(
+        j2cqueue_spsc * queue )
+{
+
+        if(!queue) return;
+
+        free(queue->array);
+        free(queue);
+
+}
+
+/**
+ * @fn @c j2cqueue_spsc_push(2)
+ * 
+ *      @brief Copy @c "element" to the back of @c "queue", only called by
+ *      the producer.
+ * 
+ *      @returns False if the queue is full.
+ * 
+ */
+bool
+j2cqueue_spsc_push(
+        j2cqueue_spsc * queue,
+        const void * element )
+{
+
+        SPSC_CHECK(queue && element, "j2cqueue_spsc_push() parameter"
+                " queue/element is a NULL ptr.", false);
+
+        size_t tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+
+        if(tail - queue->head_cached > queue->mask) {
+                queue->head_cached = atomic_load_explicit(&queue->head, 
+                        memory_order_acquire);
+                if(tail - queue->head_cached > queue->mask) return false;
+        }
+
+        memcpy(queue->array + (tail & queue->mask) * queue->size, element, 
+               queue->size);
+        atomic_store_explicit(&queue->tail, tail + 1, memory_order_release);
+
+        return true;
+
+}
+
+/**
+ * @fn @c j2cqueue_spsc_pop(2)
+ * 
+ *      @brief Remove the front element of @c "queue" copying it into 
+ *      @c "element" if it isn't NULL, only called by the consumer.
+ * 
+ *      @returns False if the queue is empty.
+ * 
+ */
+bool
+j2cqueue_spsc_pop(
+        j2cqueue_spsc * queue,
+        void * element )
+{
+
+        SPSC_CHECK(queue, "j2cqueue_spsc_pop() parameter queue is a NULL"
+                " ptr.", false);
+
+        size_t head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+
+        if(head == queue->tail_cached) {
+                queue->tail_cached = atomic_load_explicit(&queue->tail, 
+                        memory_order_acquire);
+                if(head == queue->tail_cached) return false;
+        }
+
+        if(element) memcpy(element, 
+                           queue->array + (head & queue->mask) * queue->size, 
+                           queue->size);
+        atomic_store_explicit(&queue->head, head + 1, memory_order_release);
+
+        return true;
+
+}
+
+/**
+ * @fn @c j2cqueue_spsc_push_n(3)
+ * 
+ *      @brief Copy as many of the @c "count" elements of the array 
+ *      @c "elements" to the back of @c "queue" as fit, publishing all of 
+ *      them at once. Only called by the producer.
+ * 
+ *      @returns Amount of elements pushed.
+ * 
+ */
+size_t
+j2cqueue_spsc_push_n(
+        j2cqueue_spsc * queue,
+        const void * elements,
+        size_t count )
+{
+
+        SPSC_CHECK(queue && (elements || !count), "j2cqueue_spsc_push_n()"
+                " parameter queue/elements is a NULL ptr.", 0);
+
+        size_t tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+        size_t room = queue->mask + 1 - (tail - queue->head_cached);
+
+        if(room < count) {
+                queue->head_cached = atomic_load_explicit(&queue->head, 
+                        memory_order_acquire);
+                room = queue->mask + 1 - (tail - queue->head_cached);
+                if(room < count) count = room;
+        }
+        if(!count) return 0;
+
+        size_t at    = tail & queue->mask;
+        size_t first = queue->mask + 1 - at;
+        if(first > count) first = count;
+
+        memcpy(queue->array + at * queue->size, elements, 
+               first * queue->size);
+        memcpy(queue->array, (const unsigned char *)elements 
+               + first * queue->size, (count - first) * queue->size);
+
+        atomic_store_explicit(&queue->tail, tail + count, 
+                memory_order_release);
+
+        return count;
+
+}
+
+/**
+ * @fn @c j2cqueue_spsc_pop_n(3)
+ * 
+ *      @brief Remove up to @c "count" elements from the front of 
+ *      @c "queue", copying them into the array @c "elements" in order if
+ *      it isn't NULL. Only called by the consumer.
+ * 
+ *      @returns Amount of elements removed.
+ * 
+ */
+size_t
+j2cqueue_spsc_pop_n(
+        j2cqueue_spsc * queue,
+        void * elements,
+        size_t count )
+{
+
+        SPSC_CHECK(queue, "j2cqueue_spsc_pop_n() parameter queue is a NULL"
+                " ptr.", 0);
+
+        size_t head  = atomic_load_explicit(&queue->head, memory_order_relaxed);
+        size_t ready = queue->tail_cached - head;
+
+        if(ready < count) {
+                queue->tail_cached = atomic_load_explicit(&queue->tail, 
+                        memory_order_acquire);
+                ready = queue->tail_cached - head;
+                if(ready < count) count = ready;
+        }
+        if(!count) return 0;
+
+        if(elements) {
+                size_t at    = head & queue->mask;
+                size_t first = queue->mask + 1 - at;
+                if(first > count) first = count;
+
+                memcpy(elements, queue->array + at * queue->size, 
+                       first * queue->size);
+                memcpy((unsigned char *)elements + first * queue->size, 
+                       queue->array, (count - first) * queue->size);
+        }
+
+        atomic_store_explicit(&queue->head, head + count, 
+                memory_order_release);
+
+        return count;
+
+}
+
+/**
+ * @fn @c j2cqueue_spsc_count(1)
+ * 
+ *      @brief Amount of elements inside of @c "queue", already stale if 
+ *      the other thread is running.
+ * 
+ */
+size_t
+j2cqueue_spsc_count(
+        j2cqueue_spsc * queue )
+{
+
+        if(!queue) return 0;
+
+        size_t head = atomic_load_explicit(&queue->head, memory_order_acquire);
+        size_t tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+
+        return tail - head;
+
+}
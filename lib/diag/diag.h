@@ -0,0 +1,210 @@
+/*** LICENSE: LGPLV2. *************************************
+ *                                                        *
+ *                                                        *
+ * This file is a part of the j2 project.                 *
+ * Copyright (C) 2022 Joško Križanović                    *
+ * <jkriza02@fesb.com>                                    *
+ *                                                        *
+ * This library is free software; you can redistribute    *
+ * it and/or modify it under the terms of the GNU Lesser  *
+ * General Public License as published by the Free        *
+ * Software Foundation; either version 2.1 of the         *
+ * License, or (at your option) any later version.        *
+ *                                                        *
+ * This library is distributed in the hope that it will   *
+ * be useful,                                             *
+ * but WITHOUT ANY WARRANTY; without even the implied     *
+ * warranty of MERCHANTABILITY or FITNESS FOR A           *
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public  *
+ * License for more details.                              *
+ *                                                        *
+ * You should have received a copy of the GNU Lesser      *
+ * General Public License along with this library; if     *
+ * not, write to the Free Software Foundation, Inc.,      *
+ * 51 Franklin Street, Fifth Floor, Boston,               *
+ * MA  02110-1301  USA                                    *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: FILE, AUTHOR & DATE INFORMATION. *********
+ *                                                        *
+ *                                                        *
+ * FILE:                                                  *
+ * Diagnostics of the j2 development checks. A failed     *
+ * check raises an error code with a static message       *
+ * through a single user installed hook instead of        *
+ * building an error package, and optional USDT trace     *
+ * points (make TRACE=t) mark the slow events of the      *
+ * library for perf and bpftrace.                         *
+ *                                                        *
+ *                                                        *
+ * AUTHOR:                                                *
+ *      NAME:  Joško Križanović                           *
+ *      EMAIL: jkriza02@fesb.com                          *
+ *                                                        *
+ *                                                        *
+ * DATE:                                                  *
+ * 19.10.2026.                                            *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: COMPATIBILITY. ***************************
+ *                                                        *
+ *                                                        *
+ * C:                                                     *
+ * This library is written in compliance to the limited   *
+ * functionality at the disposal of the C99 standard.     *
+ *                                                        *
+ *                                                        *
+ * POSIX:                                                 *
+ * The hook and its data are published with C11           *
+ * atomics, trace points need <sys/sdt.h> of systemtap    *
+ * and are left out otherwise.                            *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: USED NAMESPACE ***************************
+ *                                                        *
+ *                                                        *
+ * Used namespaces, ... indicates that all characters     *
+ * that come after do not belong to that namespace:       *
+ * -> j2diag...                                           *
+ * -> J2_DIAG...                                          *
+ * -> J2_TRACE...                                         *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: EXTERNAL FILES CALLED & PURPOSE **********
+ *                                                        *
+ *                                                        *
+ * Name                     Description                   *
+ * ----                     -----------                   *
+ * <stddef.h>               NULL                          *
+ *                                                        *
+ * <sys/sdt.h>              USDT probes, only with        *
+ *                          J2_TRACE                      *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: DEVELOPMENT HISTORY/VERSIONS PUBLISHED ***
+ *                                                        *
+ *                                                        *
+ * Author  Release & Date  Description of modifications   *
+ * ------  --------------  ----------------------------   *
+ * josko3  V0.0            Inital creation.               *
+ * 567     19.10.2026.                                    *
+ * ------  --------------  ----------------------------   *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+
+
+#include <stddef.h>
+
+#ifdef J2_TRACE
+#if defined(__has_include)
+#if __has_include(<sys/sdt.h>)
+#include <sys/sdt.h>
+#define J2_TRACE_SDT
+#endif
+#endif
+#ifndef J2_TRACE_SDT
+#error "J2_TRACE needs <sys/sdt.h>, install systemtap-sdt-dev or build without TRACE=t."
+#endif
+#endif
+
+#ifndef J2_DIAG_INCLUDE
+#define J2_DIAG_INCLUDE
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @enum @c j2diag_code
+ * 
+ *      @brief What a development check caught, every code has a static
+ *      message and an errno value.
+ * 
+ *      @tparam @b J2_DIAG_INVALID
+ *      A parameter is NULL or out of its range, errno EINVAL.
+ *      @tparam @b J2_DIAG_UNDERFLOW
+ *      More elements were popped than a stack holds, errno ERANGE.
+ * 
+ */
+enum j2diag_code {
+
+        J2_DIAG_INVALID,
+        J2_DIAG_UNDERFLOW,
+        J2_DIAG_CODES
+
+};
+
+/**
+ * @brief 
+ * Receives every raised diagnostic. @c "detail" is a string literal naming
+ * the function and the parameter at fault, @c "data" is whatever was 
+ * given to j2diag_set_hook(). Called from the thread that failed the 
+ * check.
+ */
+typedef void (*j2diag_hook)(
+        enum j2diag_code code,
+        const char * detail,
+        void * data
+);
+
+void
+j2diag_set_hook(
+        j2diag_hook hook,
+        void * data
+);
+
+void
+j2diag_raise(
+        enum j2diag_code code,
+        const char * detail
+);
+
+const char *
+j2diag_message(
+        enum j2diag_code code
+);
+
+int
+j2diag_errno(
+        enum j2diag_code code
+);
+
+/**
+ * @brief 
+ * Raise a diagnostic from a failed check, the detail has to be a string
+ * literal, nothing is built or copied for it.
+ */
+#define J2_DIAG(code, detail) j2diag_raise((code), (detail))
+
+/**
+ * @brief 
+ * USDT trace points in the provider @c "j2", e.g. 
+ * @c "perf probe sdt_j2:string_realloc" or 
+ * @c "bpftrace -e 'usdt:./a.out:j2:hashtable_rehash { ... }'". Without 
+ * J2_TRACE they are empty and their arguments are not evaluated.
+ */
+#ifdef J2_TRACE
+#define J2_TRACE1(name, a)    STAP_PROBE1(j2, name, a)
+#define J2_TRACE2(name, a, b) STAP_PROBE2(j2, name, a, b)
+#else
+#define J2_TRACE1(name, a)    ((void)0)
+#define J2_TRACE2(name, a, b) ((void)0)
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /** @c J2_DIAG_INCLUDE */
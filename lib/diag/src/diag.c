@@ -0,0 +1,180 @@
+/*** LICENSE: LGPLV2. *************************************
+ *                                                        *
+ *                                                        *
+ * This file is a part of the j2 project.                 *
+ * Copyright (C) 2022 Joško Križanović                    *
+ * <jkriza02@fesb.com>                                    *
+ *                                                        *
+ * This library is free software; you can redistribute    *
+ * it and/or modify it under the terms of the GNU Lesser  *
+ * General Public License as published by the Free        *
+ * Software Foundation; either version 2.1 of the         *
+ * License, or (at your option) any later version.        *
+ *                                                        *
+ * This library is distributed in the hope that it will   *
+ * be useful,                                             *
+ * but WITHOUT ANY WARRANTY; without even the implied     *
+ * warranty of MERCHANTABILITY or FITNESS FOR A           *
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public  *
+ * License for more details.                              *
+ *                                                        *
+ * You should have received a copy of the GNU Lesser      *
+ * General Public License along with this library; if     *
+ * not, write to the Free Software Foundation, Inc.,      *
+ * 51 Franklin Street, Fifth Floor, Boston,               *
+ * MA  02110-1301  USA                                    *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: FILE, AUTHOR & DATE INFORMATION. *********
+ *                                                        *
+ *                                                        *
+ * FILE:                                                  *
+ * Hook, messages and errno values of the diagnostics     *
+ * raised by the development checks.                      *
+ *                                                        *
+ *                                                        *
+ * AUTHOR:                                                *
+ *      NAME:  Joško Križanović                           *
+ *      EMAIL: jkriza02@fesb.com                          *
+ *                                                        *
+ *                                                        *
+ * DATE:                                                  *
+ * 19.10.2026.                                            *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+
+#include "../diag.h"
+#include <stdatomic.h>
+#include <errno.h>
+
+static const char * const diag_messages[J2_DIAG_CODES] = {
+        [J2_DIAG_INVALID]   = "j2err: Invalid parameter...",
+        [J2_DIAG_UNDERFLOW] = "j2err: Stack underflow..."
+};
+
+static const int diag_errnos[J2_DIAG_CODES] = {
+        [J2_DIAG_INVALID]   = EINVAL,
+        [J2_DIAG_UNDERFLOW] = ERANGE
+};
+
+/**
+ * @brief 
+ * Installed hook and its data, published together under a sequence lock.
+ * The sequence is odd while j2diag_set_hook() rewrites the pair, a raise 
+ * that saw it change in between reads the pair again, so a hook is never
+ * called with the data of another one.
+ */
+static atomic_uint          diag_seq  = 0;
+static _Atomic(j2diag_hook) diag_hook = NULL;
+static _Atomic(void *)      diag_data = NULL;
+
+/**
+ * @fn @c j2diag_set_hook(2)
+ * 
+ *      @brief Install the function every failed development check is 
+ *      reported to, a NULL @c "hook" silences them again. Safe to call
+ *      while other threads raise, each raise sees either the old or the
+ *      new hook together with its own data.
+ * 
+ *      @param hook
+ *      Function that receives the code and the detail of a diagnostic.
+ *      @param data
+ *      Passed to @c "hook" untouched.
+ * 
+ */
+void
+j2diag_set_hook(
+        j2diag_hook hook,
+        void * data )
+{
+
+        unsigned seq = atomic_load_explicit(&diag_seq, memory_order_relaxed);
+        do seq &= ~1u;
+        while(!atomic_compare_exchange_weak_explicit(&diag_seq, &seq, seq + 1,
+                                                     memory_order_acquire,
+                                                     memory_order_relaxed));
+        atomic_thread_fence(memory_order_release);
+
+        atomic_store_explicit(&diag_hook, hook, memory_order_relaxed);
+        atomic_store_explicit(&diag_data, data, memory_order_relaxed);
+
+        atomic_store_explicit(&diag_seq, seq + 2, memory_order_release);
+
+}
+
+/**
+ * @fn @c j2diag_raise(2)
+ * 
+ *      @brief Report a failed check to the installed hook and the @c "diag"
+ *      trace point. Without a hook this is one atomic load.
+ * 
+ *      @param code
+ *      What went wrong.
+ *      @param detail
+ *      String literal naming the function and the parameter at fault.
+ * 
+ */
+void
+j2diag_raise(
+        enum j2diag_code code,
+        const char * detail )
+{
+
+        J2_TRACE2(diag, (int)code, detail);
+
+        if(!atomic_load_explicit(&diag_hook, memory_order_relaxed)) return;
+
+        j2diag_hook hook;
+        void * data;
+        unsigned seq;
+        do {
+                seq  = atomic_load_explicit(&diag_seq, memory_order_acquire);
+                hook = atomic_load_explicit(&diag_hook, memory_order_relaxed);
+                data = atomic_load_explicit(&diag_data, memory_order_relaxed);
+                atomic_thread_fence(memory_order_acquire);
+        } while((seq & 1u) 
+             || seq != atomic_load_explicit(&diag_seq, memory_order_relaxed));
+
+        if(hook) hook(code, detail, data);
+
+}
+
+/**
+ * @fn @c j2diag_message(1)
+ * 
+ *      @brief Static message of a code.
+ * 
+ *      @returns The message or NULL for an unknown code.
+ * 
+ */
+const char *
+j2diag_message(
+        enum j2diag_code code )
+{
+
+        if((unsigned)code >= J2_DIAG_CODES) return NULL;
+        return diag_messages[code];
+
+}
+
+/**
+ * @fn @c j2diag_errno(1)
+ * 
+ *      @brief errno value the check that raised @c "code" set.
+ * 
+ *      @returns The errno value or 0 for an unknown code.
+ * 
+ */
+int
+j2diag_errno(
+        enum j2diag_code code )
+{
+
+        if((unsigned)code >= J2_DIAG_CODES) return 0;
+        return diag_errnos[code];
+
+}
@@ -0,0 +1,361 @@
+/*** LICENSE: LGPLV2. *************************************
+ *                                                        *
+ *                                                        *
+ * This file is a part of the j2 project.                 *
+ * Copyright (C) 2022 Joško Križanović                    *
+ * <jkriza02@fesb.com>                                    *
+ *                                                        *
+ * This library is free software; you can redistribute    *
+ * it and/or modify it under the terms of the GNU Lesser  *
+ * General Public License as published by the Free        *
+ * Software Foundation; either version 2.1 of the         *
+ * License, or (at your option) any later version.        *
+ *                                                        *
+ * This library is distributed in the hope that it will   *
+ * be useful,                                             *
+ * but WITHOUT ANY WARRANTY; without even the implied     *
+ * warranty of MERCHANTABILITY or FITNESS FOR A           *
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public  *
+ * License for more details.                              *
+ *                                                        *
+ * You should have received a copy of the GNU Lesser      *
+ * General Public License along with this library; if     *
+ * not, write to the Free Software Foundation, Inc.,      *
+ * 51 Franklin Street, Fifth Floor, Boston,               *
+ * MA  02110-1301  USA                                    *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: FILE, AUTHOR & DATE INFORMATION. *********
+ *                                                        *
+ *                                                        *
+ * FILE:                                                  *
+ * Open addressing hash table with integer and j2string   *
+ * keys, probed one 16 byte group of control bytes at a   *
+ * time.                                                  *
+ *                                                        *
+ *                                                        *
+ * AUTHOR:                                                *
+ *      NAME:  Joško Križanović                           *
+ *      EMAIL: jkriza02@fesb.com                          *
+ *                                                        *
+ *                                                        *
+ * DATE:                                                  *
+ * 19.10.2026.                                            *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: COMPATIBILITY. ***************************
+ *                                                        *
+ *                                                        *
+ * C:                                                     *
+ * This library is written in compliance to the limited   *
+ * functionality at the disposal of the C99 standard.     *
+ *                                                        *
+ *                                                        *
+ * POSIX:                                                 *
+ * This libraries creator has yet to inscribe the minimum *
+ * POSIX compatibilty version that this library requires. *
+ * In its absance the user of the library is free to use  *
+ * any compatibilty version of the POSIX standard that is *
+ * deemed to work through trial and error.                *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: USED NAMESPACE ***************************
+ *                                                        *
+ *                                                        *
+ * Used namespaces, ... indicates that all characters     *
+ * that come after do not belong to that namespace:       *
+ * -> j2hashtable...                                      *
+ * -> J2_HASHTABLE...                                     *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: EXTERNAL FILES CALLED & PURPOSE **********
+ *                                                        *
+ *                                                        *
+ * Name                     Description                   *
+ * ----                     -----------                   *
+ * <stdint.h>               fixed size integers           *
+ *                                                        *
+ * "../string/string.h"     j2string keys and hashing     *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: DEVELOPMENT HISTORY/VERSIONS PUBLISHED ***
+ *                                                        *
+ *                                                        *
+ * Author  Release & Date  Description of modifications   *
+ * ------  --------------  ----------------------------   *
+ * josko3  V0.0            Inital creation.               *
+ * 567     19.10.2026.                                    *
+ * ------  --------------  ----------------------------   *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "../diag/diag.h"
+
+#include "../string/string.h"
+
+#ifndef J2_HASHTABLE_INCLUDE
+#define J2_HASHTABLE_INCLUDE
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup Table shape
+ * @brief 
+ * Slots per group (one SIMD compare), the load the table grows at written 
+ * as a fraction and the value of an empty control byte. A full control
+ * byte holds the top 7 bits of the hash of its key.
+ * @{
+ */
+#define J2_HASHTABLE_GROUP      16
+#define J2_HASHTABLE_LOAD_NUM   7
+#define J2_HASHTABLE_LOAD_DEN   8
+#define J2_HASHTABLE_EMPTY      0x80
+/**
+ * @}
+ */
+
+/**
+ * @enum @c j2hashtable_key
+ * 
+ *      @brief Type of keys a table holds, fixed when it is created.
+ * 
+ */
+enum j2hashtable_key {
+
+        J2_HASHTABLE_INTEGER,
+        J2_HASHTABLE_STRING
+
+};
+
+/**
+ * @struct @c j2hashtable_slot
+ * 
+ *      @brief A key with its value, slots sit next to each other in one 
+ *      flat array.
+ * 
+ * 
+ *      @tparam @b key
+ *      @tparam @b value
+ *   
+ */
+struct j2hashtable_slot {
+
+        /**
+         * @tparam @b key
+         * An integer or a static j2string copy of the key owned by the 
+         * table, the copy keeps its hash cached.
+         */
+        union {
+                uint64_t integer;
+                j2string string;
+        } key;
+
+        /**
+         * @tparam @b value
+         * User value.
+         */
+        void * value;
+
+};
+
+/**
+ * @struct @c j2hashtable
+ * 
+ *      @brief Swiss table style map. Every slot has a control byte, 16 of
+ *      them form a group that is matched against the hash in one compare.
+ * 
+ *      Groups are probed in triangular steps. When an insert has to skip a
+ *      full group that groups @c overflow counter goes up, a lookup can 
+ *      stop at the first group that never overflowed. Deleting a key walks
+ *      its probe path again and takes the counters back down, so a 
+ *      deleted slot is simply empty and there are no tombstones.
+ * 
+ * 
+ *      @tparam @b type
+ *      @tparam @b groups
+ *      @tparam @b count
+ *      @tparam @b control
+ *      @tparam @b overflow
+ *      @tparam @b slots
+ *   
+ */
+typedef struct j2hashtable {
+
+        /**
+         * @tparam @b type
+         * What kind of keys the table holds.
+         */
+        enum j2hashtable_key type;
+
+        /**
+         * @tparam @b groups
+         * Amount of groups, always a power of 2.
+         */
+        size_t groups;
+
+        /**
+         * @tparam @b count
+         * Amount of keys inside of the table.
+         */
+        size_t count;
+
+        /**
+         * @tparam @b control
+         * One control byte per slot, @c groups * J2_HASHTABLE_GROUP of 
+         * them.
+         */
+        uint8_t * control;
+
+        /**
+         * @tparam @b overflow
+         * Per group count of keys that had to probe past it.
+         */
+        uint32_t * overflow;
+
+        /**
+         * @tparam @b slots
+         * The slots, in the same allocation as @c control and 
+         * @c overflow.
+         */
+        struct j2hashtable_slot * slots;
+
+} j2hashtable;
+
+size_t
+j2hashtable_claim(
+        j2hashtable * table,
+        uint64_t hash
+);
+
+void
+j2hashtable_release(
+        j2hashtable * table,
+        size_t index,
+        uint64_t hash
+);
+
+int
+j2hashtable_grow(
+        j2hashtable * table
+);
+
+uint64_t
+j2hashtable_hash_int(
+        uint64_t key
+);
+
+j2hashtable *
+j2hashtable_new(
+        enum j2hashtable_key type,
+        size_t reserve
+);
+
+void
+j2hashtable_free(
+        j2hashtable * table
+);
+
+int
+j2hashtable_reserve(
+        j2hashtable * table,
+        size_t count
+);
+
+void
+j2hashtable_clear(
+        j2hashtable * table
+);
+
+size_t
+j2hashtable_count(
+        const j2hashtable * table
+);
+
+struct j2hashtable_slot *
+j2hashtable_next(
+        const j2hashtable * table,
+        size_t * iterator
+);
+
+void **
+j2hashtable_int_get(
+        const j2hashtable * table,
+        uint64_t key
+);
+
+int
+j2hashtable_int_set(
+        j2hashtable * table,
+        uint64_t key,
+        void * value
+);
+
+bool
+j2hashtable_int_remove(
+        j2hashtable * table,
+        uint64_t key,
+        void ** value
+);
+
+void **
+j2hashtable_get(
+        const j2hashtable * table,
+        const_j2string key
+);
+
+void **
+j2hashtable_cget(
+        const j2hashtable * table,
+        const char * key
+);
+
+int
+j2hashtable_set(
+        j2hashtable * table,
+        const_j2string key,
+        void * value
+);
+
+int
+j2hashtable_cset(
+        j2hashtable * table,
+        const char * key,
+        void * value
+);
+
+bool
+j2hashtable_remove(
+        j2hashtable * table,
+        const_j2string key,
+        void ** value
+);
+
+bool
+j2hashtable_cremove(
+        j2hashtable * table,
+        const char * key,
+        void ** value
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /** @c J2_HASHTABLE_INCLUDE */
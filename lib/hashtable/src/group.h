@@ -0,0 +1,231 @@
+/*** LICENSE: LGPLV2. *************************************
+ *                                                        *
+ *                                                        *
+ * This file is a part of the j2 project.                 *
+ * Copyright (C) 2022 Joško Križanović                    *
+ * <jkriza02@fesb.com>                                    *
+ *                                                        *
+ * This library is free software; you can redistribute    *
+ * it and/or modify it under the terms of the GNU Lesser  *
+ * General Public License as published by the Free        *
+ * Software Foundation; either version 2.1 of the         *
+ * License, or (at your option) any later version.        *
+ *                                                        *
+ * This library is distributed in the hope that it will   *
+ * be useful,                                             *
+ * but WITHOUT ANY WARRANTY; without even the implied     *
+ * warranty of MERCHANTABILITY or FITNESS FOR A           *
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public  *
+ * License for more details.                              *
+ *                                                        *
+ * You should have received a copy of the GNU Lesser      *
+ * General Public License along with this library; if     *
+ * not, write to the Free Software Foundation, Inc.,      *
+ * 51 Franklin Street, Fifth Floor, Boston,               *
+ * MA  02110-1301  USA                                    *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: FILE, AUTHOR & DATE INFORMATION. *********
+ *                                                        *
+ *                                                        *
+ * FILE:                                                  *
+ * Matching a group of 16 control bytes at once with      *
+ * SSE2, NEON or plain 64 bit words.                      *
+ *                                                        *
+ *                                                        *
+ * AUTHOR:                                                *
+ *      NAME:  Joško Križanović                           *
+ *      EMAIL: jkriza02@fesb.com                          *
+ *                                                        *
+ *                                                        *
+ * DATE:                                                  *
+ * 19.10.2026.                                            *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+#include "../hashtable.h"
+
+#ifndef J2_HASHTABLE_GROUP_INCLUDE
+#define J2_HASHTABLE_GROUP_INCLUDE
+
+/**
+ * @brief 
+ * Define J2_HASHTABLE_NO_SIMD to always use the plain 64 bit word version.
+ */
+#if defined(__SSE2__) && !defined(J2_HASHTABLE_NO_SIMD)
+#define J2_HASHTABLE_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__) \
+   && !defined(J2_HASHTABLE_NO_SIMD)
+#define J2_HASHTABLE_NEON
+#include <arm_neon.h>
+#else
+#include <string.h>
+#endif
+
+/**
+ * @brief 
+ * Bit i of a group mask is set when slot i of the group matches.
+ */
+typedef uint32_t group_mask;
+
+/**
+ * @brief 
+ * Top 7 bits of the hash go into the control byte, the rest picks the 
+ * home group.
+ */
+#define GROUP_H2(hash) ((uint8_t)((hash) >> 57))
+
+#if !defined(J2_HASHTABLE_SSE2) && !defined(J2_HASHTABLE_NEON)
+
+/**
+ * Gather the top bit of every byte of @c "word" into the low 8 bits.
+ */
+static inline group_mask
+group_gather(
+        uint64_t word )
+{
+        return (group_mask)(((word >> 7) * 0x0102040810204080ULL) >> 56);
+}
+
+static inline uint64_t
+group_word(
+        const uint8_t * control )
+{
+        uint64_t word;
+        memcpy(&word, control, sizeof(word));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        word = __builtin_bswap64(word);
+#endif
+        return word;
+}
+
+/**
+ * Bytes of @c "word" equal to @c "byte", may also flag a byte right above 
+ * a real match which the key compare sorts out.
+ */
+static inline uint64_t
+group_word_match(
+        uint64_t word,
+        uint8_t byte )
+{
+        uint64_t x = word ^ (0x0101010101010101ULL * byte);
+        return (x - 0x0101010101010101ULL) & ~x & 0x8080808080808080ULL;
+}
+
+#endif
+
+/**
+ * @brief 
+ * Slots of the group at @c "control" whose control byte is @c "h2".
+ */
+static inline group_mask
+group_match(
+        const uint8_t * control,
+        uint8_t h2 )
+{
+
+#if defined(J2_HASHTABLE_SSE2)
+        __m128i group = _mm_loadu_si128((const __m128i *)control);
+        return (group_mask)_mm_movemask_epi8(
+                _mm_cmpeq_epi8(group, _mm_set1_epi8((char)h2))
+        );
+#elif defined(J2_HASHTABLE_NEON)
+        static const uint8_t weight[16] = {
+                1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128
+        };
+        uint8x16_t bits = vandq_u8(
+                vceqq_u8(vld1q_u8(control), vdupq_n_u8(h2)), 
+                vld1q_u8(weight)
+        );
+        return (group_mask)vaddv_u8(vget_low_u8(bits))
+             | (group_mask)vaddv_u8(vget_high_u8(bits)) << 8;
+#else
+        return group_gather(group_word_match(group_word(control), h2))
+             | group_gather(group_word_match(group_word(control + 8), h2)) 
+             << 8;
+#endif
+
+}
+
+/**
+ * @brief 
+ * Empty slots of the group at @c "control", the only control byte with the
+ * top bit set is J2_HASHTABLE_EMPTY.
+ */
+static inline group_mask
+group_empty(
+        const uint8_t * control )
+{
+
+#if defined(J2_HASHTABLE_SSE2)
+        return (group_mask)_mm_movemask_epi8(
+                _mm_loadu_si128((const __m128i *)control)
+        );
+#elif defined(J2_HASHTABLE_NEON)
+        static const uint8_t weight[16] = {
+                1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128
+        };
+        uint8x16_t bits = vandq_u8(
+                vcltq_s8(vreinterpretq_s8_u8(vld1q_u8(control)), 
+                         vdupq_n_s8(0)), 
+                vld1q_u8(weight)
+        );
+        return (group_mask)vaddv_u8(vget_low_u8(bits))
+             | (group_mask)vaddv_u8(vget_high_u8(bits)) << 8;
+#else
+        return group_gather(group_word(control) & 0x8080808080808080ULL)
+             | group_gather(group_word(control + 8) & 0x8080808080808080ULL)
+             << 8;
+#endif
+
+}
+
+/**
+ * @brief 
+ * Index of the lowest set bit of a non zero mask.
+ */
+static inline unsigned
+group_first(
+        group_mask mask )
+{
+        return (unsigned)__builtin_ctz(mask);
+}
+
+/**
+ * @brief 
+ * Walks the groups a hash probes, home group first and then in triangular
+ * steps which visit every group once when their amount is a power of 2.
+ */
+struct group_probe {
+
+        size_t group;
+        size_t step;
+        size_t mask;
+
+};
+
+static inline struct group_probe
+group_probe_start(
+        const j2hashtable * table,
+        uint64_t hash )
+{
+        return (struct group_probe){
+                .group = (size_t)hash & (table->groups - 1),
+                .step  = 0,
+                .mask  = table->groups - 1
+        };
+}
+
+static inline void
+group_probe_next(
+        struct group_probe * probe )
+{
+        probe->step  += 1;
+        probe->group  = (probe->group + probe->step) & probe->mask;
+}
+
+#endif /** @c J2_HASHTABLE_GROUP_INCLUDE */
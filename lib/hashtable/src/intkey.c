@@ -0,0 +1,209 @@
+/*** LICENSE: LGPLV2. *************************************
+ *                                                        *
+ *                                                        *
+ * This file is a part of the j2 project.                 *
+ * Copyright (C) 2022 Joško Križanović                    *
+ * <jkriza02@fesb.com>                                    *
+ *                                                        *
+ * This library is free software; you can redistribute    *
+ * it and/or modify it under the terms of the GNU Lesser  *
+ * General Public License as published by the Free        *
+ * Software Foundation; either version 2.1 of the         *
+ * License, or (at your option) any later version.        *
+ *                                                        *
+ * This library is distributed in the hope that it will   *
+ * be useful,                                             *
+ * but WITHOUT ANY WARRANTY; without even the implied     *
+ * warranty of MERCHANTABILITY or FITNESS FOR A           *
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public  *
+ * License for more details.                              *
+ *                                                        *
+ * You should have received a copy of the GNU Lesser      *
+ * General Public License along with this library; if     *
+ * not, write to the Free Software Foundation, Inc.,      *
+ * 51 Franklin Street, Fifth Floor, Boston,               *
+ * MA  02110-1301  USA                                    *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: FILE, AUTHOR & DATE INFORMATION. *********
+ *                                                        *
+ *                                                        *
+ * FILE:                                                  *
+ * Hash table operations for integer keys.                *
+ *                                                        *
+ *                                                        *
+ * AUTHOR:                                                *
+ *      NAME:  Joško Križanović                           *
+ *      EMAIL: jkriza02@fesb.com                          *
+ *                                                        *
+ *                                                        *
+ * DATE:                                                  *
+ * 19.10.2026.                                            *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+#include "../hashtable.h"
+#include "group.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <errno.h>
+
+#ifdef __J2_DEV__
+#define INTKEY_CHECK(table, function, fail)                                    \
+        if(!(table) || (table)->type != J2_HASHTABLE_INTEGER) {                \
+                errno = EINVAL;                                                \
+                J2_DIAG(J2_DIAG_INVALID,                                       \
+                        function "() parameter table is a"                     \
+                        " NULL ptr or doesn't hold integer keys.");            \
+                return fail;                                                   \
+        }
+#else
+#define INTKEY_CHECK(table, function, fail)
+#endif
+
+/**
+ * @brief 
+ * Index of the slot holding @c "key" or SIZE_MAX.
+ */
+static inline size_t
+intkey_find(
+        const j2hashtable * table,
+        uint64_t key,
+        uint64_t hash )
+{
+
+        struct group_probe probe = group_probe_start(table, hash);
+        uint8_t h2 = GROUP_H2(hash);
+
+        for(size_t visited = 0; visited < table->groups; visited++) {
+
+                size_t base = probe.group * J2_HASHTABLE_GROUP;
+                group_mask match = group_match(table->control + base, h2);
+
+                while(match) {
+                        size_t index = base + group_first(match);
+                        if(table->slots[index].key.integer == key) 
+                                return index;
+                        match &= match - 1;
+                }
+
+                if(!table->overflow[probe.group]) break;
+                group_probe_next(&probe);
+
+        }
+
+        return SIZE_MAX;
+
+}
+
+/**
+ * @fn @c j2hashtable_int_get(2)
+ * 
+ *      @brief Look up the integer @c "key".
+ * 
+ * 
+ *      @throw @a EINVAL - If @c "table" is a NULL ptr or doesn't hold 
+ *                         integer keys.
+ * 
+ * 
+ *      @returns Pointer to the value of @c "key" which can be changed in 
+ *      place until the next insert, or NULL if it isn't inside.
+ * 
+ */
+void **
+j2hashtable_int_get(
+        const j2hashtable * table,
+        uint64_t key )
+{
+
+        INTKEY_CHECK(table, "j2hashtable_int_get", NULL);
+
+        size_t index = intkey_find(table, key, j2hashtable_hash_int(key));
+
+        return index == SIZE_MAX ? NULL : &table->slots[index].value;
+
+}
+
+/**
+ * @fn @c j2hashtable_int_set(3)
+ * 
+ *      @brief Set the value of the integer @c "key", adding it if it isn't
+ *      inside yet.
+ * 
+ * 
+ *      @throw @a EINVAL - If @c "table" is a NULL ptr or doesn't hold 
+ *                         integer keys.
+ *      @throw @a ENOMEM - Growing the table failed, it stays as it was.
+ * 
+ * 
+ *      @returns 1 if @c "key" was added, 0 if its value was replaced and 
+ *      -1 on failure.
+ * 
+ */
+int
+j2hashtable_int_set(
+        j2hashtable * table,
+        uint64_t key,
+        void * value )
+{
+
+        INTKEY_CHECK(table, "j2hashtable_int_set", -1);
+
+        uint64_t hash  = j2hashtable_hash_int(key);
+        size_t   index = intkey_find(table, key, hash);
+
+        if(index != SIZE_MAX) {
+                table->slots[index].value = value;
+                return 0;
+        }
+
+        if(j2hashtable_grow(table)) return -1;
+
+        index = j2hashtable_claim(table, hash);
+        table->slots[index].key.integer = key;
+        table->slots[index].value       = value;
+
+        return 1;
+
+}
+
+/**
+ * @fn @c j2hashtable_int_remove(3)
+ * 
+ *      @brief Remove the integer @c "key".
+ * 
+ * 
+ *      @param @b value
+ *             If not NULL the removed value is stored here.
+ * 
+ * 
+ *      @throw @a EINVAL - If @c "table" is a NULL ptr or doesn't hold 
+ *                         integer keys.
+ * 
+ * 
+ *      @returns true if @c "key" was inside.
+ * 
+ */
+bool
+j2hashtable_int_remove(
+        j2hashtable * table,
+        uint64_t key,
+        void ** value )
+{
+
+        INTKEY_CHECK(table, "j2hashtable_int_remove", false);
+
+        uint64_t hash  = j2hashtable_hash_int(key);
+        size_t   index = intkey_find(table, key, hash);
+
+        if(index == SIZE_MAX) return false;
+
+        if(value) (*value) = table->slots[index].value;
+        j2hashtable_release(table, index, hash);
+
+        return true;
+
+}
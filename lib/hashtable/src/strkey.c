@@ -0,0 +1,358 @@
+/*** LICENSE: LGPLV2. *************************************
+ *                                                        *
+ *                                                        *
+ * This file is a part of the j2 project.                 *
+ * Copyright (C) 2022 Joško Križanović                    *
+ * <jkriza02@fesb.com>                                    *
+ *                                                        *
+ * This library is free software; you can redistribute    *
+ * it and/or modify it under the terms of the GNU Lesser  *
+ * General Public License as published by the Free        *
+ * Software Foundation; either version 2.1 of the         *
+ * License, or (at your option) any later version.        *
+ *                                                        *
+ * This library is distributed in the hope that it will   *
+ * be useful,                                             *
+ * but WITHOUT ANY WARRANTY; without even the implied     *
+ * warranty of MERCHANTABILITY or FITNESS FOR A           *
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public  *
+ * License for more details.                              *
+ *                                                        *
+ * You should have received a copy of the GNU Lesser      *
+ * General Public License along with this library; if     *
+ * not, write to the Free Software Foundation, Inc.,      *
+ * 51 Franklin Street, Fifth Floor, Boston,               *
+ * MA  02110-1301  USA                                    *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: FILE, AUTHOR & DATE INFORMATION. *********
+ *                                                        *
+ *                                                        *
+ * FILE:                                                  *
+ * Hash table operations for j2string and C string keys.  *
+ *                                                        *
+ *                                                        *
+ * AUTHOR:                                                *
+ *      NAME:  Joško Križanović                           *
+ *      EMAIL: jkriza02@fesb.com                          *
+ *                                                        *
+ *                                                        *
+ * DATE:                                                  *
+ * 19.10.2026.                                            *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+#include "../hashtable.h"
+#include "group.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#ifdef __J2_DEV__
+#define STRKEY_CHECK(table, key, function, fail)                               \
+        if(!(table) || !(key) || (table)->type != J2_HASHTABLE_STRING) {       \
+                errno = EINVAL;                                                \
+                J2_DIAG(J2_DIAG_INVALID,                                       \
+                        function "() parameter table/key is"                   \
+                        " a NULL ptr or table doesn't hold string"             \
+                        " keys.");                                             \
+                return fail;                                                   \
+        }
+#else
+#define STRKEY_CHECK(table, key, function, fail)
+#endif
+
+/**
+ * @brief 
+ * Index of the slot holding the @c "bytes" bytes of @c "key" or SIZE_MAX.
+ */
+static inline size_t
+strkey_find(
+        const j2hashtable * table,
+        const char * key,
+        size_t bytes,
+        uint64_t hash )
+{
+
+        struct group_probe probe = group_probe_start(table, hash);
+        uint8_t h2 = GROUP_H2(hash);
+
+        for(size_t visited = 0; visited < table->groups; visited++) {
+
+                size_t base = probe.group * J2_HASHTABLE_GROUP;
+                group_mask match = group_match(table->control + base, h2);
+
+                while(match) {
+                        size_t index = base + group_first(match);
+                        const j2string candidate = 
+                                table->slots[index].key.string;
+                        const struct j2string_st * info = 
+                                J2_STRING_INFO(candidate);
+                        if(info->hash   == hash 
+                        && info->filled == bytes
+                        && !memcmp(candidate, key, bytes))
+                                return index;
+                        match &= match - 1;
+                }
+
+                if(!table->overflow[probe.group]) break;
+                group_probe_next(&probe);
+
+        }
+
+        return SIZE_MAX;
+
+}
+
+/**
+ * @brief 
+ * Set the value of @c "key", the table keeps its own static j2string copy
+ * of new keys with the hash already cached.
+ */
+static int
+strkey_set(
+        j2hashtable * table,
+        const char * key,
+        size_t bytes,
+        size_t length,
+        uint64_t hash,
+        void * value )
+{
+
+        size_t index = strkey_find(table, key, bytes, hash);
+
+        if(index != SIZE_MAX) {
+                table->slots[index].value = value;
+                return 0;
+        }
+
+        j2string copy = j2string_allocate((j2string_param){
+                .allocate = bytes + 1,
+                .padding  = 0,
+                .max      = bytes + 1
+        });
+        if(!copy) {
+                errno = ENOMEM;
+                return -1;
+        }
+
+        if(j2hashtable_grow(table)) {
+                j2string_free(copy);
+                return -1;
+        }
+
+        memcpy(copy, key, bytes);
+        copy[bytes] = '\0';
+
+        struct j2string_st * info = J2_STRING_INFO(copy);
+        info->filled = bytes;
+        info->length = length != SIZE_MAX ? length 
+                     : bytes ? j2string_utf8_strlen_sn(key, bytes, NULL) 
+                     : 0;
+        info->hash   = hash;
+
+        index = j2hashtable_claim(table, hash);
+        table->slots[index].key.string = copy;
+        table->slots[index].value      = value;
+
+        return 1;
+
+}
+
+/**
+ * @brief 
+ * Remove @c "key", storing its value into @c "(*value)" if asked.
+ */
+static bool
+strkey_remove(
+        j2hashtable * table,
+        const char * key,
+        size_t bytes,
+        uint64_t hash,
+        void ** value )
+{
+
+        size_t index = strkey_find(table, key, bytes, hash);
+        if(index == SIZE_MAX) return false;
+
+        if(value) (*value) = table->slots[index].value;
+        j2string_free(table->slots[index].key.string);
+        j2hashtable_release(table, index, hash);
+
+        return true;
+
+}
+
+/**
+ * @fn @c j2hashtable_get(2)
+ * 
+ *      @brief Look up the j2string @c "key", its hash is taken from (or 
+ *      cached into) its header so looking up the same key again doesn't
+ *      rehash it.
+ * 
+ * 
+ *      @throw @a EINVAL - If @c "table" or @c "key" are NULL ptrs or the
+ *                         table doesn't hold string keys.
+ * 
+ * 
+ *      @returns Pointer to the value of @c "key" which can be changed in 
+ *      place until the next insert, or NULL if it isn't inside.
+ * 
+ */
+void **
+j2hashtable_get(
+        const j2hashtable * table,
+        const_j2string key )
+{
+
+        STRKEY_CHECK(table, key, "j2hashtable_get", NULL);
+
+        size_t index = strkey_find(
+                table, key, J2_STRING_INFO(key)->filled, j2string_hash(key)
+        );
+
+        return index == SIZE_MAX ? NULL : &table->slots[index].value;
+
+}
+
+/**
+ * @fn @c j2hashtable_cget(2)
+ * 
+ *      @brief Same as @c j2hashtable_get(2) but for a C string key.
+ * 
+ */
+void **
+j2hashtable_cget(
+        const j2hashtable * table,
+        const char * key )
+{
+
+        STRKEY_CHECK(table, key, "j2hashtable_cget", NULL);
+
+        size_t bytes = strlen(key);
+        size_t index = strkey_find(
+                table, key, bytes, j2string_chash_sn(key, bytes)
+        );
+
+        return index == SIZE_MAX ? NULL : &table->slots[index].value;
+
+}
+
+/**
+ * @fn @c j2hashtable_set(3)
+ * 
+ *      @brief Set the value of the j2string @c "key", adding a copy of it 
+ *      if it isn't inside yet.
+ * 
+ * 
+ *      @throw @a EINVAL - If @c "table" or @c "key" are NULL ptrs or the
+ *                         table doesn't hold string keys.
+ *      @throw @a ENOMEM - Exhausted all memory spaces, the table stays as
+ *                         it was.
+ * 
+ * 
+ *      @returns 1 if @c "key" was added, 0 if its value was replaced and 
+ *      -1 on failure.
+ * 
+ */
+int
+j2hashtable_set(
+        j2hashtable * table,
+        const_j2string key,
+        void * value )
+{
+
+        STRKEY_CHECK(table, key, "j2hashtable_set", -1);
+
+        const struct j2string_st * info = J2_STRING_INFO(key);
+
+        return strkey_set(
+                table, key, info->filled, info->length, 
+                j2string_hash(key), value
+        );
+
+}
+
+/**
+ * @fn @c j2hashtable_cset(3)
+ * 
+ *      @brief Same as @c j2hashtable_set(3) but for a C string key.
+ * 
+ */
+int
+j2hashtable_cset(
+        j2hashtable * table,
+        const char * key,
+        void * value )
+{
+
+        STRKEY_CHECK(table, key, "j2hashtable_cset", -1);
+
+        size_t bytes = strlen(key);
+
+        return strkey_set(
+                table, key, bytes, SIZE_MAX,
+                j2string_chash_sn(key, bytes), value
+        );
+
+}
+
+/**
+ * @fn @c j2hashtable_remove(3)
+ * 
+ *      @brief Remove the j2string @c "key" and free the tables copy of it.
+ * 
+ * 
+ *      @param @b value
+ *             If not NULL the removed value is stored here.
+ * 
+ * 
+ *      @throw @a EINVAL - If @c "table" or @c "key" are NULL ptrs or the
+ *                         table doesn't hold string keys.
+ * 
+ * 
+ *      @returns true if @c "key" was inside.
+ * 
+ */
+bool
+j2hashtable_remove(
+        j2hashtable * table,
+        const_j2string key,
+        void ** value )
+{
+
+        STRKEY_CHECK(table, key, "j2hashtable_remove", false);
+
+        return strkey_remove(
+                table, key, J2_STRING_INFO(key)->filled, 
+                j2string_hash(key), value
+        );
+
+}
+
+/**
+ * @fn @c j2hashtable_cremove(3)
+ * 
+ *      @brief Same as @c j2hashtable_remove(3) but for a C string key.
+ * 
+ */
+bool
+j2hashtable_cremove(
+        j2hashtable * table,
+        const char * key,
+        void ** value )
+{
+
+        STRKEY_CHECK(table, key, "j2hashtable_cremove", false);
+
+        size_t bytes = strlen(key);
+
+        return strkey_remove(
+                table, key, bytes, j2string_chash_sn(key, bytes), value
+        );
+
+}
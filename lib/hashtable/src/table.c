@@ -0,0 +1,464 @@
+/*** LICENSE: LGPLV2. *************************************
+ *                                                        *
+ *                                                        *
+ * This file is a part of the j2 project.                 *
+ * Copyright (C) 2022 Joško Križanović                    *
+ * <jkriza02@fesb.com>                                    *
+ *                                                        *
+ * This library is free software; you can redistribute    *
+ * it and/or modify it under the terms of the GNU Lesser  *
+ * General Public License as published by the Free        *
+ * Software Foundation; either version 2.1 of the         *
+ * License, or (at your option) any later version.        *
+ *                                                        *
+ * This library is distributed in the hope that it will   *
+ * be useful,                                             *
+ * but WITHOUT ANY WARRANTY; without even the implied     *
+ * warranty of MERCHANTABILITY or FITNESS FOR A           *
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public  *
+ * License for more details.                              *
+ *                                                        *
+ * You should have received a copy of the GNU Lesser      *
+ * General Public License along with this library; if     *
+ * not, write to the Free Software Foundation, Inc.,      *
+ * 51 Franklin Street, Fifth Floor, Boston,               *
+ * MA  02110-1301  USA                                    *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: FILE, AUTHOR & DATE INFORMATION. *********
+ *                                                        *
+ *                                                        *
+ * FILE:                                                  *
+ * Creating, growing and walking hash tables, claiming    *
+ * and releasing slots without tombstones.                *
+ *                                                        *
+ *                                                        *
+ * AUTHOR:                                                *
+ *      NAME:  Joško Križanović                           *
+ *      EMAIL: jkriza02@fesb.com                          *
+ *                                                        *
+ *                                                        *
+ * DATE:                                                  *
+ * 19.10.2026.                                            *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+#include "../hashtable.h"
+#include "group.h"
+#include "../../stats/stats.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+/**
+ * @brief 
+ * Allocate the control bytes, overflow counters and slots of @c "groups" 
+ * groups in one block and store them into @c "table".
+ */
+static int
+table_allocate(
+        j2hashtable * table,
+        size_t groups )
+{
+
+        size_t capacity  = groups * J2_HASHTABLE_GROUP;
+        size_t overflow  = (groups * sizeof(uint32_t) + 15) & ~(size_t)15;
+        size_t slots     = capacity * sizeof(struct j2hashtable_slot);
+
+        /// Slots come after the control bytes and counters, both are 
+        /// padded to 16 bytes so the slots stay aligned.
+        uint8_t * block = malloc(capacity + overflow + slots);
+        if(!block) {
+                errno = ENOMEM;
+                return -1;
+        }
+
+        memset(block, J2_HASHTABLE_EMPTY, capacity);
+        memset(block + capacity, 0, overflow);
+
+        table->groups   = groups;
+        table->control  = block;
+        table->overflow = (uint32_t *)(block + capacity);
+        table->slots    = (struct j2hashtable_slot *)
+                          (block + capacity + overflow);
+
+        return 0;
+
+}
+
+/**
+ * @brief 
+ * Hash of the key inside of slot @c "index".
+ */
+static inline uint64_t
+table_hash_at(
+        const j2hashtable * table,
+        size_t index )
+{
+        return table->type == J2_HASHTABLE_STRING ?
+                j2string_hash(table->slots[index].key.string) :
+                j2hashtable_hash_int(table->slots[index].key.integer);
+}
+
+/**
+ * @brief 
+ * Move every key into a new block of @c "groups" groups.
+ */
+static int
+table_rehash(
+        j2hashtable * table,
+        size_t groups )
+{
+
+        j2hashtable old = (*table);
+
+        if(table_allocate(table, groups)) {
+                (*table) = old;
+                return -1;
+        }
+
+        table->count = 0;
+
+        size_t capacity = old.groups * J2_HASHTABLE_GROUP;
+        for(size_t i = 0; i < capacity; i++) {
+                if(old.control[i] & J2_HASHTABLE_EMPTY) continue;
+                uint64_t hash  = table_hash_at(&old, i);
+                size_t   index = j2hashtable_claim(table, hash);
+                table->slots[index] = old.slots[i];
+        }
+
+        free(old.control);
+
+        J2_STATS_ADD(groups > old.groups ? J2_STATS_GROW : J2_STATS_SHRINK, 1);
+        J2_TRACE2(hashtable_rehash, old.groups, groups);
+
+        return 0;
+
+}
+
+/**
+ * @brief 
+ * Smallest power of 2 amount of groups that holds @c "count" keys under 
+ * the maximum load.
+ */
+static size_t
+table_groups_for(
+        size_t count )
+{
+
+        size_t slots  = (count * J2_HASHTABLE_LOAD_DEN + J2_HASHTABLE_LOAD_NUM
+                      - 1) / J2_HASHTABLE_LOAD_NUM;
+        size_t groups = 1;
+        while(groups * J2_HASHTABLE_GROUP < slots) groups <<= 1;
+
+        return groups;
+
+}
+
+/**
+ * @fn @c j2hashtable_hash_int(1)
+ * 
+ *      @brief Mix an integer key so that all of its bits reach both the 
+ *      home group and the control byte.
+ * 
+ */
+uint64_t
+j2hashtable_hash_int(
+        uint64_t key )
+{
+
+        key ^= key >> 33;
+        key *= 0xFF51AFD7ED558CCDULL;
+        key ^= key >> 33;
+        key *= 0xC4CEB9FE1A85EC53ULL;
+        key ^= key >> 33;
+
+        return key;
+
+}
+
+/**
+ * @fn @c j2hashtable_claim(2)
+ * 
+ *      @brief Take the first empty slot on the probe path of @c "hash" and
+ *      write its control byte, every full group skipped on the way has its
+ *      overflow counter raised. The caller makes sure there is room and 
+ *      fills the slot.
+ * 
+ * 
+ *      @returns Index of the claimed slot.
+ * 
+ */
+size_t
+j2hashtable_claim(
+        j2hashtable * table,
+        uint64_t hash )
+{
+
+        struct group_probe probe = group_probe_start(table, hash);
+
+        while(1) {
+
+                const uint8_t * control = table->control 
+                                        + probe.group * J2_HASHTABLE_GROUP;
+                group_mask empty = group_empty(control);
+
+                if(empty) {
+                        size_t index = probe.group * J2_HASHTABLE_GROUP 
+                                     + group_first(empty);
+                        table->control[index] = GROUP_H2(hash);
+                        table->count++;
+                        return index;
+                }
+
+                table->overflow[probe.group]++;
+                group_probe_next(&probe);
+
+        }
+
+}
+
+/**
+ * @fn @c j2hashtable_release(3)
+ * 
+ *      @brief Empty slot @c "index" whose key hashed to @c "hash" and take
+ *      back the overflow counters its insert raised. The caller frees the
+ *      key first.
+ * 
+ */
+void
+j2hashtable_release(
+        j2hashtable * table,
+        size_t index,
+        uint64_t hash )
+{
+
+        size_t home = index / J2_HASHTABLE_GROUP;
+        struct group_probe probe = group_probe_start(table, hash);
+
+        while(probe.group != home) {
+                table->overflow[probe.group]--;
+                group_probe_next(&probe);
+        }
+
+        table->control[index] = J2_HASHTABLE_EMPTY;
+        table->count--;
+
+}
+
+/**
+ * @fn @c j2hashtable_new(2)
+ * 
+ *      @brief Create an empty hash table.
+ * 
+ * 
+ *      @param @b type
+ *             J2_HASHTABLE_INTEGER for @c uint64_t keys or 
+ *             J2_HASHTABLE_STRING for j2string keys.
+ * 
+ *      @param @b reserve
+ *             Amount of keys the table fits before it first grows, 0 for
+ *             the smallest table.
+ * 
+ * 
+ *      @throw @a ENOMEM - Exhausted all memory spaces.
+ * 
+ * 
+ *      @returns The new table or NULL on failure.
+ * 
+ */
+j2hashtable *
+j2hashtable_new(
+        enum j2hashtable_key type,
+        size_t reserve )
+{
+
+        j2hashtable * table = malloc(sizeof(j2hashtable));
+        if(!table) {
+                errno = ENOMEM;
+                return NULL;
+        }
+
+        table->type  = type;
+        table->count = 0;
+
+        if(table_allocate(table, table_groups_for(reserve))) {
+                free(table);
+                return NULL;
+        }
+
+        return table;
+
+}
+
+/**
+ * @fn @c j2hashtable_free(1)
+ * 
+ *      @brief Free the table and the copies of its j2string keys, values
+ *      are left to the user.
+ * 
+ */
+void
+j2hashtable_free(
+        j2hashtable * table )
+{
+
+        if(!table) return;
+
+        j2hashtable_clear(table);
+        free(table->control);
+        free(table);
+
+}
+
+/**
+ * @fn @c j2hashtable_reserve(2)
+ * 
+ *      @brief Grow @c "table" so that it fits @c "count" keys without 
+ *      growing again, never shrinks it.
+ * 
+ * 
+ *      @throw @a EINVAL - If @c "table" is a NULL ptr.
+ *      @throw @a ENOMEM - Exhausted all memory spaces, the table stays as
+ *                         it was.
+ * 
+ * 
+ *      @returns 0 on success, -1 on failure.
+ * 
+ */
+int
+j2hashtable_reserve(
+        j2hashtable * table,
+        size_t count )
+{
+
+#ifdef __J2_DEV__
+        if(!table) {
+                errno = EINVAL;
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2hashtable_reserve() /"
+                        " j2.hashtable.reserve() parameter"
+                        " table is a NULL ptr.");
+                return -1;
+        }
+#endif
+
+        size_t groups = table_groups_for(count);
+        if(groups <= table->groups) return 0;
+
+        return table_rehash(table, groups);
+
+}
+
+/**
+ * @fn @c j2hashtable_grow(1)
+ * 
+ *      @brief Make room for one more key, doubling the table once it would
+ *      pass the maximum load.
+ * 
+ *      @returns 0 on success, -1 on failure.
+ * 
+ */
+int
+j2hashtable_grow(
+        j2hashtable * table )
+{
+
+        size_t capacity = table->groups * J2_HASHTABLE_GROUP;
+        if((table->count + 1) * J2_HASHTABLE_LOAD_DEN 
+                <= capacity * J2_HASHTABLE_LOAD_NUM)
+                return 0;
+
+        return table_rehash(table, table->groups * 2);
+
+}
+
+/**
+ * @fn @c j2hashtable_clear(1)
+ * 
+ *      @brief Remove every key but keep the memory of the table.
+ * 
+ */
+void
+j2hashtable_clear(
+        j2hashtable * table )
+{
+
+        if(!table) return;
+
+        size_t capacity = table->groups * J2_HASHTABLE_GROUP;
+
+        if(table->type == J2_HASHTABLE_STRING) 
+                for(size_t i = 0; i < capacity; i++) 
+                        if(!(table->control[i] & J2_HASHTABLE_EMPTY))
+                                j2string_free(table->slots[i].key.string);
+
+        memset(table->control, J2_HASHTABLE_EMPTY, capacity);
+        memset(table->overflow, 0, table->groups * sizeof(uint32_t));
+        table->count = 0;
+
+}
+
+/**
+ * @fn @c j2hashtable_count(1)
+ * 
+ *      @returns Amount of keys inside of @c "table".
+ * 
+ */
+size_t
+j2hashtable_count(
+        const j2hashtable * table )
+{
+        return table ? table->count : 0;
+}
+
+/**
+ * @fn @c j2hashtable_next(2)
+ * 
+ *      @brief Walk every key of @c "table" in no particular order, skipping
+ *      a whole empty group at a time.
+ * 
+ * 
+ *      @param @b table
+ *             The table to walk, it must not be changed during the walk 
+ *             except for the values.
+ * 
+ *      @param @b iterator
+ *             Set it to 0 before the first call.
+ * 
+ * 
+ *      @returns The next slot or NULL at the end.
+ * 
+ */
+struct j2hashtable_slot *
+j2hashtable_next(
+        const j2hashtable * table,
+        size_t * iterator )
+{
+
+        size_t capacity = table->groups * J2_HASHTABLE_GROUP;
+
+        while((*iterator) < capacity) {
+
+                size_t     base = (*iterator) & ~(size_t)(J2_HASHTABLE_GROUP-1);
+                group_mask full = ~group_empty(table->control + base) 
+                                & 0xFFFF;
+                full &= (group_mask)0xFFFF << ((*iterator) - base);
+
+                if(full) {
+                        size_t index = base + group_first(full);
+                        (*iterator) = index + 1;
+                        return &table->slots[index];
+                }
+
+                (*iterator) = base + J2_HASHTABLE_GROUP;
+
+        }
+
+        return NULL;
+
+}
@@ -0,0 +1,582 @@
+/*** LICENSE: LGPLV2. *************************************
+ *                                                        *
+ *                                                        *
+ * This file is a part of the j2 project.                 *
+ * Copyright (C) 2022 Joško Križanović                    *
+ * <jkriza02@fesb.com>                                    *
+ *                                                        *
+ * This library is free software; you can redistribute    *
+ * it and/or modify it under the terms of the GNU Lesser  *
+ * General Public License as published by the Free        *
+ * Software Foundation; either version 2.1 of the         *
+ * License, or (at your option) any later version.        *
+ *                                                        *
+ * This library is distributed in the hope that it will   *
+ * be useful,                                             *
+ * but WITHOUT ANY WARRANTY; without even the implied     *
+ * warranty of MERCHANTABILITY or FITNESS FOR A           *
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public  *
+ * License for more details.                              *
+ *                                                        *
+ * You should have received a copy of the GNU Lesser      *
+ * General Public License along with this library; if     *
+ * not, write to the Free Software Foundation, Inc.,      *
+ * 51 Franklin Street, Fifth Floor, Boston,               *
+ * MA  02110-1301  USA                                    *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: FILE, AUTHOR & DATE INFORMATION. *********
+ *                                                        *
+ *                                                        *
+ * FILE:                                                  *
+ * Intrusive singly and doubly linked lists with links    *
+ * embedded inside of user structs, and a pool of fixed   *
+ * size nodes for lists that hold plain values.           *
+ *                                                        *
+ *                                                        *
+ * AUTHOR:                                                *
+ *      NAME:  Joško Križanović                           *
+ *      EMAIL: jkriza02@fesb.com                          *
+ *                                                        *
+ *                                                        *
+ * DATE:                                                  *
+ * 19.10.2026.                                            *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: COMPATIBILITY. ***************************
+ *                                                        *
+ *                                                        *
+ * C:                                                     *
+ * This library is written in compliance to the limited   *
+ * functionality at the disposal of the C99 standard.     *
+ *                                                        *
+ *                                                        *
+ * POSIX:                                                 *
+ * This libraries creator has yet to inscribe the minimum *
+ * POSIX compatibilty version that this library requires. *
+ * In its absance the user of the library is free to use  *
+ * any compatibilty version of the POSIX standard that is *
+ * deemed to work through trial and error.                *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: USED NAMESPACE ***************************
+ *                                                        *
+ *                                                        *
+ * Used namespaces, ... indicates that all characters     *
+ * that come after do not belong to that namespace:       *
+ * -> j2slist...                                          *
+ * -> j2dlist...                                          *
+ * -> j2list...                                           *
+ * -> J2_LIST...                                          *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: EXTERNAL FILES CALLED & PURPOSE **********
+ *                                                        *
+ *                                                        *
+ * Name                     Description                   *
+ * ----                     -----------                   *
+ * <stddef.h>               offsetof                      *
+ *                                                        *
+ * <stdbool.h>              booleans                      *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: DEVELOPMENT HISTORY/VERSIONS PUBLISHED ***
+ *                                                        *
+ *                                                        *
+ * Author  Release & Date  Description of modifications   *
+ * ------  --------------  ----------------------------   *
+ * josko3  V0.0            Inital creation.               *
+ * 567     19.10.2026.                                    *
+ * ------  --------------  ----------------------------   *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "../diag/diag.h"
+
+#ifndef J2_LIST_INCLUDE
+#define J2_LIST_INCLUDE
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 
+ * Amount of nodes a pool allocates at once when it runs out.
+ */
+#define J2_LIST_POOL_CHUNK 64
+
+/**
+ * @def @c J2_LIST_ENTRY(3)
+ * 
+ *      @brief The struct of @c "type" whose link field @c "member" is at 
+ *      @c "link".
+ * 
+ *      @example
+ *      struct timer { long deadline; struct j2dlist_link link; };
+ *      struct timer * t = J2_LIST_ENTRY(j2dlist_first(&timers), 
+ *                                       struct timer, link);
+ * 
+ */
+#define J2_LIST_ENTRY(link, type, member)                                      \
+        ((type *)((char *)(link) - offsetof(type, member)))
+
+/**
+ * @struct @c j2slist_link
+ * 
+ *      @brief Link of a singly linked list, embedded inside of the struct 
+ *      that is being listed.
+ * 
+ */
+struct j2slist_link {
+
+        struct j2slist_link * next;
+
+};
+
+/**
+ * @struct @c j2slist
+ * 
+ *      @brief Singly linked list remembering its last link so pushing to 
+ *      the back and splicing are O(1). Removing needs the link before, 
+ *      which is what walking a singly linked list gives anyway.
+ * 
+ */
+typedef struct j2slist {
+
+        struct j2slist_link * first;
+        struct j2slist_link * last;
+
+} j2slist;
+
+/**
+ * @struct @c j2dlist_link
+ * 
+ *      @brief Link of a doubly linked list, embedded inside of the struct
+ *      that is being listed. An unlinked link points to itself.
+ * 
+ */
+struct j2dlist_link {
+
+        struct j2dlist_link * next;
+        struct j2dlist_link * prev;
+
+};
+
+/**
+ * @struct @c j2dlist
+ * 
+ *      @brief Circular doubly linked list around a sentinel link, the
+ *      sentinel is never NULL so no operation needs to check for the ends.
+ * 
+ */
+typedef struct j2dlist {
+
+        struct j2dlist_link head;
+
+} j2dlist;
+
+/**
+ * @brief 
+ * Pool of fixed size nodes, see j2list_pool_new().
+ */
+typedef struct j2list_pool j2list_pool;
+
+/**
+ * @struct @c j2slist_node
+ * 
+ *      @brief Node for a singly linked list of plain values, allocated 
+ *      from a pool by j2slist_node_new().
+ * 
+ */
+struct j2slist_node {
+
+        struct j2slist_link link;
+        void * value;
+
+};
+
+/**
+ * @struct @c j2dlist_node
+ * 
+ *      @brief Node for a doubly linked list of plain values, allocated 
+ *      from a pool by j2dlist_node_new().
+ * 
+ */
+struct j2dlist_node {
+
+        struct j2dlist_link link;
+        void * value;
+
+};
+
+/**
+ * @brief 
+ * Walk a list, @c "cursor" is the current link. Removing it inside of the
+ * loop is only safe with the _safe variant which keeps the next one in
+ * @c "saved".
+ */
+#define j2slist_foreach(cursor, list)                                          \
+        for(struct j2slist_link * cursor = (list)->first; cursor;              \
+            cursor = cursor->next)
+#define j2dlist_foreach(cursor, list)                                          \
+        for(struct j2dlist_link * cursor = (list)->head.next;                  \
+            cursor != &(list)->head; cursor = cursor->next)
+#define j2dlist_foreach_safe(cursor, saved, list)                              \
+        for(struct j2dlist_link * cursor = (list)->head.next,                  \
+            * saved = cursor->next; cursor != &(list)->head;                   \
+            cursor = saved, saved = cursor->next)
+
+/**
+ * @brief 
+ * Empty singly linked list.
+ */
+static inline void
+j2slist_init(
+        j2slist * list )
+{
+        list->first = NULL;
+        list->last  = NULL;
+}
+
+static inline bool
+j2slist_empty(
+        const j2slist * list )
+{
+        return list->first == NULL;
+}
+
+static inline void
+j2slist_push_front(
+        j2slist * list,
+        struct j2slist_link * link )
+{
+        link->next  = list->first;
+        list->first = link;
+        if(!list->last) list->last = link;
+}
+
+static inline void
+j2slist_push_back(
+        j2slist * list,
+        struct j2slist_link * link )
+{
+        link->next = NULL;
+        if(list->last) list->last->next = link;
+        else           list->first      = link;
+        list->last = link;
+}
+
+/**
+ * @brief 
+ * Unlink and return the first link or NULL if the list is empty.
+ */
+static inline struct j2slist_link *
+j2slist_pop_front(
+        j2slist * list )
+{
+        struct j2slist_link * link = list->first;
+        if(!link) return NULL;
+
+        list->first = link->next;
+        if(!list->first) list->last = NULL;
+        return link;
+}
+
+/**
+ * @brief 
+ * Insert @c "link" after @c "prev", NULL inserts at the front.
+ */
+static inline void
+j2slist_insert_after(
+        j2slist * list,
+        struct j2slist_link * prev,
+        struct j2slist_link * link )
+{
+        if(!prev) {
+                j2slist_push_front(list, link);
+                return;
+        }
+
+        link->next = prev->next;
+        prev->next = link;
+        if(list->last == prev) list->last = link;
+}
+
+/**
+ * @brief 
+ * Unlink and return the link after @c "prev", NULL unlinks the first one.
+ */
+static inline struct j2slist_link *
+j2slist_remove_after(
+        j2slist * list,
+        struct j2slist_link * prev )
+{
+        if(!prev) return j2slist_pop_front(list);
+
+        struct j2slist_link * link = prev->next;
+        if(!link) return NULL;
+
+        prev->next = link->next;
+        if(list->last == link) list->last = prev;
+        return link;
+}
+
+/**
+ * @brief 
+ * Move the link after @c "prev" to the front of the list.
+ */
+static inline void
+j2slist_move_to_front(
+        j2slist * list,
+        struct j2slist_link * prev )
+{
+        if(!prev) return;
+
+        struct j2slist_link * link = j2slist_remove_after(list, prev);
+        if(link) j2slist_push_front(list, link);
+}
+
+/**
+ * @brief 
+ * Append every link of @c "src" to @c "dst" and leave @c "src" empty.
+ */
+static inline void
+j2slist_splice(
+        j2slist * dst,
+        j2slist * src )
+{
+        if(!src->first) return;
+
+        if(dst->last) dst->last->next = src->first;
+        else          dst->first      = src->first;
+        dst->last = src->last;
+
+        j2slist_init(src);
+}
+
+/**
+ * @brief 
+ * Empty doubly linked list.
+ */
+static inline void
+j2dlist_init(
+        j2dlist * list )
+{
+        list->head.next = &list->head;
+        list->head.prev = &list->head;
+}
+
+static inline bool
+j2dlist_empty(
+        const j2dlist * list )
+{
+        return list->head.next == &list->head;
+}
+
+/**
+ * @brief 
+ * First and last link or NULL if the list is empty.
+ */
+static inline struct j2dlist_link *
+j2dlist_first(
+        j2dlist * list )
+{
+        return j2dlist_empty(list) ? NULL : list->head.next;
+}
+
+static inline struct j2dlist_link *
+j2dlist_last(
+        j2dlist * list )
+{
+        return j2dlist_empty(list) ? NULL : list->head.prev;
+}
+
+/**
+ * @brief 
+ * Insert @c "link" between @c "prev" and @c "next".
+ */
+static inline void
+j2dlist_link_between(
+        struct j2dlist_link * prev,
+        struct j2dlist_link * next,
+        struct j2dlist_link * link )
+{
+        link->prev = prev;
+        link->next = next;
+        prev->next = link;
+        next->prev = link;
+}
+
+static inline void
+j2dlist_push_front(
+        j2dlist * list,
+        struct j2dlist_link * link )
+{
+        j2dlist_link_between(&list->head, list->head.next, link);
+}
+
+static inline void
+j2dlist_push_back(
+        j2dlist * list,
+        struct j2dlist_link * link )
+{
+        j2dlist_link_between(list->head.prev, &list->head, link);
+}
+
+static inline void
+j2dlist_insert_after(
+        struct j2dlist_link * prev,
+        struct j2dlist_link * link )
+{
+        j2dlist_link_between(prev, prev->next, link);
+}
+
+static inline void
+j2dlist_insert_before(
+        struct j2dlist_link * next,
+        struct j2dlist_link * link )
+{
+        j2dlist_link_between(next->prev, next, link);
+}
+
+/**
+ * @brief 
+ * Take @c "link" out of whatever list it is in, it points to itself after
+ * so unlinking it twice is harmless.
+ */
+static inline void
+j2dlist_unlink(
+        struct j2dlist_link * link )
+{
+        link->prev->next = link->next;
+        link->next->prev = link->prev;
+        link->next = link;
+        link->prev = link;
+}
+
+/**
+ * @brief 
+ * Unlink and return the first or last link, NULL if the list is empty.
+ */
+static inline struct j2dlist_link *
+j2dlist_pop_front(
+        j2dlist * list )
+{
+        struct j2dlist_link * link = j2dlist_first(list);
+        if(link) j2dlist_unlink(link);
+        return link;
+}
+
+static inline struct j2dlist_link *
+j2dlist_pop_back(
+        j2dlist * list )
+{
+        struct j2dlist_link * link = j2dlist_last(list);
+        if(link) j2dlist_unlink(link);
+        return link;
+}
+
+/**
+ * @brief 
+ * Move @c "link", which is inside of @c "list", to its front or back. This
+ * is the touch of an LRU cache.
+ */
+static inline void
+j2dlist_move_to_front(
+        j2dlist * list,
+        struct j2dlist_link * link )
+{
+        if(list->head.next == link) return;
+
+        link->prev->next = link->next;
+        link->next->prev = link->prev;
+        j2dlist_push_front(list, link);
+}
+
+static inline void
+j2dlist_move_to_back(
+        j2dlist * list,
+        struct j2dlist_link * link )
+{
+        if(list->head.prev == link) return;
+
+        link->prev->next = link->next;
+        link->next->prev = link->prev;
+        j2dlist_push_back(list, link);
+}
+
+/**
+ * @brief 
+ * Append every link of @c "src" to @c "dst" and leave @c "src" empty.
+ */
+static inline void
+j2dlist_splice(
+        j2dlist * dst,
+        j2dlist * src )
+{
+        if(j2dlist_empty(src)) return;
+
+        struct j2dlist_link * first = src->head.next;
+        struct j2dlist_link * last  = src->head.prev;
+
+        first->prev          = dst->head.prev;
+        dst->head.prev->next = first;
+        last->next           = &dst->head;
+        dst->head.prev       = last;
+
+        j2dlist_init(src);
+}
+
+j2list_pool *
+j2list_pool_new(
+        size_t size
+);
+
+void
+j2list_pool_free(
+        j2list_pool * pool
+);
+
+void *
+j2list_pool_get(
+        j2list_pool * pool
+);
+
+void
+j2list_pool_put(
+        j2list_pool * pool,
+        void * node
+);
+
+struct j2slist_node *
+j2slist_node_new(
+        j2list_pool * pool,
+        void * value
+);
+
+struct j2dlist_node *
+j2dlist_node_new(
+        j2list_pool * pool,
+        void * value
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /** @c J2_LIST_INCLUDE */
@@ -0,0 +1,294 @@
+/*** LICENSE: LGPLV2. *************************************
+ *                                                        *
+ *                                                        *
+ * This file is a part of the j2 project.                 *
+ * Copyright (C) 2022 Joško Križanović                    *
+ * <jkriza02@fesb.com>                                    *
+ *                                                        *
+ * This library is free software; you can redistribute    *
+ * it and/or modify it under the terms of the GNU Lesser  *
+ * General Public License as published by the Free        *
+ * Software Foundation; either version 2.1 of the         *
+ * License, or (at your option) any later version.        *
+ *                                                        *
+ * This library is distributed in the hope that it will   *
+ * be useful,                                             *
+ * but WITHOUT ANY WARRANTY; without even the implied     *
+ * warranty of MERCHANTABILITY or FITNESS FOR A           *
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public  *
+ * License for more details.                              *
+ *                                                        *
+ * You should have received a copy of the GNU Lesser      *
+ * General Public License along with this library; if     *
+ * not, write to the Free Software Foundation, Inc.,      *
+ * 51 Franklin Street, Fifth Floor, Boston,               *
+ * MA  02110-1301  USA                                    *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: FILE, AUTHOR & DATE INFORMATION. *********
+ *                                                        *
+ *                                                        *
+ * FILE:                                                  *
+ * Pool of fixed size nodes handed out from chunks and    *
+ * recycled through a free list, and the value nodes of   *
+ * non intrusive lists.                                   *
+ *                                                        *
+ *                                                        *
+ * AUTHOR:                                                *
+ *      NAME:  Joško Križanović                           *
+ *      EMAIL: jkriza02@fesb.com                          *
+ *                                                        *
+ *                                                        *
+ * DATE:                                                  *
+ * 19.10.2026.                                            *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+
+#include "../list.h"
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdalign.h>
+#include <errno.h>
+
+/**
+ * @struct @c j2list_pool_chunk
+ * 
+ *      @brief Header of one allocation of J2_LIST_POOL_CHUNK nodes, the 
+ *      nodes follow it.
+ * 
+ */
+struct j2list_pool_chunk {
+
+        struct j2list_pool_chunk * next;
+        alignas(max_align_t) unsigned char nodes[];
+
+};
+
+/**
+ * @struct @c j2list_pool
+ * 
+ *      @brief A free node stores the pointer to the next free node inside
+ *      of itself. Nodes are only given back to the system when the whole
+ *      pool is freed.
+ * 
+ */
+struct j2list_pool {
+
+        size_t size;
+        void * free;
+        struct j2list_pool_chunk * chunks;
+
+};
+
+/**
+ * @brief 
+ * Thread a new chunk of nodes onto the free list.
+ */
+static int
+pool_chunk(
+        j2list_pool * pool )
+{
+
+        struct j2list_pool_chunk * chunk = malloc(
+                sizeof(struct j2list_pool_chunk) 
+              + pool->size * J2_LIST_POOL_CHUNK);
+        if(!chunk) {
+                errno = ENOMEM;
+                return -1;
+        }
+
+        chunk->next  = pool->chunks;
+        pool->chunks = chunk;
+
+        /// Hand out the nodes in address order.
+        for(size_t i = J2_LIST_POOL_CHUNK; i-- > 0;) {
+                void ** node = (void **)(chunk->nodes + i * pool->size);
+                (*node)    = pool->free;
+                pool->free = node;
+        }
+
+        return 0;
+
+}
+
+/**
+ * @fn @c j2list_pool_new(1)
+ * 
+ *      @brief Create a pool of nodes of @c "size" bytes, e.g. 
+ *      @c sizeof(struct j2dlist_node). Getting and putting back a node is
+ *      a couple of pointer moves instead of malloc and free.
+ * 
+ * 
+ *      @throw @a EINVAL - If @c "size" is 0.
+ *      @throw @a ENOMEM - Exhausted all memory spaces.
+ * 
+ * 
+ *      @returns The new pool or NULL on failure.
+ * 
+ */
+j2list_pool *
+j2list_pool_new(
+        size_t size )
+{
+
+        if(!size || size > SIZE_MAX / 2 / J2_LIST_POOL_CHUNK) {
+                errno = EINVAL;
+                return NULL;
+        }
+
+        j2list_pool * pool = malloc(sizeof(j2list_pool));
+        if(!pool) {
+                errno = ENOMEM;
+                return NULL;
+        }
+
+        /// Every node must be able to hold the free list pointer and stay
+        /// aligned for anything.
+        size_t align = alignof(max_align_t);
+        if(size < sizeof(void *)) size = sizeof(void *);
+        pool->size   = (size + align - 1) & ~(align - 1);
+        pool->free   = NULL;
+        pool->chunks = NULL;
+
+        return pool;
+
+}
+
+/**
+ * @fn @c j2list_pool_free(1)
+ * 
+ *      @brief Free the pool together with every node it ever handed out.
+ * 
+ */
+void
+j2list_pool_free(
+        j2list_pool * pool )
+{
+
+        if(!pool) return;
+
+        while(pool->chunks) {
+                struct j2list_pool_chunk * next = pool->chunks->next;
+                free(pool->chunks);
+                pool->chunks = next;
+        }
+
+        free(pool);
+
+}
+
+/**
+ * @fn @c j2list_pool_get(1)
+ * 
+ *      @brief Take a node out of @c "pool", its contents are undefined.
+ * 
+ * 
+ *      @throw @a EINVAL - If @c "pool" is a NULL ptr.
+ *      @throw @a ENOMEM - Exhausted all memory spaces.
+ * 
+ * 
+ *      @returns The node or NULL on failure.
+ * 
+ */
+void *
+j2list_pool_get(
+        j2list_pool * pool )
+{
+
+#ifdef __J2_DEV__
+        if(!pool) {
+                errno = EINVAL;
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2list_pool_get() /"
+                        " j2.list.pool.get() parameter"
+                        " pool is a NULL ptr.");
+                return NULL;
+        }
+#endif
+
+        if(!pool->free && pool_chunk(pool)) return NULL;
+
+        void ** node = pool->free;
+        pool->free   = (*node);
+
+        return node;
+
+}
+
+/**
+ * @fn @c j2list_pool_put(2)
+ * 
+ *      @brief Give @c "node", taken from @c "pool", back to it. NULL is 
+ *      ignored.
+ * 
+ */
+void
+j2list_pool_put(
+        j2list_pool * pool,
+        void * node )
+{
+
+        if(!pool || !node) return;
+
+        (*(void **)node) = pool->free;
+        pool->free       = node;
+
+}
+
+/**
+ * @fn @c j2slist_node_new(2)
+ * 
+ *      @brief Node holding @c "value" from a pool made for 
+ *      @c sizeof(struct j2slist_node), give it back with 
+ *      @c j2list_pool_put(2) once it is unlinked.
+ * 
+ *      @returns The unlinked node or NULL on failure.
+ * 
+ */
+struct j2slist_node *
+j2slist_node_new(
+        j2list_pool * pool,
+        void * value )
+{
+
+        struct j2slist_node * node = j2list_pool_get(pool);
+        if(!node) return NULL;
+
+        node->link.next = NULL;
+        node->value     = value;
+
+        return node;
+
+}
+
+/**
+ * @fn @c j2dlist_node_new(2)
+ * 
+ *      @brief Node holding @c "value" from a pool made for 
+ *      @c sizeof(struct j2dlist_node), give it back with 
+ *      @c j2list_pool_put(2) once it is unlinked.
+ * 
+ *      @returns The unlinked node or NULL on failure.
+ * 
+ */
+struct j2dlist_node *
+j2dlist_node_new(
+        j2list_pool * pool,
+        void * value )
+{
+
+        struct j2dlist_node * node = j2list_pool_get(pool);
+        if(!node) return NULL;
+
+        node->link.next = &node->link;
+        node->link.prev = &node->link;
+        node->value     = value;
+
+        return node;
+
+}
@@ -0,0 +1,288 @@
+/*** LICENSE: LGPLV2. *************************************
+ *                                                        *
+ *                                                        *
+ * This file is a part of the j2 project.                 *
+ * Copyright (C) 2022 Joško Križanović                    *
+ * <jkriza02@fesb.com>                                    *
+ *                                                        *
+ * This library is free software; you can redistribute    *
+ * it and/or modify it under the terms of the GNU Lesser  *
+ * General Public License as published by the Free        *
+ * Software Foundation; either version 2.1 of the         *
+ * License, or (at your option) any later version.        *
+ *                                                        *
+ * This library is distributed in the hope that it will   *
+ * be useful,                                             *
+ * but WITHOUT ANY WARRANTY; without even the implied     *
+ * warranty of MERCHANTABILITY or FITNESS FOR A           *
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public  *
+ * License for more details.                              *
+ *                                                        *
+ * You should have received a copy of the GNU Lesser      *
+ * General Public License along with this library; if     *
+ * not, write to the Free Software Foundation, Inc.,      *
+ * 51 Franklin Street, Fifth Floor, Boston,               *
+ * MA  02110-1301  USA                                    *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: FILE, AUTHOR & DATE INFORMATION. *********
+ *                                                        *
+ *                                                        *
+ * FILE:                                                  *
+ * Plett list, an unrolled list of fixed size elements    *
+ * packed into cache line aligned nodes.                  *
+ *                                                        *
+ *                                                        *
+ * AUTHOR:                                                *
+ *      NAME:  Joško Križanović                           *
+ *      EMAIL: jkriza02@fesb.com                          *
+ *                                                        *
+ *                                                        *
+ * DATE:                                                  *
+ * 19.10.2026.                                            *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: COMPATIBILITY. ***************************
+ *                                                        *
+ *                                                        *
+ * C:                                                     *
+ * This library is written in compliance to the limited   *
+ * functionality at the disposal of the C99 standard.     *
+ *                                                        *
+ *                                                        *
+ * POSIX:                                                 *
+ * This libraries creator has yet to inscribe the minimum *
+ * POSIX compatibilty version that this library requires. *
+ * In its absance the user of the library is free to use  *
+ * any compatibilty version of the POSIX standard that is *
+ * deemed to work through trial and error.                *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: USED NAMESPACE ***************************
+ *                                                        *
+ *                                                        *
+ * Used namespaces, ... indicates that all characters     *
+ * that come after do not belong to that namespace:       *
+ * -> j2plett...                                          *
+ * -> J2_PLETT...                                         *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: EXTERNAL FILES CALLED & PURPOSE **********
+ *                                                        *
+ *                                                        *
+ * Name                     Description                   *
+ * ----                     -----------                   *
+ * <stddef.h>               size_t                        *
+ *                                                        *
+ * <stdbool.h>              booleans                      *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: DEVELOPMENT HISTORY/VERSIONS PUBLISHED ***
+ *                                                        *
+ *                                                        *
+ * Author  Release & Date  Description of modifications   *
+ * ------  --------------  ----------------------------   *
+ * josko3  V0.0            Inital creation.               *
+ * 567     19.10.2026.                                    *
+ * ------  --------------  ----------------------------   *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "../diag/diag.h"
+
+#ifndef J2_PLETT_INCLUDE
+#define J2_PLETT_INCLUDE
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup Node shape
+ * @brief 
+ * Nodes are aligned to and a multiple of a cache line. A node is 
+ * J2_PLETT_NODE_SIZE bytes unless an element is so big that two of them
+ * don't fit, then it grows to fit two.
+ * @{
+ */
+#define J2_PLETT_CACHE_LINE 64
+#define J2_PLETT_NODE_SIZE  256
+/**
+ * @}
+ */
+
+/**
+ * @struct @c j2plett_node
+ * 
+ *      @brief Node holding up to @c "per_node" elements of its list packed
+ *      one after the other.
+ * 
+ */
+struct j2plett_node {
+
+        struct j2plett_node * next;
+        struct j2plett_node * prev;
+        size_t count;
+        _Alignas(16) unsigned char elements[];
+
+};
+
+/**
+ * @struct @c j2plett
+ * 
+ *      @brief Unrolled linked list. Scanning it follows one pointer per 
+ *      node instead of one per element, an insert in the middle moves at
+ *      most one node worth of elements and splits the node when it is 
+ *      full, an erase merges a node that dropped under half full with its
+ *      neighbour when they fit into one.
+ * 
+ * 
+ *      @tparam @b size
+ *      @tparam @b per_node
+ *      @tparam @b count
+ *      @tparam @b nodes
+ *      @tparam @b first
+ *      @tparam @b last
+ *   
+ */
+typedef struct j2plett {
+
+        /**
+         * @tparam @b size
+         * Size of one element in bytes.
+         */
+        size_t size;
+
+        /**
+         * @tparam @b per_node
+         * Amount of elements that fit into a node, at least 2.
+         */
+        size_t per_node;
+
+        /**
+         * @tparam @b count
+         * Amount of elements.
+         */
+        size_t count;
+
+        /**
+         * @tparam @b nodes
+         * Amount of nodes.
+         */
+        size_t nodes;
+
+        struct j2plett_node * first;
+        struct j2plett_node * last;
+
+} j2plett;
+
+/**
+ * @brief 
+ * Address of element @c "index" of @c "node".
+ */
+#define J2_PLETT_ELEMENT(list, node, index)                                    \
+        ((node)->elements + (index) * (list)->size)
+
+/**
+ * @struct @c j2plett_cursor
+ * 
+ *      @brief Position of j2plett_next(), start from @c {0}.
+ * 
+ */
+struct j2plett_cursor {
+
+        struct j2plett_node * node;
+        size_t index;
+
+};
+
+j2plett *
+j2plett_new(
+        size_t size
+);
+
+void
+j2plett_free(
+        j2plett * list
+);
+
+void
+j2plett_clear(
+        j2plett * list
+);
+
+size_t
+j2plett_count(
+        const j2plett * list
+);
+
+int
+j2plett_append(
+        j2plett * list,
+        const void * element
+);
+
+int
+j2plett_insert(
+        j2plett * list,
+        size_t index,
+        const void * element
+);
+
+bool
+j2plett_erase(
+        j2plett * list,
+        size_t index,
+        void * element
+);
+
+void *
+j2plett_at(
+        const j2plett * list,
+        size_t index
+);
+
+void *
+j2plett_next(
+        const j2plett * list,
+        struct j2plett_cursor * cursor
+);
+
+struct j2plett_node *
+j2plett_node_new(
+        j2plett * list,
+        struct j2plett_node * after
+);
+
+void
+j2plett_node_free(
+        j2plett * list,
+        struct j2plett_node * node
+);
+
+struct j2plett_node *
+j2plett_find(
+        const j2plett * list,
+        size_t index,
+        size_t * offset
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /** @c J2_PLETT_INCLUDE */
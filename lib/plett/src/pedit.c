@@ -0,0 +1,223 @@
+/*** LICENSE: LGPLV2. *************************************
+ *                                                        *
+ *                                                        *
+ * This file is a part of the j2 project.                 *
+ * Copyright (C) 2022 Joško Križanović                    *
+ * <jkriza02@fesb.com>                                    *
+ *                                                        *
+ * This library is free software; you can redistribute    *
+ * it and/or modify it under the terms of the GNU Lesser  *
+ * General Public License as published by the Free        *
+ * Software Foundation; either version 2.1 of the         *
+ * License, or (at your option) any later version.        *
+ *                                                        *
+ * This library is distributed in the hope that it will   *
+ * be useful,                                             *
+ * but WITHOUT ANY WARRANTY; without even the implied     *
+ * warranty of MERCHANTABILITY or FITNESS FOR A           *
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public  *
+ * License for more details.                              *
+ *                                                        *
+ * You should have received a copy of the GNU Lesser      *
+ * General Public License along with this library; if     *
+ * not, write to the Free Software Foundation, Inc.,      *
+ * 51 Franklin Street, Fifth Floor, Boston,               *
+ * MA  02110-1301  USA                                    *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: FILE, AUTHOR & DATE INFORMATION. *********
+ *                                                        *
+ *                                                        *
+ * FILE:                                                  *
+ * Inserting into the middle of a plett list with node    *
+ * splits and erasing with node merges.                   *
+ *                                                        *
+ *                                                        *
+ * AUTHOR:                                                *
+ *      NAME:  Joško Križanović                           *
+ *      EMAIL: jkriza02@fesb.com                          *
+ *                                                        *
+ *                                                        *
+ * DATE:                                                  *
+ * 19.10.2026.                                            *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+
+#include "../plett.h"
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+/**
+ * @brief 
+ * Move @c "count" elements of @c "src" starting at @c "from" to the end of
+ * @c "dst".
+ */
+static inline void
+pedit_move(
+        const j2plett * list,
+        struct j2plett_node * dst,
+        struct j2plett_node * src,
+        size_t from,
+        size_t count )
+{
+        memcpy(J2_PLETT_ELEMENT(list, dst, dst->count), 
+               J2_PLETT_ELEMENT(list, src, from), count * list->size);
+        dst->count += count;
+        src->count -= count;
+}
+
+/**
+ * @fn @c j2plett_insert(3)
+ * 
+ *      @brief Copy @c "element" into @c "list" so that it becomes element
+ *      @c "index". Only the elements after it inside of its node move. A
+ *      full node first spills into the end of the node before it when the
+ *      element goes to its front, otherwise it is split in half.
+ * 
+ * 
+ *      @throw @a EINVAL - If @c "list" or @c "element" are NULL ptrs.
+ *      @throw @a ERANGE - If @c "index" is past the end of the list.
+ *      @throw @a ENOMEM - Exhausted all memory spaces.
+ * 
+ * 
+ *      @returns 0 on success, -1 on failure.
+ * 
+ */
+int
+j2plett_insert(
+        j2plett * list,
+        size_t index,
+        const void * element )
+{
+
+#ifdef __J2_DEV__
+        if(!list || !element) {
+                errno = EINVAL;
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2plett_insert() /"
+                        " j2.plett.insert() parameter"
+                        " list/element is a NULL ptr.");
+                return -1;
+        }
+#endif
+
+        if(index > list->count) {
+                errno = ERANGE;
+                return -1;
+        }
+        if(index == list->count) return j2plett_append(list, element);
+
+        size_t offset;
+        struct j2plett_node * node = j2plett_find(list, index, &offset);
+
+        if(node->count == list->per_node) {
+
+                if(!offset && node->prev 
+                && node->prev->count < list->per_node) {
+                        node   = node->prev;
+                        offset = node->count;
+                }
+                else {
+                        struct j2plett_node * split = 
+                                j2plett_node_new(list, node);
+                        if(!split) return -1;
+
+                        size_t half = list->per_node / 2;
+                        pedit_move(list, split, node, half, 
+                                   node->count - half);
+
+                        if(offset > half) {
+                                node    = split;
+                                offset -= half;
+                        }
+                }
+
+        }
+
+        memmove(J2_PLETT_ELEMENT(list, node, offset + 1),
+                J2_PLETT_ELEMENT(list, node, offset),
+                (node->count - offset) * list->size);
+        memcpy(J2_PLETT_ELEMENT(list, node, offset), element, list->size);
+
+        node->count++;
+        list->count++;
+
+        return 0;
+
+}
+
+/**
+ * @fn @c j2plett_erase(3)
+ * 
+ *      @brief Remove element @c "index" of @c "list", copying it into 
+ *      @c "element" if it isn't NULL. A node left under half full is 
+ *      merged with its next or previous node if both fit into one, an 
+ *      empty node is freed.
+ * 
+ * 
+ *      @throw @a EINVAL - If @c "list" is a NULL ptr.
+ * 
+ * 
+ *      @returns False if @c "index" is out of range.
+ * 
+ */
+bool
+j2plett_erase(
+        j2plett * list,
+        size_t index,
+        void * element )
+{
+
+#ifdef __J2_DEV__
+        if(!list) {
+                errno = EINVAL;
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2plett_erase() /"
+                        " j2.plett.erase() parameter"
+                        " list is a NULL ptr.");
+                return false;
+        }
+#endif
+
+        size_t offset;
+        struct j2plett_node * node = j2plett_find(list, index, &offset);
+        if(!node) return false;
+
+        if(element) memcpy(element, J2_PLETT_ELEMENT(list, node, offset), 
+                           list->size);
+
+        memmove(J2_PLETT_ELEMENT(list, node, offset),
+                J2_PLETT_ELEMENT(list, node, offset + 1),
+                (node->count - offset - 1) * list->size);
+        node->count--;
+        list->count--;
+
+        if(!node->count) {
+                j2plett_node_free(list, node);
+                return true;
+        }
+
+        if(node->count >= list->per_node / 2) return true;
+
+        struct j2plett_node * next = node->next;
+        struct j2plett_node * prev = node->prev;
+
+        if(next && node->count + next->count <= list->per_node) {
+                pedit_move(list, node, next, 0, next->count);
+                j2plett_node_free(list, next);
+        }
+        else if(prev && prev->count + node->count <= list->per_node) {
+                pedit_move(list, prev, node, 0, node->count);
+                j2plett_node_free(list, node);
+        }
+
+        return true;
+
+}
@@ -0,0 +1,389 @@
+/*** LICENSE: LGPLV2. *************************************
+ *                                                        *
+ *                                                        *
+ * This file is a part of the j2 project.                 *
+ * Copyright (C) 2022 Joško Križanović                    *
+ * <jkriza02@fesb.com>                                    *
+ *                                                        *
+ * This library is free software; you can redistribute    *
+ * it and/or modify it under the terms of the GNU Lesser  *
+ * General Public License as published by the Free        *
+ * Software Foundation; either version 2.1 of the         *
+ * License, or (at your option) any later version.        *
+ *                                                        *
+ * This library is distributed in the hope that it will   *
+ * be useful,                                             *
+ * but WITHOUT ANY WARRANTY; without even the implied     *
+ * warranty of MERCHANTABILITY or FITNESS FOR A           *
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public  *
+ * License for more details.                              *
+ *                                                        *
+ * You should have received a copy of the GNU Lesser      *
+ * General Public License along with this library; if     *
+ * not, write to the Free Software Foundation, Inc.,      *
+ * 51 Franklin Street, Fifth Floor, Boston,               *
+ * MA  02110-1301  USA                                    *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: FILE, AUTHOR & DATE INFORMATION. *********
+ *                                                        *
+ *                                                        *
+ * FILE:                                                  *
+ * Plett list creation, appending, walking and finding    *
+ * elements by index.                                     *
+ *                                                        *
+ *                                                        *
+ * AUTHOR:                                                *
+ *      NAME:  Joško Križanović                           *
+ *      EMAIL: jkriza02@fesb.com                          *
+ *                                                        *
+ *                                                        *
+ * DATE:                                                  *
+ * 19.10.2026.                                            *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+
+#include "../plett.h"
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+/**
+ * @brief 
+ * Bytes of one node of @c "list", rounded up to whole cache lines.
+ */
+static size_t
+plett_node_bytes(
+        const j2plett * list )
+{
+        size_t bytes = offsetof(struct j2plett_node, elements) 
+                     + list->per_node * list->size;
+        return (bytes + J2_PLETT_CACHE_LINE - 1) 
+             & ~(size_t)(J2_PLETT_CACHE_LINE - 1);
+}
+
+/**
+ * @fn @c j2plett_node_new(2)
+ * 
+ *      @brief Allocate an empty node and link it in after @c "after", NULL
+ *      makes it the first node.
+ * 
+ *      @returns The node or NULL on failure.
+ * 
+ */
+struct j2plett_node *
+j2plett_node_new(
+        j2plett * list,
+        struct j2plett_node * after )
+{
+
+        struct j2plett_node * node = aligned_alloc(J2_PLETT_CACHE_LINE, 
+                plett_node_bytes(list));
+        if(!node) {
+                errno = ENOMEM;
+                return NULL;
+        }
+
+        node->count = 0;
+        node->prev  = after;
+        node->next  = after ? after->next : list->first;
+
+        if(node->next) node->next->prev = node;
+        else           list->last       = node;
+        if(after)      after->next      = node;
+        else           list->first      = node;
+
+        list->nodes++;
+
+        return node;
+
+}
+
+/**
+ * @fn @c j2plett_node_free(2)
+ * 
+ *      @brief Unlink @c "node" from @c "list" and free it, its elements are
+ *      not counted anymore.
+ * 
+ */
+void
+j2plett_node_free(
+        j2plett * list,
+        struct j2plett_node * node )
+{
+
+        if(node->prev) node->prev->next = node->next;
+        else           list->first      = node->next;
+        if(node->next) node->next->prev = node->prev;
+        else           list->last       = node->prev;
+
+        list->count -= node->count;
+        list->nodes--;
+        free(node);
+
+}
+
+/**
+ * @fn @c j2plett_find(3)
+ * 
+ *      @brief Node holding element @c "index", walking from whichever end
+ *      of the list is closer. @c "(*offset)" gets the index inside of the
+ *      node.
+ * 
+ *      @returns The node or NULL if @c "index" is out of range.
+ * 
+ */
+struct j2plett_node *
+j2plett_find(
+        const j2plett * list,
+        size_t index,
+        size_t * offset )
+{
+
+        if(index >= list->count) return NULL;
+
+        struct j2plett_node * node;
+
+        if(index < list->count / 2) {
+                node = list->first;
+                while(index >= node->count) {
+                        index -= node->count;
+                        node   = node->next;
+                }
+        }
+        else {
+                size_t after = list->count - index;
+                node = list->last;
+                while(after > node->count) {
+                        after -= node->count;
+                        node   = node->prev;
+                }
+                index = node->count - after;
+        }
+
+        (*offset) = index;
+        return node;
+
+}
+
+/**
+ * @fn @c j2plett_new(1)
+ * 
+ *      @brief Create an empty plett list of elements @c "size" bytes big.
+ * 
+ * 
+ *      @throw @a EINVAL - If @c "size" is 0.
+ *      @throw @a ENOMEM - Exhausted all memory spaces.
+ * 
+ * 
+ *      @returns The new list or NULL on failure.
+ * 
+ */
+j2plett *
+j2plett_new(
+        size_t size )
+{
+
+        if(!size || size > SIZE_MAX / 4) {
+                errno = EINVAL;
+                return NULL;
+        }
+
+        j2plett * list = malloc(sizeof(j2plett));
+        if(!list) {
+                errno = ENOMEM;
+                return NULL;
+        }
+
+        size_t room = J2_PLETT_NODE_SIZE 
+                    - offsetof(struct j2plett_node, elements);
+
+        list->size     = size;
+        list->per_node = room / size < 2 ? 2 : room / size;
+        list->count    = 0;
+        list->nodes    = 0;
+        list->first    = NULL;
+        list->last     = NULL;
+
+        return list;
+
+}
+
+/**
+ * @fn @c j2plett_free(1)
+ * 
+ *      @brief Free the list and its elements.
+ * 
+ */
+void
+j2plett_free(
+        j2plett * list )
+{
+
+        if(!list) return;
+
+        j2plett_clear(list);
+        free(list);
+
+}
+
+/**
+ * @fn @c j2plett_clear(1)
+ * 
+ *      @brief Remove every element and free every node.
+ * 
+ */
+void
+j2plett_clear(
+        j2plett * list )
+{
+
+        if(!list) return;
+
+        struct j2plett_node * node = list->first;
+        while(node) {
+                struct j2plett_node * next = node->next;
+                free(node);
+                node = next;
+        }
+
+        list->count = 0;
+        list->nodes = 0;
+        list->first = NULL;
+        list->last  = NULL;
+
+}
+
+/**
+ * @fn @c j2plett_count(1)
+ * 
+ *      @brief Amount of elements inside of @c "list".
+ * 
+ */
+size_t
+j2plett_count(
+        const j2plett * list )
+{
+        return list ? list->count : 0;
+}
+
+/**
+ * @fn @c j2plett_append(2)
+ * 
+ *      @brief Copy @c "element" to the end of @c "list". The last node is
+ *      filled completely before a new one is started, so sequentially 
+ *      built lists are packed.
+ * 
+ * 
+ *      @throw @a EINVAL - If @c "list" or @c "element" are NULL ptrs.
+ *      @throw @a ENOMEM - Exhausted all memory spaces.
+ * 
+ * 
+ *      @returns 0 on success, -1 on failure.
+ * 
+ */
+int
+j2plett_append(
+        j2plett * list,
+        const void * element )
+{
+
+#ifdef __J2_DEV__
+        if(!list || !element) {
+                errno = EINVAL;
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2plett_append() /"
+                        " j2.plett.append() parameter"
+                        " list/element is a NULL ptr.");
+                return -1;
+        }
+#endif
+
+        struct j2plett_node * node = list->last;
+        if((!node || node->count == list->per_node)
+        && !(node = j2plett_node_new(list, node)))
+                return -1;
+
+        memcpy(J2_PLETT_ELEMENT(list, node, node->count), element, 
+               list->size);
+        node->count++;
+        list->count++;
+
+        return 0;
+
+}
+
+/**
+ * @fn @c j2plett_at(2)
+ * 
+ *      @brief Element @c "index" of @c "list" in place, valid until the 
+ *      next insert or erase. Walks node by node, use j2plett_next() to go
+ *      through many elements.
+ * 
+ *      @returns Pointer to the element or NULL if @c "index" is out of 
+ *      range.
+ * 
+ */
+void *
+j2plett_at(
+        const j2plett * list,
+        size_t index )
+{
+
+        if(!list) return NULL;
+
+        size_t offset;
+        struct j2plett_node * node = j2plett_find(list, index, &offset);
+
+        return node ? J2_PLETT_ELEMENT(list, node, offset) : NULL;
+
+}
+
+/**
+ * @fn @c j2plett_next(2)
+ * 
+ *      @brief Walk every element of @c "list" in order, @c "cursor" starts
+ *      zeroed.
+ * 
+ *      @example
+ *      struct j2plett_cursor cursor = {0};
+ *      int * value;
+ *      while((value = j2plett_next(list, &cursor))) sum += *value;
+ * 
+ *      @returns The next element or NULL at the end.
+ * 
+ */
+void *
+j2plett_next(
+        const j2plett * list,
+        struct j2plett_cursor * cursor )
+{
+
+        if(!list || !cursor) return NULL;
+
+        /// A cursor that reached the end stays there with a NULL node.
+        if(!cursor->node) {
+                if(cursor->index == SIZE_MAX) return NULL;
+                cursor->node  = list->first;
+                cursor->index = 0;
+        }
+
+        while(cursor->node && cursor->index >= cursor->node->count) {
+                cursor->node  = cursor->node->next;
+                cursor->index = 0;
+        }
+
+        if(!cursor->node) {
+                cursor->index = SIZE_MAX;
+                return NULL;
+        }
+
+        return J2_PLETT_ELEMENT(list, cursor->node, cursor->index++);
+
+}
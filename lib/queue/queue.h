@@ -0,0 +1,237 @@
+/*** LICENSE: LGPLV2. *************************************
+ *                                                        *
+ *                                                        *
+ * This file is a part of the j2 project.                 *
+ * Copyright (C) 2022 Joško Križanović                    *
+ * <jkriza02@fesb.com>                                    *
+ *                                                        *
+ * This library is free software; you can redistribute    *
+ * it and/or modify it under the terms of the GNU Lesser  *
+ * General Public License as published by the Free        *
+ * Software Foundation; either version 2.1 of the         *
+ * License, or (at your option) any later version.        *
+ *                                                        *
+ * This library is distributed in the hope that it will   *
+ * be useful,                                             *
+ * but WITHOUT ANY WARRANTY; without even the implied     *
+ * warranty of MERCHANTABILITY or FITNESS FOR A           *
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public  *
+ * License for more details.                              *
+ *                                                        *
+ * You should have received a copy of the GNU Lesser      *
+ * General Public License along with this library; if     *
+ * not, write to the Free Software Foundation, Inc.,      *
+ * 51 Franklin Street, Fifth Floor, Boston,               *
+ * MA  02110-1301  USA                                    *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: FILE, AUTHOR & DATE INFORMATION. *********
+ *                                                        *
+ *                                                        *
+ * FILE:                                                  *
+ * Queue of fixed size elements stored inline inside of a *
+ * power of 2 ring buffer.                                *
+ *                                                        *
+ *                                                        *
+ * AUTHOR:                                                *
+ *      NAME:  Joško Križanović                           *
+ *      EMAIL: jkriza02@fesb.com                          *
+ *                                                        *
+ *                                                        *
+ * DATE:                                                  *
+ * 19.10.2026.                                            *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: COMPATIBILITY. ***************************
+ *                                                        *
+ *                                                        *
+ * C:                                                     *
+ * This library is written in compliance to the limited   *
+ * functionality at the disposal of the C99 standard.     *
+ *                                                        *
+ *                                                        *
+ * POSIX:                                                 *
+ * This libraries creator has yet to inscribe the minimum *
+ * POSIX compatibilty version that this library requires. *
+ * In its absance the user of the library is free to use  *
+ * any compatibilty version of the POSIX standard that is *
+ * deemed to work through trial and error.                *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: USED NAMESPACE ***************************
+ *                                                        *
+ *                                                        *
+ * Used namespaces, ... indicates that all characters     *
+ * that come after do not belong to that namespace:       *
+ * -> j2queue...                                          *
+ * -> J2_QUEUE...                                         *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: EXTERNAL FILES CALLED & PURPOSE **********
+ *                                                        *
+ *                                                        *
+ * Name                     Description                   *
+ * ----                     -----------                   *
+ * <stdbool.h>              booleans                      *
+ *                                                        *
+ * <stddef.h>               size_t                        *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: DEVELOPMENT HISTORY/VERSIONS PUBLISHED ***
+ *                                                        *
+ *                                                        *
+ * Author  Release & Date  Description of modifications   *
+ * ------  --------------  ----------------------------   *
+ * josko3  V0.0            Inital creation.               *
+ * 567     19.10.2026.                                    *
+ * ------  --------------  ----------------------------   *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "../diag/diag.h"
+
+#ifndef J2_QUEUE_INCLUDE
+#define J2_QUEUE_INCLUDE
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 
+ * Smallest amount of elements a queue allocates room for.
+ */
+#define J2_QUEUE_MIN 16
+
+/**
+ * @struct @c j2queue
+ * 
+ *      @brief First in first out queue. Elements are copied into one ring
+ *      buffer whose capacity is a power of 2, so wrapping an index is a 
+ *      mask and never a division.
+ * 
+ *      The queue occupies @c "filled" elements starting at @c "head", 
+ *      possibly wrapping around the end of the buffer:
+ * 
+ *      [ 4 5 . . . . 1 2 3 ]
+ *            ^tail   ^head
+ * 
+ * 
+ *      @tparam @b size
+ *      @tparam @b mask
+ *      @tparam @b head
+ *      @tparam @b filled
+ *      @tparam @b array
+ *   
+ */
+typedef struct j2queue {
+
+        /**
+         * @tparam @b size
+         * Size of one element in bytes.
+         */
+        size_t size;
+
+        /**
+         * @tparam @b mask
+         * Capacity - 1.
+         */
+        size_t mask;
+
+        /**
+         * @tparam @b head
+         * Index of the front element.
+         */
+        size_t head;
+
+        /**
+         * @tparam @b filled
+         * Amount of elements.
+         */
+        size_t filled;
+
+        /**
+         * @tparam @b array
+         * Ring buffer of (mask + 1) * size bytes.
+         */
+        unsigned char * array;
+
+} j2queue;
+
+j2queue *
+j2queue_new(
+        size_t size,
+        size_t reserve
+);
+
+void
+j2queue_free(
+        j2queue * queue
+);
+
+int
+j2queue_reserve(
+        j2queue * queue,
+        size_t count
+);
+
+void
+j2queue_clear(
+        j2queue * queue
+);
+
+size_t
+j2queue_count(
+        const j2queue * queue
+);
+
+int
+j2queue_push(
+        j2queue * queue,
+        const void * element
+);
+
+bool
+j2queue_pop(
+        j2queue * queue,
+        void * element
+);
+
+void *
+j2queue_front(
+        const j2queue * queue
+);
+
+int
+j2queue_push_n(
+        j2queue * queue,
+        const void * elements,
+        size_t count
+);
+
+size_t
+j2queue_pop_n(
+        j2queue * queue,
+        void * elements,
+        size_t count
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /** @c J2_QUEUE_INCLUDE */
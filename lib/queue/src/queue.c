@@ -0,0 +1,420 @@
+/*** LICENSE: LGPLV2. *************************************
+ *                                                        *
+ *                                                        *
+ * This file is a part of the j2 project.                 *
+ * Copyright (C) 2022 Joško Križanović                    *
+ * <jkriza02@fesb.com>                                    *
+ *                                                        *
+ * This library is free software; you can redistribute    *
+ * it and/or modify it under the terms of the GNU Lesser  *
+ * General Public License as published by the Free        *
+ * Software Foundation; either version 2.1 of the         *
+ * License, or (at your option) any later version.        *
+ *                                                        *
+ * This library is distributed in the hope that it will   *
+ * be useful,                                             *
+ * but WITHOUT ANY WARRANTY; without even the implied     *
+ * warranty of MERCHANTABILITY or FITNESS FOR A           *
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public  *
+ * License for more details.                              *
+ *                                                        *
+ * You should have received a copy of the GNU Lesser      *
+ * General Public License along with this library; if     *
+ * not, write to the Free Software Foundation, Inc.,      *
+ * 51 Franklin Street, Fifth Floor, Boston,               *
+ * MA  02110-1301  USA                                    *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: FILE, AUTHOR & DATE INFORMATION. *********
+ *                                                        *
+ *                                                        *
+ * FILE:                                                  *
+ * Ring buffer queue, growing by unwrapping once and      *
+ * moving many elements with at most two copies.          *
+ *                                                        *
+ *                                                        *
+ * AUTHOR:                                                *
+ *      NAME:  Joško Križanović                           *
+ *      EMAIL: jkriza02@fesb.com                          *
+ *                                                        *
+ *                                                        *
+ * DATE:                                                  *
+ * 19.10.2026.                                            *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+
+#include "../queue.h"
+#include "../../stats/stats.h"
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#ifdef __J2_DEV__
+#define QUEUE_CHECK(valid, text, fail)                                         \
+        if(!(valid)) {                                                         \
+                errno = EINVAL;                                                \
+                J2_DIAG(J2_DIAG_INVALID, text);                                \
+                return fail;                                                   \
+        }
+#else
+#define QUEUE_CHECK(valid, text, fail)
+#endif
+
+/**
+ * @brief 
+ * Address of element @c "index" of the ring buffer.
+ */
+static inline unsigned char *
+queue_at(
+        const j2queue * queue,
+        size_t index )
+{
+        return queue->array + (index & queue->mask) * queue->size;
+}
+
+/**
+ * @fn @c j2queue_new(2)
+ * 
+ *      @brief Create an empty queue.
+ * 
+ * 
+ *      @param @b size
+ *             Size of one element in bytes, usually @c sizeof(type).
+ * 
+ *      @param @b reserve
+ *             Amount of elements the queue fits before it first grows, it
+ *             is rounded up to a power of 2.
+ * 
+ * 
+ *      @throw @a EINVAL - If @c "size" is 0.
+ *      @throw @a ENOMEM - Exhausted all memory spaces.
+ * 
+ * 
+ *      @returns The new queue or NULL on failure.
+ * 
+ */
+j2queue *
+j2queue_new(
+        size_t size,
+        size_t reserve )
+{
+
+        if(!size) {
+                errno = EINVAL;
+                return NULL;
+        }
+
+        j2queue * queue = malloc(sizeof(j2queue));
+        if(!queue) {
+                errno = ENOMEM;
+                return NULL;
+        }
+
+        (*queue) = (j2queue){
+                .size   = size,
+                .mask   = 0,
+                .head   = 0,
+                .filled = 0,
+                .array  = NULL
+        };
+
+        if(j2queue_reserve(queue, reserve < J2_QUEUE_MIN ? 
+                J2_QUEUE_MIN : reserve)) {
+                free(queue);
+                return NULL;
+        }
+
+        return queue;
+
+}
+
+/**
+ * @fn @c j2queue_free(1)
+ * 
+ *      @brief Free the queue and its elements.
+ * 
+ */
+void
+j2queue_free(
+        j2queue * queue )
+{
+
+        if(!queue) return;
+
+        free(queue->array);
+        free(queue);
+
+}
+
+/**
+ * @fn @c j2queue_reserve(2)
+ * 
+ *      @brief Grow the buffer of @c "queue" to fit @c "count" elements, 
+ *      doubling it until they fit. Elements that wrapped around the end
+ *      of the old buffer are copied once behind it so the queue is in 
+ *      one piece again.
+ * 
+ * 
+ *      @throw @a EINVAL - If @c "queue" is a NULL ptr.
+ *      @throw @a ENOMEM - Exhausted all memory spaces, the queue stays as
+ *                         it was.
+ * 
+ * 
+ *      @returns 0 on success, -1 on failure.
+ * 
+ */
+int
+j2queue_reserve(
+        j2queue * queue,
+        size_t count )
+{
+
+        QUEUE_CHECK(queue, "j2queue_reserve() parameter queue is a NULL ptr.",
+                -1);
+
+        size_t old = queue->array ? queue->mask + 1 : 0;
+        if(count <= old) return 0;
+
+        size_t capacity = old ? old : 1;
+        while(capacity < count) {
+                if(capacity > SIZE_MAX / 2 / queue->size) {
+                        errno = ENOMEM;
+                        return -1;
+                }
+                capacity <<= 1;
+        }
+
+        unsigned char * array = realloc(queue->array, capacity * queue->size);
+        if(!array) {
+                errno = ENOMEM;
+                return -1;
+        }
+
+        /// Capacity at least doubled, the wrapped front of the old buffer
+        /// fits right behind it.
+        if(queue->head + queue->filled > old) 
+                memcpy(array + old * queue->size, array, 
+                       (queue->head + queue->filled - old) * queue->size);
+
+        queue->array = array;
+        queue->mask  = capacity - 1;
+
+        J2_STATS_ADD(J2_STATS_GROW, 1);
+        J2_TRACE2(queue_grow, old, capacity);
+
+        return 0;
+
+}
+
+/**
+ * @fn @c j2queue_clear(1)
+ * 
+ *      @brief Remove every element but keep the buffer.
+ * 
+ */
+void
+j2queue_clear(
+        j2queue * queue )
+{
+
+        if(!queue) return;
+
+        queue->head   = 0;
+        queue->filled = 0;
+
+}
+
+/**
+ * @fn @c j2queue_count(1)
+ * 
+ *      @brief Amount of elements inside of @c "queue".
+ * 
+ */
+size_t
+j2queue_count(
+        const j2queue * queue )
+{
+        return queue ? queue->filled : 0;
+}
+
+/**
+ * @fn @c j2queue_push(2)
+ * 
+ *      @brief Copy @c "element" to the back of @c "queue".
+ * 
+ * 
+ *      @throw @a EINVAL - If @c "queue" or @c "element" are NULL ptrs.
+ *      @throw @a ENOMEM - Exhausted all memory spaces.
+ * 
+ * 
+ *      @returns 0 on success, -1 on failure.
+ * 
+ */
+int
+j2queue_push(
+        j2queue * queue,
+        const void * element )
+{
+
+        QUEUE_CHECK(queue && element, "j2queue_push() parameter queue/element"
+                " is a NULL ptr.", -1);
+
+        if(queue->filled > queue->mask 
+        && j2queue_reserve(queue, queue->filled + 1))
+                return -1;
+
+        memcpy(queue_at(queue, queue->head + queue->filled), element, 
+               queue->size);
+        queue->filled++;
+
+        return 0;
+
+}
+
+/**
+ * @fn @c j2queue_pop(2)
+ * 
+ *      @brief Remove the front element of @c "queue", copying it into 
+ *      @c "element" if it isn't NULL.
+ * 
+ * 
+ *      @throw @a EINVAL - If @c "queue" is a NULL ptr.
+ * 
+ * 
+ *      @returns False if the queue was empty.
+ * 
+ */
+bool
+j2queue_pop(
+        j2queue * queue,
+        void * element )
+{
+
+        QUEUE_CHECK(queue, "j2queue_pop() parameter queue is a NULL ptr.",
+                false);
+
+        if(!queue->filled) return false;
+
+        if(element) memcpy(element, queue_at(queue, queue->head), 
+                           queue->size);
+
+        queue->head = (queue->head + 1) & queue->mask;
+        queue->filled--;
+
+        return true;
+
+}
+
+/**
+ * @fn @c j2queue_front(1)
+ * 
+ *      @brief Front element of @c "queue" in place, valid until the next
+ *      push.
+ * 
+ *      @returns Pointer to the element or NULL if the queue is empty.
+ * 
+ */
+void *
+j2queue_front(
+        const j2queue * queue )
+{
+
+        QUEUE_CHECK(queue, "j2queue_front() parameter queue is a NULL ptr.",
+                NULL);
+
+        return queue->filled ? queue_at(queue, queue->head) : NULL;
+
+}
+
+/**
+ * @fn @c j2queue_push_n(3)
+ * 
+ *      @brief Copy @c "count" elements from the array @c "elements" to the
+ *      back of @c "queue" in order. Growing happens once and the copy is
+ *      split in two only where the buffer wraps.
+ * 
+ * 
+ *      @throw @a EINVAL - If @c "queue" or @c "elements" are NULL ptrs.
+ *      @throw @a ENOMEM - Exhausted all memory spaces, nothing is pushed.
+ * 
+ * 
+ *      @returns 0 on success, -1 on failure.
+ * 
+ */
+int
+j2queue_push_n(
+        j2queue * queue,
+        const void * elements,
+        size_t count )
+{
+
+        QUEUE_CHECK(queue && (elements || !count), "j2queue_push_n() parameter"
+                " queue/elements is a NULL ptr.", -1);
+
+        if(!count) return 0;
+
+        if(j2queue_reserve(queue, queue->filled + count)) return -1;
+
+        size_t tail  = (queue->head + queue->filled) & queue->mask;
+        size_t first = queue->mask + 1 - tail;
+        if(first > count) first = count;
+
+        memcpy(queue->array + tail * queue->size, elements, 
+               first * queue->size);
+        memcpy(queue->array, (const unsigned char *)elements 
+               + first * queue->size, (count - first) * queue->size);
+
+        queue->filled += count;
+
+        return 0;
+
+}
+
+/**
+ * @fn @c j2queue_pop_n(3)
+ * 
+ *      @brief Remove up to @c "count" elements from the front of 
+ *      @c "queue", copying them into the array @c "elements" in order if
+ *      it isn't NULL.
+ * 
+ * 
+ *      @throw @a EINVAL - If @c "queue" is a NULL ptr.
+ * 
+ * 
+ *      @returns Amount of elements removed.
+ * 
+ */
+size_t
+j2queue_pop_n(
+        j2queue * queue,
+        void * elements,
+        size_t count )
+{
+
+        QUEUE_CHECK(queue, "j2queue_pop_n() parameter queue is a NULL ptr.",
+                0);
+
+        if(count > queue->filled) count = queue->filled;
+
+        if(elements) {
+                size_t first = queue->mask + 1 - queue->head;
+                if(first > count) first = count;
+
+                memcpy(elements, queue->array + queue->head * queue->size,
+                       first * queue->size);
+                memcpy((unsigned char *)elements + first * queue->size,
+                       queue->array, (count - first) * queue->size);
+        }
+
+        queue->head    = (queue->head + count) & queue->mask;
+        queue->filled -= count;
+
+        return count;
+
+}
@@ -0,0 +1,338 @@
+/*** LICENSE: LGPLV2. *************************************
+ *                                                        *
+ *                                                        *
+ * This file is a part of the j2 project.                 *
+ * Copyright (C) 2022 Joško Križanović                    *
+ * <jkriza02@fesb.com>                                    *
+ *                                                        *
+ * This library is free software; you can redistribute    *
+ * it and/or modify it under the terms of the GNU Lesser  *
+ * General Public License as published by the Free        *
+ * Software Foundation; either version 2.1 of the         *
+ * License, or (at your option) any later version.        *
+ *                                                        *
+ * This library is distributed in the hope that it will   *
+ * be useful,                                             *
+ * but WITHOUT ANY WARRANTY; without even the implied     *
+ * warranty of MERCHANTABILITY or FITNESS FOR A           *
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public  *
+ * License for more details.                              *
+ *                                                        *
+ * You should have received a copy of the GNU Lesser      *
+ * General Public License along with this library; if     *
+ * not, write to the Free Software Foundation, Inc.,      *
+ * 51 Franklin Street, Fifth Floor, Boston,               *
+ * MA  02110-1301  USA                                    *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: FILE, AUTHOR & DATE INFORMATION. *********
+ *                                                        *
+ *                                                        *
+ * FILE:                                                  *
+ * Rope, a balanced tree of j2string chunks for large     *
+ * text that gets edited in the middle.                   *
+ *                                                        *
+ *                                                        *
+ * AUTHOR:                                                *
+ *      NAME:  Joško Križanović                           *
+ *      EMAIL: jkriza02@fesb.com                          *
+ *                                                        *
+ *                                                        *
+ * DATE:                                                  *
+ * 19.10.2026.                                            *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: COMPATIBILITY. ***************************
+ *                                                        *
+ *                                                        *
+ * C:                                                     *
+ * This library is written in compliance to the limited   *
+ * functionality at the disposal of the C99 standard.     *
+ *                                                        *
+ *                                                        *
+ * POSIX:                                                 *
+ * This libraries creator has yet to inscribe the minimum *
+ * POSIX compatibilty version that this library requires. *
+ * In its absance the user of the library is free to use  *
+ * any compatibilty version of the POSIX standard that is *
+ * deemed to work through trial and error.                *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: USED NAMESPACE ***************************
+ *                                                        *
+ *                                                        *
+ * Used namespaces, ... indicates that all characters     *
+ * that come after do not belong to that namespace:       *
+ * -> j2rope...                                           *
+ * -> J2_ROPE...                                          *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: EXTERNAL FILES CALLED & PURPOSE **********
+ *                                                        *
+ *                                                        *
+ * Name                     Description                   *
+ * ----                     -----------                   *
+ * <stdint.h>               fixed size integers           *
+ *                                                        *
+ * "../string/string.h"     j2string chunks               *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: DEVELOPMENT HISTORY/VERSIONS PUBLISHED ***
+ *                                                        *
+ *                                                        *
+ * Author  Release & Date  Description of modifications   *
+ * ------  --------------  ----------------------------   *
+ * josko3  V0.0            Inital creation.               *
+ * 567     19.10.2026.                                    *
+ * ------  --------------  ----------------------------   *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "../diag/diag.h"
+
+#include "../string/string.h"
+
+#ifndef J2_ROPE_INCLUDE
+#define J2_ROPE_INCLUDE
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup Chunk sizes
+ * @brief 
+ * The most bytes a single chunk holds, how full new chunks are filled up
+ * so small inserts still fit in place and the step chunks grow in.
+ * @{
+ */
+#define J2_ROPE_CHUNK_MAX     _IEEE1541_INT_KiB(1)
+#define J2_ROPE_CHUNK_FILL    (J2_ROPE_CHUNK_MAX/4*3)
+#define J2_ROPE_CHUNK_PADDING 64
+/**
+ * @}
+ */
+
+/**
+ * @struct @c j2rope_node
+ * 
+ *      @brief A node of the rope, every node holds one chunk of text and
+ *      the sizes of the whole subtree under it. The tree is a treap ordered
+ *      by position so every edit is a split and/or a merge.
+ * 
+ * 
+ *      @tparam @b left
+ *      @tparam @b right
+ *      @tparam @b chunk
+ *      @tparam @b bytes
+ *      @tparam @b length
+ *      @tparam @b priority
+ *   
+ */
+struct j2rope_node {
+
+        /**
+         * @tparam @b left @b right
+         * Text that comes before and after the chunk.
+         */
+        struct j2rope_node * left;
+        struct j2rope_node * right;
+
+        /**
+         * @tparam @b chunk
+         * Dynamic j2string holding at most J2_ROPE_CHUNK_MAX bytes, never 
+         * cut in the middle of a UTF-8 character.
+         */
+        j2string chunk;
+
+        /**
+         * @tparam @b bytes @b length
+         * Amount of bytes and UTF-8 characters inside of this subtree.
+         */
+        size_t bytes;
+        size_t length;
+
+        /**
+         * @tparam @b priority
+         * Random heap priority that keeps the tree balanced.
+         */
+        uint32_t priority;
+
+};
+
+/**
+ * @struct @c j2rope
+ * 
+ *      @brief A rope of text, all positions and counts are in UTF-8 
+ *      characters.
+ * 
+ * 
+ *      @tparam @b root
+ *      @tparam @b seed
+ *   
+ */
+typedef struct j2rope {
+
+        /**
+         * @tparam @b root
+         * Root of the treap, NULL for an empty rope.
+         */
+        struct j2rope_node * root;
+
+        /**
+         * @tparam @b seed
+         * State of the xorshift generator handing out node priorities.
+         */
+        uint64_t seed;
+
+} j2rope;
+
+/**
+ * @brief 
+ * Amount of bytes and UTF-8 characters inside of a subtree, NULL is an
+ * empty subtree.
+ */
+#define J2_ROPE_BYTES(node)  ((node) ? (node)->bytes  : (size_t)0)
+#define J2_ROPE_LENGTH(node) ((node) ? (node)->length : (size_t)0)
+
+size_t
+j2rope_chunk_offset(
+        const_j2string chunk,
+        size_t position
+);
+
+struct j2rope_node *
+j2rope_node_new(
+        j2rope * rope,
+        const char * str,
+        size_t bytes,
+        size_t length
+);
+
+void
+j2rope_node_free(
+        struct j2rope_node * node
+);
+
+void
+j2rope_node_update(
+        struct j2rope_node * node
+);
+
+int
+j2rope_node_split(
+        struct j2rope_node * node,
+        size_t position,
+        struct j2rope_node ** left,
+        struct j2rope_node ** right
+);
+
+struct j2rope_node *
+j2rope_node_merge(
+        struct j2rope_node * left,
+        struct j2rope_node * right
+);
+
+int
+j2rope_node_build(
+        j2rope * rope,
+        const char * str,
+        size_t bytes,
+        struct j2rope_node ** out
+);
+
+j2rope *
+j2rope_new(
+        const char * cstr
+);
+
+j2rope *
+j2rope_from(
+        const_j2string string
+);
+
+void
+j2rope_free(
+        j2rope * rope
+);
+
+size_t
+j2rope_bytes(
+        const j2rope * rope
+);
+
+size_t
+j2rope_length(
+        const j2rope * rope
+);
+
+long
+j2rope_insert(
+        j2rope * rope,
+        size_t position,
+        const_j2string string
+);
+
+long
+j2rope_cinsert(
+        j2rope * rope,
+        size_t position,
+        const char * cstr
+);
+
+long
+j2rope_erase(
+        j2rope * rope,
+        size_t position,
+        size_t count
+);
+
+j2string
+j2rope_slice(
+        const j2rope * rope,
+        size_t position,
+        size_t count
+);
+
+j2string
+j2rope_flatten(
+        const j2rope * rope
+);
+
+long
+j2rope_write(
+        const j2rope * rope,
+        int fd
+);
+
+j2rope *
+j2rope_split(
+        j2rope * rope,
+        size_t position
+);
+
+void
+j2rope_concat(
+        j2rope * dst,
+        j2rope * src
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /** @c J2_ROPE_INCLUDE */
@@ -0,0 +1,174 @@
+/*** LICENSE: LGPLV2. *************************************
+ *                                                        *
+ *                                                        *
+ * This file is a part of the j2 project.                 *
+ * Copyright (C) 2022 Joško Križanović                    *
+ * <jkriza02@fesb.com>                                    *
+ *                                                        *
+ * This library is free software; you can redistribute    *
+ * it and/or modify it under the terms of the GNU Lesser  *
+ * General Public License as published by the Free        *
+ * Software Foundation; either version 2.1 of the         *
+ * License, or (at your option) any later version.        *
+ *                                                        *
+ * This library is distributed in the hope that it will   *
+ * be useful,                                             *
+ * but WITHOUT ANY WARRANTY; without even the implied     *
+ * warranty of MERCHANTABILITY or FITNESS FOR A           *
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public  *
+ * License for more details.                              *
+ *                                                        *
+ * You should have received a copy of the GNU Lesser      *
+ * General Public License along with this library; if     *
+ * not, write to the Free Software Foundation, Inc.,      *
+ * 51 Franklin Street, Fifth Floor, Boston,               *
+ * MA  02110-1301  USA                                    *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: FILE, AUTHOR & DATE INFORMATION. *********
+ *                                                        *
+ *                                                        *
+ * FILE:                                                  *
+ * Erasing a range of characters from a rope.             *
+ *                                                        *
+ *                                                        *
+ * AUTHOR:                                                *
+ *      NAME:  Joško Križanović                           *
+ *      EMAIL: jkriza02@fesb.com                          *
+ *                                                        *
+ *                                                        *
+ * DATE:                                                  *
+ * 19.10.2026.                                            *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+#include "../rope.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+/**
+ * @fn @c j2rope_erase(3)
+ * 
+ *      @brief Erase @c "count" characters from @c "rope" starting with the 
+ *      one at @c "position".
+ * 
+ *      A range inside of a single chunk is removed in place, anything 
+ *      bigger splits the tree around the range and frees it, O(log n) 
+ *      either way.
+ * 
+ * 
+ *      @param @b rope
+ *             The rope to erase from.
+ * 
+ *      @param @b position
+ *             Character position of the first erased character.
+ * 
+ *      @param @b count
+ *             Amount of characters to erase, clamped to the end of the rope.
+ * 
+ * 
+ *      @throw @a EINVAL - If @c "rope" is a NULL ptr.
+ *      @throw @a ENOMEM - No memory to cut a chunk at the edges of the range,
+ *                         the rope stays as it was.
+ * 
+ * 
+ *      @returns The amount of UTF-8 characters erased.
+ * 
+ */
+long
+j2rope_erase(
+        j2rope * rope,
+        size_t position,
+        size_t count )
+{
+
+#ifdef __J2_DEV__
+        if(!rope) {
+                errno = EINVAL;
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2rope_erase() / j2.rope.erase()"
+                        " parameter rope is a NULL ptr.");
+                return 0;
+        }
+#endif
+
+        size_t total = J2_ROPE_LENGTH(rope->root);
+        if(position >= total) return 0;
+        if(count > total - position) count = total - position;
+        if(!count) return 0;
+
+        /// Pass 1: find the chunk the range starts in.
+        struct j2rope_node * node = rope->root;
+        size_t at = position;
+        while(node) {
+                size_t before = J2_ROPE_LENGTH(node->left);
+                size_t here   = J2_STRING_INFO(node->chunk)->length;
+                if(at < before) {
+                        node = node->left;
+                } else if(at < before + here) {
+                        at -= before;
+                        break;
+                } else {
+                        at  -= before + here;
+                        node = node->right;
+                }
+        }
+
+        struct j2string_st * info = J2_STRING_INFO(node->chunk);
+
+        /// Range stays inside of the chunk and doesn't empty it.
+        if(at + count <= info->length && count < info->length) {
+
+                size_t offset = j2rope_chunk_offset(node->chunk, at);
+                size_t bytes  = j2rope_chunk_offset(node->chunk, at + count)
+                              - offset;
+
+                /// Pass 2: the same path down, shrinking every subtree on it.
+                struct j2rope_node * walk = rope->root;
+                size_t to = position;
+                while(walk != node) {
+                        size_t before = J2_ROPE_LENGTH(walk->left);
+                        size_t here   = J2_STRING_INFO(walk->chunk)->length;
+                        walk->bytes  -= bytes;
+                        walk->length -= count;
+                        if(to < before) {
+                                walk = walk->left;
+                        } else {
+                                to  -= before + here;
+                                walk = walk->right;
+                        }
+                }
+                node->bytes  -= bytes;
+                node->length -= count;
+
+                memmove(node->chunk + offset, node->chunk + offset + bytes,
+                        info->filled - offset - bytes + 1);
+                info->filled -= bytes;
+                info->length -= count;
+
+                return (long)count;
+
+        }
+
+        /// Range crosses chunks or empties one, cut it out of the tree.
+        struct j2rope_node * left, * middle, * right;
+
+        if(j2rope_node_split(rope->root, position, &left, &right))
+                return 0;
+
+        if(j2rope_node_split(right, count, &middle, &right)) {
+                rope->root = j2rope_node_merge(left, right);
+                return 0;
+        }
+
+        j2rope_node_free(middle);
+        rope->root = j2rope_node_merge(left, right);
+
+        return (long)count;
+
+}
@@ -0,0 +1,254 @@
+/*** LICENSE: LGPLV2. *************************************
+ *                                                        *
+ *                                                        *
+ * This file is a part of the j2 project.                 *
+ * Copyright (C) 2022 Joško Križanović                    *
+ * <jkriza02@fesb.com>                                    *
+ *                                                        *
+ * This library is free software; you can redistribute    *
+ * it and/or modify it under the terms of the GNU Lesser  *
+ * General Public License as published by the Free        *
+ * Software Foundation; either version 2.1 of the         *
+ * License, or (at your option) any later version.        *
+ *                                                        *
+ * This library is distributed in the hope that it will   *
+ * be useful,                                             *
+ * but WITHOUT ANY WARRANTY; without even the implied     *
+ * warranty of MERCHANTABILITY or FITNESS FOR A           *
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public  *
+ * License for more details.                              *
+ *                                                        *
+ * You should have received a copy of the GNU Lesser      *
+ * General Public License along with this library; if     *
+ * not, write to the Free Software Foundation, Inc.,      *
+ * 51 Franklin Street, Fifth Floor, Boston,               *
+ * MA  02110-1301  USA                                    *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: FILE, AUTHOR & DATE INFORMATION. *********
+ *                                                        *
+ *                                                        *
+ * FILE:                                                  *
+ * Inserting text into a rope, in place when it fits the  *
+ * chunk it lands in, otherwise by splitting the tree.    *
+ *                                                        *
+ *                                                        *
+ * AUTHOR:                                                *
+ *      NAME:  Joško Križanović                           *
+ *      EMAIL: jkriza02@fesb.com                          *
+ *                                                        *
+ *                                                        *
+ * DATE:                                                  *
+ * 19.10.2026.                                            *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+#include "../rope.h"
+#include "../../string/utf8.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+
+/**
+ * @brief 
+ * Insert @c "bytes" bytes of @c "str" holding @c "length" characters at the
+ * character @c "position" of @c "rope".
+ */
+static long
+insert_sn(
+        j2rope * rope,
+        size_t position,
+        const char * str,
+        size_t bytes,
+        size_t length )
+{
+
+        if(!bytes) return 0;
+
+        if(position > J2_ROPE_LENGTH(rope->root))
+                position = J2_ROPE_LENGTH(rope->root);
+
+        /// Pass 1: find the chunk "position" lands in, it's the only place
+        /// that can fail so it goes before touching any of the sizes.
+        struct j2rope_node * node = rope->root;
+        size_t at = position;
+        while(node) {
+                size_t before = J2_ROPE_LENGTH(node->left);
+                size_t here   = J2_STRING_INFO(node->chunk)->length;
+                if(at < before) {
+                        node = node->left;
+                } else if(at <= before + here) {
+                        at -= before;
+                        break;
+                } else {
+                        at  -= before + here;
+                        node = node->right;
+                }
+        }
+
+        if(node && J2_STRING_INFO(node->chunk)->filled + bytes 
+                <= J2_ROPE_CHUNK_MAX) {
+
+                struct j2string_st * info = J2_STRING_INFO(node->chunk);
+                size_t need = info->filled + bytes + 1;
+                if(need > info->allocated) {
+                        node->chunk = j2string_update(node->chunk, (long)need);
+                        info = J2_STRING_INFO(node->chunk);
+                        if(need > info->allocated) {
+                                errno = ENOMEM;
+                                return 0;
+                        }
+                }
+
+                /// Pass 2: the same path down, growing every subtree on it.
+                struct j2rope_node * walk = rope->root;
+                size_t to = position;
+                while(walk != node) {
+                        size_t before = J2_ROPE_LENGTH(walk->left);
+                        size_t here   = J2_STRING_INFO(walk->chunk)->length;
+                        walk->bytes  += bytes;
+                        walk->length += length;
+                        if(to < before) {
+                                walk = walk->left;
+                        } else {
+                                to  -= before + here;
+                                walk = walk->right;
+                        }
+                }
+                node->bytes  += bytes;
+                node->length += length;
+
+                size_t offset = j2rope_chunk_offset(node->chunk, at);
+                memmove(node->chunk + offset + bytes, node->chunk + offset,
+                        info->filled - offset + 1);
+                memcpy(node->chunk + offset, str, bytes);
+                info->filled += bytes;
+                info->length += length;
+
+                return (long)length;
+
+        }
+
+        /// Doesn't fit, split the tree and put new chunks in between.
+        struct j2rope_node * left, * right, * middle;
+
+        if(j2rope_node_build(rope, str, bytes, &middle))
+                return 0;
+
+        if(j2rope_node_split(rope->root, position, &left, &right)) {
+                j2rope_node_free(middle);
+                return 0;
+        }
+
+        rope->root = j2rope_node_merge(
+                j2rope_node_merge(left, middle), right
+        );
+
+        return (long)length;
+
+}
+
+/**
+ * @fn @c j2rope_insert(3)
+ * 
+ *      @brief Insert the contents of @c "string" into @c "rope" before the
+ *      character at @c "position".
+ * 
+ *      When the text fits into the chunk @c "position" lands in, it is 
+ *      moved in place and only the sizes along one path get updated, 
+ *      otherwise the tree is split at @c "position" and the new chunks are 
+ *      merged in between, O(log n) either way.
+ * 
+ * 
+ *      @param @b rope
+ *             The rope to insert into.
+ * 
+ *      @param @b position
+ *             Character position to insert at, clamped to the length of 
+ *             the rope.
+ * 
+ *      @param @b string
+ *             j2string type string to insert.
+ * 
+ * 
+ *      @throw @a EINVAL - If @c "rope" or @c "string" are NULL ptrs or 
+ *                         @c "string" isn't a valid j2string.
+ *      @throw @a ENOMEM - Exhausted all memory spaces, the rope stays as
+ *                         it was.
+ * 
+ * 
+ *      @returns The amount of UTF-8 characters inserted.
+ * 
+ */
+long
+j2rope_insert(
+        j2rope * rope,
+        size_t position,
+        const_j2string string )
+{
+
+#ifdef __J2_DEV__
+        const struct j2string_st * check = 
+                string ? J2_STRING_INFO(string) : NULL;
+        if(!rope || !check) {
+                errno = EINVAL;
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2rope_insert() / j2.rope.insert()"
+                        " parameter rope/string is a NULL ptr or"
+                        " string contains invalid j2string info.");
+                return 0;
+        }
+#endif
+
+        const struct j2string_st * info = J2_STRING_INFO(string);
+
+        /// A mapped string may only know its byte count.
+        size_t length = J2_STRING_IS_UNCOUNTED(info) 
+                      ? utf8_count(string, info->filled) : info->length;
+
+        return insert_sn(rope, position, string, info->filled, length);
+
+}
+
+/**
+ * @fn @c j2rope_cinsert(3)
+ * 
+ *      @brief Same as @c j2rope_insert(3) but for a C type string.
+ * 
+ * 
+ *      @throw @a EINVAL - If @c "rope" or @c "cstr" are NULL ptrs.
+ *      @throw @a ENOMEM - Exhausted all memory spaces, the rope stays as
+ *                         it was.
+ * 
+ * 
+ *      @returns The amount of UTF-8 characters inserted.
+ * 
+ */
+long
+j2rope_cinsert(
+        j2rope * rope,
+        size_t position,
+        const char * cstr )
+{
+
+#ifdef __J2_DEV__
+        if(!rope || !cstr) {
+                errno = EINVAL;
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2rope_cinsert() / j2.rope.cinsert()"
+                        " parameter rope/cstr is a NULL ptr.");
+                return 0;
+        }
+#endif
+
+        size_t bytes  = 0;
+        size_t length = j2string_utf8_strlen_sn(cstr, SIZE_MAX, &bytes);
+
+        return insert_sn(rope, position, cstr, bytes, length);
+
+}
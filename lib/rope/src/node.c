@@ -0,0 +1,430 @@
+/*** LICENSE: LGPLV2. *************************************
+ *                                                        *
+ *                                                        *
+ * This file is a part of the j2 project.                 *
+ * Copyright (C) 2022 Joško Križanović                    *
+ * <jkriza02@fesb.com>                                    *
+ *                                                        *
+ * This library is free software; you can redistribute    *
+ * it and/or modify it under the terms of the GNU Lesser  *
+ * General Public License as published by the Free        *
+ * Software Foundation; either version 2.1 of the         *
+ * License, or (at your option) any later version.        *
+ *                                                        *
+ * This library is distributed in the hope that it will   *
+ * be useful,                                             *
+ * but WITHOUT ANY WARRANTY; without even the implied     *
+ * warranty of MERCHANTABILITY or FITNESS FOR A           *
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public  *
+ * License for more details.                              *
+ *                                                        *
+ * You should have received a copy of the GNU Lesser      *
+ * General Public License along with this library; if     *
+ * not, write to the Free Software Foundation, Inc.,      *
+ * 51 Franklin Street, Fifth Floor, Boston,               *
+ * MA  02110-1301  USA                                    *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: FILE, AUTHOR & DATE INFORMATION. *********
+ *                                                        *
+ *                                                        *
+ * FILE:                                                  *
+ * Treap nodes of the rope, splitting and merging them by *
+ * character position.                                    *
+ *                                                        *
+ *                                                        *
+ * AUTHOR:                                                *
+ *      NAME:  Joško Križanović                           *
+ *      EMAIL: jkriza02@fesb.com                          *
+ *                                                        *
+ *                                                        *
+ * DATE:                                                  *
+ * 19.10.2026.                                            *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+#include "../rope.h"
+#include "../../string/utf8.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+/**
+ * @fn @c j2rope_chunk_offset(2)
+ * 
+ *      @brief Byte offset of the UTF-8 character at @c "position" inside of
+ *      a chunk.
+ * 
+ * 
+ *      @param @b chunk
+ *             j2string type chunk of a rope.
+ * 
+ *      @param @b position
+ *             Character position, anything past the end of the chunk 
+ *             returns the amount of bytes the chunk holds.
+ * 
+ * 
+ *      @throw None.
+ * 
+ * 
+ *      @returns The byte offset.
+ * 
+ */
+size_t
+j2rope_chunk_offset(
+        const_j2string chunk,
+        size_t position )
+{
+
+        const struct j2string_st * info = J2_STRING_INFO(chunk);
+
+        if(position == 0)             return 0;
+        if(position >= info->length)  return info->filled;
+        if(info->length == info->filled) return position;
+
+        size_t i = 0;
+        for(; i < info->filled; i++) {
+                if(is_utf8_payload((unsigned char)chunk[i])) {
+                        if(position == 0) break;
+                        position--;
+                }
+        }
+
+        return i;
+
+}
+
+/**
+ * @brief 
+ * Next priority from the ropes xorshift generator.
+ */
+static inline uint32_t
+node_priority(
+        j2rope * rope )
+{
+
+        rope->seed ^= rope->seed << 13;
+        rope->seed ^= rope->seed >> 7;
+        rope->seed ^= rope->seed << 17;
+
+        return (uint32_t)(rope->seed >> 32);
+
+}
+
+/**
+ * @fn @c j2rope_node_new(4)
+ * 
+ *      @brief Allocate a single node holding @c "bytes" bytes of @c "str".
+ * 
+ * 
+ *      @param @b rope
+ *             The rope the node will belong to, used for its priority.
+ *             If NULL the priority is 0 and left to the caller.
+ * 
+ *      @param @b str
+ *             Text of the chunk, doesn't have to be null terminated.
+ * 
+ *      @param @b bytes
+ *             Size of the text, at most J2_ROPE_CHUNK_MAX.
+ * 
+ *      @param @b length
+ *             Amount of UTF-8 characters inside of the text.
+ * 
+ * 
+ *      @throw @a ENOMEM - Exhausted all memory spaces.
+ * 
+ * 
+ *      @returns The new node or NULL if there was no memory left.
+ * 
+ */
+struct j2rope_node *
+j2rope_node_new(
+        j2rope * rope,
+        const char * str,
+        size_t bytes,
+        size_t length )
+{
+
+        struct j2rope_node * node = malloc(sizeof(struct j2rope_node));
+        if(!node) {
+                errno = ENOMEM;
+                return NULL;
+        }
+
+        size_t allocate = (bytes + J2_ROPE_CHUNK_PADDING) 
+                        / J2_ROPE_CHUNK_PADDING * J2_ROPE_CHUNK_PADDING;
+        if(allocate > J2_ROPE_CHUNK_MAX + 1)
+                allocate = J2_ROPE_CHUNK_MAX + 1;
+
+        node->chunk = j2string_allocate((j2string_param){
+                .allocate = allocate,
+                .padding  = J2_ROPE_CHUNK_PADDING,
+                .max      = J2_ROPE_CHUNK_MAX + 1
+        });
+        if(!node->chunk) {
+                free(node);
+                errno = ENOMEM;
+                return NULL;
+        }
+
+        memcpy(node->chunk, str, bytes);
+        node->chunk[bytes] = '\0';
+
+        struct j2string_st * info = J2_STRING_INFO(node->chunk);
+        info->filled = bytes;
+        info->length = length;
+
+        node->left     = NULL;
+        node->right    = NULL;
+        node->bytes    = bytes;
+        node->length   = length;
+        node->priority = rope ? node_priority(rope) : 0;
+
+        return node;
+
+}
+
+/**
+ * @fn @c j2rope_node_free(1)
+ * 
+ *      @brief Free a node and its whole subtree.
+ * 
+ */
+void
+j2rope_node_free(
+        struct j2rope_node * node )
+{
+
+        while(node) {
+                j2rope_node_free(node->left);
+                struct j2rope_node * right = node->right;
+                j2string_free(node->chunk);
+                free(node);
+                node = right;
+        }
+
+}
+
+/**
+ * @fn @c j2rope_node_update(1)
+ * 
+ *      @brief Recalculate the cached sizes of @c "node" from its chunk and
+ *      children.
+ * 
+ */
+void
+j2rope_node_update(
+        struct j2rope_node * node )
+{
+
+        const struct j2string_st * info = J2_STRING_INFO(node->chunk);
+
+        node->bytes  = info->filled 
+                     + J2_ROPE_BYTES(node->left) 
+                     + J2_ROPE_BYTES(node->right);
+        node->length = info->length 
+                     + J2_ROPE_LENGTH(node->left) 
+                     + J2_ROPE_LENGTH(node->right);
+
+}
+
+/**
+ * @fn @c j2rope_node_split(4)
+ * 
+ *      @brief Split the subtree @c "node" into the characters before 
+ *      @c "position" and the ones from it onwards.
+ * 
+ *      A chunk that @c "position" falls into is cut in two, the second half
+ *      gets the priority of the first so both halves stay valid treaps.
+ * 
+ * 
+ *      @param @b node
+ *             Subtree to split.
+ * 
+ *      @param @b position
+ *             Character position to split at.
+ * 
+ *      @param @b left
+ *             Where the subtree before @c "position" is stored.
+ * 
+ *      @param @b right
+ *             Where the subtree from @c "position" onwards is stored.
+ * 
+ * 
+ *      @throw @a ENOMEM - No memory for the second half of a cut chunk.
+ * 
+ * 
+ *      @returns 0 on success, -1 if cutting a chunk failed in which case 
+ *      @c "node" is left untouched.
+ * 
+ */
+int
+j2rope_node_split(
+        struct j2rope_node * node,
+        size_t position,
+        struct j2rope_node ** left,
+        struct j2rope_node ** right )
+{
+
+        if(!node) {
+                (*left)  = NULL;
+                (*right) = NULL;
+                return 0;
+        }
+
+        struct j2string_st * info = J2_STRING_INFO(node->chunk);
+        size_t before = J2_ROPE_LENGTH(node->left);
+        struct j2rope_node * a, * b;
+
+        if(position <= before) {
+
+                if(j2rope_node_split(node->left, position, &a, &b)) 
+                        return -1;
+                node->left = b;
+                j2rope_node_update(node);
+                (*left)  = a;
+                (*right) = node;
+
+        } else if(position >= before + info->length) {
+
+                if(j2rope_node_split(
+                        node->right, position - before - info->length, 
+                        &a, &b)) 
+                        return -1;
+                node->right = a;
+                j2rope_node_update(node);
+                (*left)  = node;
+                (*right) = b;
+
+        } else {
+
+                /// Cut the chunk itself.
+                size_t chars = position - before;
+                size_t byte  = j2rope_chunk_offset(node->chunk, chars);
+
+                struct j2rope_node * tail = j2rope_node_new(
+                        NULL, node->chunk + byte,
+                        info->filled - byte, info->length - chars
+                );
+                if(!tail) return -1;
+
+                tail->priority = node->priority;
+                tail->right    = node->right;
+                node->right    = NULL;
+
+                node->chunk[byte] = '\0';
+                info->filled = byte;
+                info->length = chars;
+
+                j2rope_node_update(tail);
+                j2rope_node_update(node);
+                (*left)  = node;
+                (*right) = tail;
+
+        }
+
+        return 0;
+
+}
+
+/**
+ * @fn @c j2rope_node_merge(2)
+ * 
+ *      @brief Join two subtrees, all of @c "left" comes before @c "right".
+ * 
+ * 
+ *      @returns The root of the joined subtree.
+ * 
+ */
+struct j2rope_node *
+j2rope_node_merge(
+        struct j2rope_node * left,
+        struct j2rope_node * right )
+{
+
+        if(!left)  return right;
+        if(!right) return left;
+
+        if(left->priority >= right->priority) {
+                left->right = j2rope_node_merge(left->right, right);
+                j2rope_node_update(left);
+                return left;
+        } 
+
+        right->left = j2rope_node_merge(left, right->left);
+        j2rope_node_update(right);
+        return right;
+
+}
+
+/**
+ * @fn @c j2rope_node_build(4)
+ * 
+ *      @brief Turn @c "bytes" bytes of @c "str" into a subtree of chunks 
+ *      filled up to J2_ROPE_CHUNK_FILL bytes, never cutting a UTF-8 
+ *      character in half.
+ * 
+ * 
+ *      @param @b rope
+ *             The rope the nodes will belong to.
+ * 
+ *      @param @b str
+ *             Text to build from.
+ * 
+ *      @param @b bytes
+ *             Size of the text.
+ * 
+ *      @param @b out
+ *             Where the built subtree is stored, NULL for empty text.
+ * 
+ * 
+ *      @throw @a ENOMEM - Exhausted all memory spaces.
+ * 
+ * 
+ *      @returns 0 on success, -1 on failure with nothing allocated.
+ * 
+ */
+int
+j2rope_node_build(
+        j2rope * rope,
+        const char * str,
+        size_t bytes,
+        struct j2rope_node ** out )
+{
+
+        struct j2rope_node * tree = NULL;
+
+        while(bytes) {
+
+                size_t size = bytes;
+                if(size > J2_ROPE_CHUNK_FILL) {
+                        size = J2_ROPE_CHUNK_FILL;
+                        while(size > 1 && !is_utf8_payload(
+                                (unsigned char)str[size]))
+                                size--;
+                }
+
+                size_t length = j2string_utf8_strlen_sn(str, size, NULL);
+
+                struct j2rope_node * node = j2rope_node_new(
+                        rope, str, size, length
+                );
+                if(!node) {
+                        j2rope_node_free(tree);
+                        return -1;
+                }
+
+                tree   = j2rope_node_merge(tree, node);
+                str   += size;
+                bytes -= size;
+
+        }
+
+        (*out) = tree;
+        return 0;
+
+}
@@ -0,0 +1,194 @@
+/*** LICENSE: LGPLV2. *************************************
+ *                                                        *
+ *                                                        *
+ * This file is a part of the j2 project.                 *
+ * Copyright (C) 2022 Joško Križanović                    *
+ * <jkriza02@fesb.com>                                    *
+ *                                                        *
+ * This library is free software; you can redistribute    *
+ * it and/or modify it under the terms of the GNU Lesser  *
+ * General Public License as published by the Free        *
+ * Software Foundation; either version 2.1 of the         *
+ * License, or (at your option) any later version.        *
+ *                                                        *
+ * This library is distributed in the hope that it will   *
+ * be useful,                                             *
+ * but WITHOUT ANY WARRANTY; without even the implied     *
+ * warranty of MERCHANTABILITY or FITNESS FOR A           *
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public  *
+ * License for more details.                              *
+ *                                                        *
+ * You should have received a copy of the GNU Lesser      *
+ * General Public License along with this library; if     *
+ * not, write to the Free Software Foundation, Inc.,      *
+ * 51 Franklin Street, Fifth Floor, Boston,               *
+ * MA  02110-1301  USA                                    *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: FILE, AUTHOR & DATE INFORMATION. *********
+ *                                                        *
+ *                                                        *
+ * FILE:                                                  *
+ * Creating, freeing and measuring ropes.                 *
+ *                                                        *
+ *                                                        *
+ * AUTHOR:                                                *
+ *      NAME:  Joško Križanović                           *
+ *      EMAIL: jkriza02@fesb.com                          *
+ *                                                        *
+ *                                                        *
+ * DATE:                                                  *
+ * 19.10.2026.                                            *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+#include "../rope.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <errno.h>
+
+/**
+ * @brief 
+ * Allocate a rope holding @c "bytes" bytes of @c "str".
+ */
+static j2rope *
+rope_create(
+        const char * str,
+        size_t bytes )
+{
+
+        j2rope * rope = malloc(sizeof(j2rope));
+        if(!rope) {
+                errno = ENOMEM;
+                return NULL;
+        }
+
+        rope->root = NULL;
+        rope->seed = 0x9E3779B97F4A7C15ULL ^ (uint64_t)(uintptr_t)rope;
+        if(!rope->seed) rope->seed = 1;
+
+        if(j2rope_node_build(rope, str, bytes, &rope->root)) {
+                free(rope);
+                return NULL;
+        }
+
+        return rope;
+
+}
+
+/**
+ * @fn @c j2rope_new(1)
+ * 
+ *      @brief Create a rope from a C type string.
+ * 
+ * 
+ *      @param @b cstr
+ *             Initial text of the rope, NULL for an empty rope. Unlike 
+ *             j2strings it is not capped by J2_STRING_MAX_SIZE.
+ * 
+ * 
+ *      @throw @a ENOMEM - Exhausted all memory spaces.
+ * 
+ * 
+ *      @returns The new rope or NULL on failure.
+ * 
+ */
+j2rope *
+j2rope_new(
+        const char * cstr )
+{
+
+        size_t bytes = 0;
+        if(cstr) j2string_utf8_strlen_sn(cstr, SIZE_MAX, &bytes);
+
+        return rope_create(cstr, bytes);
+
+}
+
+/**
+ * @fn @c j2rope_from(1)
+ * 
+ *      @brief Create a rope from the contents of a j2string.
+ * 
+ * 
+ *      @param @b string
+ *             j2string type string to copy into the rope.
+ * 
+ * 
+ *      @throw @a EINVAL - If @c "string" is a NULL ptr or not a valid 
+ *                         j2string.
+ *      @throw @a ENOMEM - Exhausted all memory spaces.
+ * 
+ * 
+ *      @returns The new rope or NULL on failure.
+ * 
+ */
+j2rope *
+j2rope_from(
+        const_j2string string )
+{
+
+#ifdef __J2_DEV__
+        const struct j2string_st * check = 
+                string ? J2_STRING_INFO(string) : NULL;
+        if(!check) {
+                errno = EINVAL;
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2rope_from() / j2.rope.from()"
+                        " parameter string is a NULL ptr or"
+                        " contains invalid j2string info.");
+                return NULL;
+        }
+#endif
+
+        return rope_create(string, J2_STRING_INFO(string)->filled);
+
+}
+
+/**
+ * @fn @c j2rope_free(1)
+ * 
+ *      @brief Release the rope and all of its chunks.
+ * 
+ */
+void
+j2rope_free(
+        j2rope * rope )
+{
+
+        if(!rope) return;
+
+        j2rope_node_free(rope->root);
+        free(rope);
+
+}
+
+/**
+ * @fn @c j2rope_bytes(1)
+ * 
+ *      @returns The amount of bytes inside of @c "rope".
+ * 
+ */
+size_t
+j2rope_bytes(
+        const j2rope * rope )
+{
+        return rope ? J2_ROPE_BYTES(rope->root) : 0;
+}
+
+/**
+ * @fn @c j2rope_length(1)
+ * 
+ *      @returns The amount of UTF-8 characters inside of @c "rope".
+ * 
+ */
+size_t
+j2rope_length(
+        const j2rope * rope )
+{
+        return rope ? J2_ROPE_LENGTH(rope->root) : 0;
+}
@@ -0,0 +1,309 @@
+/*** LICENSE: LGPLV2. *************************************
+ *                                                        *
+ *                                                        *
+ * This file is a part of the j2 project.                 *
+ * Copyright (C) 2022 Joško Križanović                    *
+ * <jkriza02@fesb.com>                                    *
+ *                                                        *
+ * This library is free software; you can redistribute    *
+ * it and/or modify it under the terms of the GNU Lesser  *
+ * General Public License as published by the Free        *
+ * Software Foundation; either version 2.1 of the         *
+ * License, or (at your option) any later version.        *
+ *                                                        *
+ * This library is distributed in the hope that it will   *
+ * be useful,                                             *
+ * but WITHOUT ANY WARRANTY; without even the implied     *
+ * warranty of MERCHANTABILITY or FITNESS FOR A           *
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public  *
+ * License for more details.                              *
+ *                                                        *
+ * You should have received a copy of the GNU Lesser      *
+ * General Public License along with this library; if     *
+ * not, write to the Free Software Foundation, Inc.,      *
+ * 51 Franklin Street, Fifth Floor, Boston,               *
+ * MA  02110-1301  USA                                    *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: FILE, AUTHOR & DATE INFORMATION. *********
+ *                                                        *
+ *                                                        *
+ * FILE:                                                  *
+ * Reading ropes back into j2strings, splitting and       *
+ * joining whole ropes.                                   *
+ *                                                        *
+ *                                                        *
+ * AUTHOR:                                                *
+ *      NAME:  Joško Križanović                           *
+ *      EMAIL: jkriza02@fesb.com                          *
+ *                                                        *
+ *                                                        *
+ * DATE:                                                  *
+ * 19.10.2026.                                            *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+#include "../rope.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+
+/**
+ * @brief 
+ * Byte offset of the character at @c "position" in the subtree @c "node".
+ */
+static size_t
+slice_offset(
+        const struct j2rope_node * node,
+        size_t position )
+{
+
+        size_t offset = 0;
+
+        while(node) {
+                size_t before = J2_ROPE_LENGTH(node->left);
+                const struct j2string_st * info = J2_STRING_INFO(node->chunk);
+                if(position < before) {
+                        node = node->left;
+                } else if(position <= before + info->length) {
+                        return offset + J2_ROPE_BYTES(node->left)
+                             + j2rope_chunk_offset(
+                                   node->chunk, position - before);
+                } else {
+                        position -= before + info->length;
+                        offset   += J2_ROPE_BYTES(node->left) + info->filled;
+                        node      = node->right;
+                }
+        }
+
+        return offset;
+
+}
+
+/**
+ * @brief 
+ * Copy the bytes @c "[from, to)" of the subtree @c "node" into @c "out".
+ */
+static void
+slice_copy(
+        const struct j2rope_node * node,
+        size_t from,
+        size_t to,
+        char * out )
+{
+
+        while(node && from < to) {
+
+                size_t before = J2_ROPE_BYTES(node->left);
+                size_t here   = J2_STRING_INFO(node->chunk)->filled;
+
+                if(from < before) 
+                        slice_copy(node->left, from, 
+                                   to < before ? to : before, out);
+
+                if(to > before && from < before + here) {
+                        size_t a = from > before ? from - before : 0;
+                        size_t b = to - before < here ? to - before : here;
+                        memcpy(out + (before + a - from), node->chunk + a, 
+                               b - a);
+                }
+
+                if(to <= before + here) return;
+
+                /// Continue into the right subtree without recursing.
+                size_t skip = before + here;
+                if(from < skip) {
+                        out += skip - from;
+                        from = skip;
+                }
+                from -= skip;
+                to   -= skip;
+                node  = node->right;
+
+        }
+
+}
+
+/**
+ * @fn @c j2rope_slice(3)
+ * 
+ *      @brief Copy @c "count" characters of @c "rope" starting with the one
+ *      at @c "position" into a new j2string.
+ * 
+ * 
+ *      @param @b rope
+ *             The rope to read from.
+ * 
+ *      @param @b position
+ *             Character position of the first copied character.
+ * 
+ *      @param @b count
+ *             Amount of characters to copy, clamped to the end of the rope.
+ * 
+ * 
+ *      @throw @a EINVAL - If @c "rope" is a NULL ptr.
+ *      @throw @a ENOMEM - Exhausted all memory spaces.
+ * 
+ * 
+ *      @returns A dynamic j2string with the copied text whose @c max fits
+ *      it even past J2_STRING_MAX_SIZE, NULL on failure.
+ * 
+ */
+j2string
+j2rope_slice(
+        const j2rope * rope,
+        size_t position,
+        size_t count )
+{
+
+#ifdef __J2_DEV__
+        if(!rope) {
+                errno = EINVAL;
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2rope_slice() / j2.rope.slice()"
+                        " parameter rope is a NULL ptr.");
+                return NULL;
+        }
+#endif
+
+        size_t total = J2_ROPE_LENGTH(rope->root);
+        if(position > total) position = total;
+        if(count > total - position) count = total - position;
+
+        size_t from = slice_offset(rope->root, position);
+        size_t to   = slice_offset(rope->root, position + count);
+        size_t size = to - from;
+
+        j2string string = j2string_allocate((j2string_param){
+                .allocate = size + 1,
+                .padding  = 1,
+                .max      = size + 1 > J2_STRING_MAX_SIZE ? 
+                            size + 1 : J2_STRING_MAX_SIZE
+        });
+        if(!string) {
+                errno = ENOMEM;
+                return NULL;
+        }
+
+        slice_copy(rope->root, from, to, string);
+        string[size] = '\0';
+
+        struct j2string_st * info = J2_STRING_INFO(string);
+        info->filled = size;
+        info->length = count;
+
+        return string;
+
+}
+
+/**
+ * @fn @c j2rope_flatten(1)
+ * 
+ *      @brief Copy the whole @c "rope" into a new j2string.
+ * 
+ * 
+ *      @throw @a EINVAL - If @c "rope" is a NULL ptr.
+ *      @throw @a ENOMEM - Exhausted all memory spaces.
+ * 
+ * 
+ *      @returns Same as @c j2rope_slice(3).
+ * 
+ */
+j2string
+j2rope_flatten(
+        const j2rope * rope )
+{
+        return j2rope_slice(rope, 0, SIZE_MAX);
+}
+
+/**
+ * @fn @c j2rope_split(2)
+ * 
+ *      @brief Move everything from the character at @c "position" onwards
+ *      out of @c "rope" into a new rope, O(log n).
+ * 
+ * 
+ *      @param @b rope
+ *             The rope to split, keeps the characters before 
+ *             @c "position".
+ * 
+ *      @param @b position
+ *             Character position to split at.
+ * 
+ * 
+ *      @throw @a EINVAL - If @c "rope" is a NULL ptr.
+ *      @throw @a ENOMEM - Exhausted all memory spaces, @c "rope" stays as it
+ *                         was.
+ * 
+ * 
+ *      @returns The new rope or NULL on failure.
+ * 
+ */
+j2rope *
+j2rope_split(
+        j2rope * rope,
+        size_t position )
+{
+
+#ifdef __J2_DEV__
+        if(!rope) {
+                errno = EINVAL;
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2rope_split() / j2.rope.split()"
+                        " parameter rope is a NULL ptr.");
+                return NULL;
+        }
+#endif
+
+        j2rope * tail = j2rope_new(NULL);
+        if(!tail) return NULL;
+
+        if(j2rope_node_split(rope->root, position, &rope->root, &tail->root)) {
+                j2rope_free(tail);
+                return NULL;
+        }
+
+        return tail;
+
+}
+
+/**
+ * @fn @c j2rope_concat(2)
+ * 
+ *      @brief Append all of @c "src" to the end of @c "dst", O(log n).
+ *      The rope @c "src" is consumed and freed.
+ * 
+ * 
+ *      @throw @a EINVAL - If @c "dst" is a NULL ptr.
+ * 
+ * 
+ *      @returns Nothing.
+ * 
+ */
+void
+j2rope_concat(
+        j2rope * dst,
+        j2rope * src )
+{
+
+#ifdef __J2_DEV__
+        if(!dst) {
+                errno = EINVAL;
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2rope_concat() / j2.rope.concat()"
+                        " parameter dst is a NULL ptr.");
+                return;
+        }
+#endif
+
+        if(!src || src == dst) return;
+
+        dst->root = j2rope_node_merge(dst->root, src->root);
+        free(src);
+
+}
@@ -0,0 +1,164 @@
+/*** LICENSE: LGPLV2. *************************************
+ *                                                        *
+ *                                                        *
+ * This file is a part of the j2 project.                 *
+ * Copyright (C) 2022 Joško Križanović                    *
+ * <jkriza02@fesb.com>                                    *
+ *                                                        *
+ * This library is free software; you can redistribute    *
+ * it and/or modify it under the terms of the GNU Lesser  *
+ * General Public License as published by the Free        *
+ * Software Foundation; either version 2.1 of the         *
+ * License, or (at your option) any later version.        *
+ *                                                        *
+ * This library is distributed in the hope that it will   *
+ * be useful,                                             *
+ * but WITHOUT ANY WARRANTY; without even the implied     *
+ * warranty of MERCHANTABILITY or FITNESS FOR A           *
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public  *
+ * License for more details.                              *
+ *                                                        *
+ * You should have received a copy of the GNU Lesser      *
+ * General Public License along with this library; if     *
+ * not, write to the Free Software Foundation, Inc.,      *
+ * 51 Franklin Street, Fifth Floor, Boston,               *
+ * MA  02110-1301  USA                                    *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: FILE, AUTHOR & DATE INFORMATION. *********
+ *                                                        *
+ *                                                        *
+ * FILE:                                                  *
+ * Writing a rope out to a file descriptor, chunk by      *
+ * chunk.                                                 *
+ *                                                        *
+ *                                                        *
+ * AUTHOR:                                                *
+ *      NAME:  Joško Križanović                           *
+ *      EMAIL: jkriza02@fesb.com                          *
+ *                                                        *
+ *                                                        *
+ * DATE:                                                  *
+ * 19.10.2026.                                            *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+#include "../rope.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <errno.h>
+
+/**
+ * @brief 
+ * Chunks j2rope_write() hands to a single j2string_writev().
+ */
+#define WRITE_BATCH 256
+
+/**
+ * @brief 
+ * Chunks gathered by write_gather() that still have to be written.
+ */
+struct write_batch {
+        const_j2string chunk[WRITE_BATCH];
+        size_t used;
+        size_t bytes;
+        size_t done;
+        int fd;
+        bool failed;
+};
+
+/**
+ * @brief 
+ * Write out the chunks of @c "batch", false if not all of them went out.
+ */
+static bool
+write_flush(
+        struct write_batch * batch )
+{
+
+        long wrote = j2string_writev(batch->fd, batch->chunk, batch->used);
+        if(wrote > 0) batch->done += (size_t)wrote;
+
+        bool whole = wrote >= 0 && (size_t)wrote == batch->bytes;
+        batch->used  = 0;
+        batch->bytes = 0;
+        if(!whole) batch->failed = true;
+
+        return whole;
+
+}
+
+/**
+ * @brief 
+ * Add the chunks of the subtree @c "node" to @c "batch" in order, writing
+ * it out every time it fills up.
+ */
+static void
+write_gather(
+        const struct j2rope_node * node,
+        struct write_batch * batch )
+{
+
+        while(node && !batch->failed) {
+
+                write_gather(node->left, batch);
+                if(batch->failed) return;
+
+                batch->chunk[batch->used++] = node->chunk;
+                batch->bytes += J2_STRING_INFO(node->chunk)->filled;
+                if(batch->used == WRITE_BATCH && !write_flush(batch)) 
+                        return;
+
+                /// Continue into the right subtree without recursing.
+                node = node->right;
+
+        }
+
+}
+
+/**
+ * @fn @c j2rope_write(2)
+ * 
+ *      @brief Write the whole @c "rope" to @c "fd" with j2string_writev(),
+ *      its chunks go out as they are instead of being flattened into one
+ *      string first.
+ * 
+ * 
+ *      @throw @a EINVAL - If @c "rope" is a NULL ptr.
+ *      @throw @a ...    - Anything j2string_writev() throws.
+ * 
+ * 
+ *      @returns Amount of bytes written. If an error stops it after some
+ *      bytes went out it returns how many did with errno set, -1 if none 
+ *      did.
+ * 
+ */
+long
+j2rope_write(
+        const j2rope * rope,
+        int fd )
+{
+
+#ifdef __J2_DEV__
+        if(!rope) {
+                errno = EINVAL;
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2rope_write() / j2.rope.write()"
+                        " parameter rope is a NULL ptr.");
+                return -1;
+        }
+#endif
+
+        struct write_batch batch = { .fd = fd };
+
+        write_gather(rope->root, &batch);
+        if(!batch.failed && batch.used) write_flush(&batch);
+
+        if(batch.failed && !batch.done) return -1;
+        return (long)batch.done;
+
+}
@@ -1,12 +1,304 @@
-#define push(sp, n) (*((sp)++) = (n))
-#define pop(sp) (*--(sp))
+/*** LICENSE: LGPLV2. *************************************
+ *                                                        *
+ *                                                        *
+ * This file is a part of the j2 project.                 *
+ * Copyright (C) 2022 Joško Križanović                    *
+ * <jkriza02@fesb.com>                                    *
+ *                                                        *
+ * This library is free software; you can redistribute    *
+ * it and/or modify it under the terms of the GNU Lesser  *
+ * General Public License as published by the Free        *
+ * Software Foundation; either version 2.1 of the         *
+ * License, or (at your option) any later version.        *
+ *                                                        *
+ * This library is distributed in the hope that it will   *
+ * be useful,                                             *
+ * but WITHOUT ANY WARRANTY; without even the implied     *
+ * warranty of MERCHANTABILITY or FITNESS FOR A           *
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public  *
+ * License for more details.                              *
+ *                                                        *
+ * You should have received a copy of the GNU Lesser      *
+ * General Public License along with this library; if     *
+ * not, write to the Free Software Foundation, Inc.,      *
+ * 51 Franklin Street, Fifth Floor, Boston,               *
+ * MA  02110-1301  USA                                    *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
 
-struct j2stack {
+/*** INTRODUCTION: ****************************************
+ *                                                        *
+ *                                                        *
+ * stack.h is a header only library of growable stacks   *
+ * that keep their elements inline, typed by the macro    *
+ * that defines them.                                     *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
 
-        int size;
-        int filled;
-        void ** array;
+/*** INSCRIBING: FILE, AUTHOR & DATE INFORMATION. *********
+ *                                                        *
+ *                                                        *
+ * FILE:                                                  *
+ * Implementation.                                        *
+ *                                                        *
+ *                                                        *
+ * AUTHOR:                                                *
+ *      NAME:  Joško Križanović                           *
+ *      EMAIL: jkriza02@fesb.com                          *
+ *                                                        *
+ *                                                        *
+ * DATE:                                                  *
+ * 19.10.2026.                                            *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
 
-};
+/*** INSCRIBING: COMPATIBILITY. ***************************
+ *                                                        *
+ *                                                        *
+ * C:                                                     *
+ * This library is written in compliance to the limited   *
+ * functionality at the disposal of the C99 standard.     *
+ *                                                        *
+ *                                                        *
+ * POSIX:                                                 *
+ * This libraries creator has yet to inscribe the minimum *
+ * POSIX compatibilty version that this library requires. *
+ * In its absance the user of the library is free to use  *
+ * any compatibilty version of the POSIX standard that is *
+ * deemed to work through trial and error.                *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
 
-int j2stack_push( )
\ No newline at end of file
+/*** INSCRIBING: USED NAMESPACE ***************************
+ *                                                        *
+ *                                                        *
+ * Used namespaces, ... indicates that all characters     *
+ * that come after do not belong to that namespace:       *
+ * -> j2stack...                                          *
+ * -> J2_STACK...                                         *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: EXTERNAL FILES CALLED & PURPOSE **********
+ *                                                        *
+ *                                                        *
+ * Name                     Description                   *
+ * ----                     -----------                   *
+ * <stdlib.h>               malloc, realloc and free      *
+ *                                                        *
+ * <string.h>               memcpy for bulk pushes and    *
+ *                          pops                          *
+ *                                                        *
+ * <errno.h>                ENOMEM and ERANGE             *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: DEVELOPMENT HISTORY/VERSIONS PUBLISHED ***
+ *                                                        *
+ *                                                        *
+ * Author  Release & Date  Description of modifications   *
+ * ------  --------------  ----------------------------   *
+ * josko3  V0.0            Inital creation.               *
+ * 567     19.10.2026.                                    *
+ * ------  --------------  ----------------------------   *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#include "diag/diag.h"
+
+#ifndef J2_STACK_INCLUDE
+#define J2_STACK_INCLUDE
+
+/**
+ * @brief 
+ * Default amount of elements a stack keeps inside of itself before it 
+ * allocates, enough for most expression nesting.
+ */
+#define J2_STACK_SMALL 16
+
+#ifdef __J2_DEV__
+#define J2_STACK_UNDERFLOW(stack, count, function, fail)                       \
+        if((stack)->filled < (count)) {                                        \
+                errno = ERANGE;                                                \
+                J2_DIAG(J2_DIAG_UNDERFLOW,                                     \
+                        function "() popped more elements"                     \
+                        " than the stack holds.");                             \
+                return fail;                                                   \
+        }
+#else
+#define J2_STACK_UNDERFLOW(stack, count, function, fail)
+#endif
+
+/**
+ * @def @c J2_STACK_DEFINE(3)
+ * 
+ *      @brief Define @c "struct name" holding elements of @c "type" and 
+ *      its static inline functions, all prefixed with @c "name_". The 
+ *      first @c "small" (at least 1) elements live inside of the struct,
+ *      past that the stack moves to the heap and doubles whenever full.
+ * 
+ *      The array points into the struct while it is small, so a stack 
+ *      must not be copied by value, pass it around by pointer.
+ * 
+ *      @example
+ *      J2_STACK_DEFINE(operands, double, 32)
+ * 
+ *      struct operands stack;
+ *      operands_init(&stack);
+ *      operands_push(&stack, 1.0);
+ *      operands_push(&stack, 2.0);
+ *      operands_push(&stack, operands_pop(&stack) + operands_pop(&stack));
+ *      operands_free(&stack);
+ * 
+ *      @functions
+ *      - @c name_init(1)    Empty stack using the inline buffer.
+ *      - @c name_free(1)    Free the heap array, the stack is empty after.
+ *      - @c name_reserve(2) Make room for a total of @c "count" elements.
+ *      - @c name_push(2)    Push one element, 0 or -1 on ENOMEM.
+ *      - @c name_pop(1)     Pop and return the top element.
+ *      - @c name_top(1)     Pointer to the top element or NULL if empty.
+ *      - @c name_push_n(3)  Push @c "count" elements from an array.
+ *      - @c name_pop_n(3)   Pop @c "count" elements into an array, bottom
+ *                           most first, so push_n(pop_n()) is a no op.
+ *      - @c name_count(1)   Amount of elements.
+ * 
+ */
+#define J2_STACK_DEFINE(name, type, small)                                     \
+                                                                               \
+struct name {                                                                  \
+        type * array;                                                          \
+        size_t filled;                                                         \
+        size_t capacity;                                                       \
+        type inline_buffer[small];                                             \
+};                                                                             \
+                                                                               \
+static inline void                                                             \
+name##_init(                                                                   \
+        struct name * stack )                                                  \
+{                                                                              \
+        stack->array    = stack->inline_buffer;                                \
+        stack->filled   = 0;                                                   \
+        stack->capacity = (small);                                             \
+}                                                                              \
+                                                                               \
+static inline void                                                             \
+name##_free(                                                                   \
+        struct name * stack )                                                  \
+{                                                                              \
+        if(stack->array != stack->inline_buffer) free(stack->array);           \
+        name##_init(stack);                                                    \
+}                                                                              \
+                                                                               \
+static inline int                                                              \
+name##_reserve(                                                                \
+        struct name * stack,                                                   \
+        size_t count )                                                         \
+{                                                                              \
+        if(count <= stack->capacity) return 0;                                 \
+                                                                               \
+        size_t capacity = stack->capacity * 2;                                 \
+        if(capacity < count) capacity = count;                                 \
+                                                                               \
+        type * array;                                                          \
+        if(stack->array == stack->inline_buffer) {                             \
+                array = malloc(capacity * sizeof(type));                       \
+                if(array)                                                      \
+                        memcpy(array, stack->array,                            \
+                               stack->filled * sizeof(type));                  \
+        }                                                                      \
+        else array = realloc(stack->array, capacity * sizeof(type));           \
+                                                                               \
+        if(!array) {                                                           \
+                errno = ENOMEM;                                                \
+                return -1;                                                     \
+        }                                                                      \
+                                                                               \
+        stack->array    = array;                                               \
+        stack->capacity = capacity;                                            \
+        return 0;                                                              \
+}                                                                              \
+                                                                               \
+static inline int                                                              \
+name##_push(                                                                   \
+        struct name * stack,                                                   \
+        type value )                                                           \
+{                                                                              \
+        if(stack->filled == stack->capacity                                    \
+        && name##_reserve(stack, stack->filled + 1))                           \
+                return -1;                                                     \
+                                                                               \
+        stack->array[stack->filled++] = value;                                 \
+        return 0;                                                              \
+}                                                                              \
+                                                                               \
+static inline type                                                             \
+name##_pop(                                                                    \
+        struct name * stack )                                                  \
+{                                                                              \
+        J2_STACK_UNDERFLOW(stack, 1, #name "_pop", (type){0});                 \
+        return stack->array[--stack->filled];                                  \
+}                                                                              \
+                                                                               \
+static inline type *                                                           \
+name##_top(                                                                    \
+        struct name * stack )                                                  \
+{                                                                              \
+        return stack->filled ? &stack->array[stack->filled - 1] : NULL;        \
+}                                                                              \
+                                                                               \
+static inline int                                                              \
+name##_push_n(                                                                 \
+        struct name * stack,                                                   \
+        const type * values,                                                   \
+        size_t count )                                                         \
+{                                                                              \
+        if(name##_reserve(stack, stack->filled + count)) return -1;            \
+                                                                               \
+        memcpy(stack->array + stack->filled, values, count * sizeof(type));    \
+        stack->filled += count;                                                \
+        return 0;                                                              \
+}                                                                              \
+                                                                               \
+static inline int                                                              \
+name##_pop_n(                                                                  \
+        struct name * stack,                                                   \
+        type * values,                                                         \
+        size_t count )                                                         \
+{                                                                              \
+        J2_STACK_UNDERFLOW(stack, count, #name "_pop_n", -1);                  \
+        stack->filled -= count;                                                \
+        if(values)                                                             \
+                memcpy(values, stack->array + stack->filled,                   \
+                       count * sizeof(type));                                  \
+        return 0;                                                              \
+}                                                                              \
+                                                                               \
+static inline size_t                                                           \
+name##_count(                                                                  \
+        const struct name * stack )                                            \
+{                                                                              \
+        return stack->filled;                                                  \
+}
+
+/**
+ * @struct @c j2stack
+ * 
+ *      @brief Stack of pointers, for when the elements don't have a type 
+ *      of their own. Made by J2_STACK_DEFINE(3) like any other.
+ * 
+ */
+J2_STACK_DEFINE(j2stack, void *, J2_STACK_SMALL)
+
+#endif /** @c J2_STACK_INCLUDE */
@@ -0,0 +1,309 @@
+/*** LICENSE: LGPLV2. *************************************
+ *                                                        *
+ *                                                        *
+ * This file is a part of the j2 project.                 *
+ * Copyright (C) 2022 Joško Križanović                    *
+ * <jkriza02@fesb.com>                                    *
+ *                                                        *
+ * This library is free software; you can redistribute    *
+ * it and/or modify it under the terms of the GNU Lesser  *
+ * General Public License as published by the Free        *
+ * Software Foundation; either version 2.1 of the         *
+ * License, or (at your option) any later version.        *
+ *                                                        *
+ * This library is distributed in the hope that it will   *
+ * be useful,                                             *
+ * but WITHOUT ANY WARRANTY; without even the implied     *
+ * warranty of MERCHANTABILITY or FITNESS FOR A           *
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public  *
+ * License for more details.                              *
+ *                                                        *
+ * You should have received a copy of the GNU Lesser      *
+ * General Public License along with this library; if     *
+ * not, write to the Free Software Foundation, Inc.,      *
+ * 51 Franklin Street, Fifth Floor, Boston,               *
+ * MA  02110-1301  USA                                    *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: FILE, AUTHOR & DATE INFORMATION. *********
+ *                                                        *
+ *                                                        *
+ * FILE:                                                  *
+ * Per thread registry and aggregation of the statistics  *
+ * counters.                                              *
+ *                                                        *
+ *                                                        *
+ * AUTHOR:                                                *
+ *      NAME:  Joško Križanović                           *
+ *      EMAIL: jkriza02@fesb.com                          *
+ *                                                        *
+ *                                                        *
+ * DATE:                                                  *
+ * 19.10.2026.                                            *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+
+#include "../stats.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <errno.h>
+
+#ifdef J2_STATS
+#include <pthread.h>
+#endif
+
+static const char * const stats_names[J2_STATS_COUNTERS] = {
+        [J2_STATS_ALLOC]        = "allocations",
+        [J2_STATS_FREE]         = "frees",
+        [J2_STATS_REALLOC]      = "reallocations",
+        [J2_STATS_GROW]         = "grows",
+        [J2_STATS_SHRINK]       = "shrinks",
+        [J2_STATS_BYTES_COPIED] = "bytes_copied",
+        [J2_STATS_UTF8_SLOW]    = "utf8_slow_chunks"
+};
+
+#ifdef J2_STATS
+
+_Thread_local struct j2stats_block * j2stats_local = NULL;
+
+/**
+ * @brief 
+ * Every live thread that counted something, the totals of threads that 
+ * exited since and the sums at the last reset. All under @c "stats_lock".
+ */
+static pthread_mutex_t        stats_lock    = PTHREAD_MUTEX_INITIALIZER;
+static struct j2stats_block * stats_threads = NULL;
+static j2stats                stats_retired;
+static j2stats                stats_baseline;
+
+static pthread_once_t         stats_once    = PTHREAD_ONCE_INIT;
+static pthread_key_t          stats_key;
+
+/**
+ * @brief 
+ * Thread exit, fold the counters of the thread into the retired totals.
+ */
+static void
+stats_retire(
+        void * pointer )
+{
+
+        struct j2stats_block * block = pointer;
+
+        pthread_mutex_lock(&stats_lock);
+
+        struct j2stats_block ** link = &stats_threads;
+        while(*link && *link != block) link = &(*link)->next;
+        if(*link) (*link) = block->next;
+
+        for(size_t i = 0; i < J2_STATS_COUNTERS; i++) 
+                stats_retired.counters[i] += atomic_load_explicit(
+                        &block->counters[i], memory_order_relaxed);
+
+        pthread_mutex_unlock(&stats_lock);
+
+        /// Destructors of other keys may still count something, they have 
+        /// to register a new block instead of writing into a freed one.
+        j2stats_local = NULL;
+        free(block);
+
+}
+
+static void
+stats_init(
+        void )
+{
+        pthread_key_create(&stats_key, &stats_retire);
+}
+
+/**
+ * @fn @c j2stats_register(0)
+ * 
+ *      @brief Give the calling thread its counters and link them into the
+ *      registry, called by the first j2stats_add() of every thread.
+ * 
+ *      @returns The counters or NULL if they couldn't be allocated, the 
+ *      thread then isn't counted.
+ * 
+ */
+struct j2stats_block *
+j2stats_register(
+        void )
+{
+
+        pthread_once(&stats_once, &stats_init);
+
+        struct j2stats_block * block = calloc(1, sizeof(*block));
+        if(!block) return NULL;
+
+        pthread_mutex_lock(&stats_lock);
+        block->next   = stats_threads;
+        stats_threads = block;
+        pthread_mutex_unlock(&stats_lock);
+
+        pthread_setspecific(stats_key, block);
+        j2stats_local = block;
+
+        return block;
+
+}
+
+/**
+ * @brief 
+ * Sum of every counter since the start, @c "stats_lock" must be held.
+ */
+static void
+stats_total(
+        j2stats * total )
+{
+
+        (*total) = stats_retired;
+
+        for(struct j2stats_block * block = stats_threads; block; 
+            block = block->next) 
+                for(size_t i = 0; i < J2_STATS_COUNTERS; i++) 
+                        total->counters[i] += atomic_load_explicit(
+                                &block->counters[i], memory_order_relaxed);
+
+}
+
+#endif
+
+/**
+ * @fn @c j2stats_enabled(0)
+ * 
+ *      @brief Whether the library was compiled with J2_STATS, without it
+ *      every counter stays 0.
+ * 
+ */
+bool
+j2stats_enabled(
+        void )
+{
+#ifdef J2_STATS
+        return true;
+#else
+        return false;
+#endif
+}
+
+/**
+ * @fn @c j2stats_snapshot(1)
+ * 
+ *      @brief Sum the counters of all threads, live and exited, since the 
+ *      last j2stats_reset(). Threads keep counting while it is taken so 
+ *      the counters are not all from the exact same moment.
+ * 
+ * 
+ *      @throw @a EINVAL - If @c "stats" is a NULL ptr.
+ * 
+ */
+void
+j2stats_snapshot(
+        j2stats * stats )
+{
+
+#ifdef __J2_DEV__
+        if(!stats) {
+                errno = EINVAL;
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2stats_snapshot() /"
+                        " j2.stats.snapshot() parameter stats"
+                        " is a NULL ptr.");
+                return;
+        }
+#endif
+
+        (*stats) = (j2stats){0};
+
+#ifdef J2_STATS
+        pthread_mutex_lock(&stats_lock);
+        stats_total(stats);
+        for(size_t i = 0; i < J2_STATS_COUNTERS; i++) 
+                stats->counters[i] -= stats_baseline.counters[i];
+        pthread_mutex_unlock(&stats_lock);
+#endif
+
+}
+
+/**
+ * @fn @c j2stats_reset(0)
+ * 
+ *      @brief Start counting from 0 again. The counters of the threads 
+ *      are left alone, only their current sums are remembered and taken 
+ *      off of later snapshots.
+ * 
+ */
+void
+j2stats_reset(
+        void )
+{
+#ifdef J2_STATS
+        pthread_mutex_lock(&stats_lock);
+        stats_total(&stats_baseline);
+        pthread_mutex_unlock(&stats_lock);
+#endif
+}
+
+/**
+ * @fn @c j2stats_name(1)
+ * 
+ *      @brief Name of a counter, e.g. "bytes_copied".
+ * 
+ *      @returns The name or NULL for an unknown counter.
+ * 
+ */
+const char *
+j2stats_name(
+        enum j2stats_counter counter )
+{
+        return (unsigned)counter < J2_STATS_COUNTERS ? 
+                stats_names[counter] : NULL;
+}
+
+/**
+ * @fn @c j2stats_dump(1)
+ * 
+ *      @brief Write a snapshot to @c "stream" in the Prometheus text 
+ *      format, one @c j2_<name>_total counter per line.
+ * 
+ * 
+ *      @throw @a EINVAL - If @c "stream" is a NULL ptr.
+ * 
+ * 
+ *      @returns 0 on success, -1 if writing failed.
+ * 
+ */
+int
+j2stats_dump(
+        FILE * stream )
+{
+
+#ifdef __J2_DEV__
+        if(!stream) {
+                errno = EINVAL;
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2stats_dump() / j2.stats.dump()"
+                        " parameter stream is a NULL ptr.");
+                return -1;
+        }
+#endif
+
+        j2stats stats;
+        j2stats_snapshot(&stats);
+
+        for(size_t i = 0; i < J2_STATS_COUNTERS; i++) {
+                if(fprintf(stream, "# TYPE j2_%s_total counter\n"
+                                   "j2_%s_total %llu\n", 
+                           stats_names[i], stats_names[i],
+                           (unsigned long long)stats.counters[i]) < 0)
+                        return -1;
+        }
+
+        return 0;
+
+}
@@ -0,0 +1,260 @@
+/*** LICENSE: LGPLV2. *************************************
+ *                                                        *
+ *                                                        *
+ * This file is a part of the j2 project.                 *
+ * Copyright (C) 2022 Joško Križanović                    *
+ * <jkriza02@fesb.com>                                    *
+ *                                                        *
+ * This library is free software; you can redistribute    *
+ * it and/or modify it under the terms of the GNU Lesser  *
+ * General Public License as published by the Free        *
+ * Software Foundation; either version 2.1 of the         *
+ * License, or (at your option) any later version.        *
+ *                                                        *
+ * This library is distributed in the hope that it will   *
+ * be useful,                                             *
+ * but WITHOUT ANY WARRANTY; without even the implied     *
+ * warranty of MERCHANTABILITY or FITNESS FOR A           *
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public  *
+ * License for more details.                              *
+ *                                                        *
+ * You should have received a copy of the GNU Lesser      *
+ * General Public License along with this library; if     *
+ * not, write to the Free Software Foundation, Inc.,      *
+ * 51 Franklin Street, Fifth Floor, Boston,               *
+ * MA  02110-1301  USA                                    *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: FILE, AUTHOR & DATE INFORMATION. *********
+ *                                                        *
+ *                                                        *
+ * FILE:                                                  *
+ * Opt-in statistics of allocations, reallocations, grow  *
+ * and shrink events, bytes copied and UTF-8 slow path    *
+ * hits, counted per thread and summed on demand.         *
+ * Compiled in with -DJ2_STATS (make STATS=t), otherwise  *
+ * every hook is empty.                                   *
+ *                                                        *
+ *                                                        *
+ * AUTHOR:                                                *
+ *      NAME:  Joško Križanović                           *
+ *      EMAIL: jkriza02@fesb.com                          *
+ *                                                        *
+ *                                                        *
+ * DATE:                                                  *
+ * 19.10.2026.                                            *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: COMPATIBILITY. ***************************
+ *                                                        *
+ *                                                        *
+ * C:                                                     *
+ * This library is written in compliance to the limited   *
+ * functionality at the disposal of the C99 standard.     *
+ *                                                        *
+ *                                                        *
+ * POSIX:                                                 *
+ * Threads are registered under a pthread mutex, their    *
+ * counters are C11 atomics only their own thread writes. *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: USED NAMESPACE ***************************
+ *                                                        *
+ *                                                        *
+ * Used namespaces, ... indicates that all characters     *
+ * that come after do not belong to that namespace:       *
+ * -> j2stats...                                          *
+ * -> J2_STATS...                                         *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: EXTERNAL FILES CALLED & PURPOSE **********
+ *                                                        *
+ *                                                        *
+ * Name                     Description                   *
+ * ----                     -----------                   *
+ * <stdint.h>               fixed size integers           *
+ *                                                        *
+ * <stdbool.h>              booleans                      *
+ *                                                        *
+ * <stdio.h>                FILE for dumping              *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: DEVELOPMENT HISTORY/VERSIONS PUBLISHED ***
+ *                                                        *
+ *                                                        *
+ * Author  Release & Date  Description of modifications   *
+ * ------  --------------  ----------------------------   *
+ * josko3  V0.0            Inital creation.               *
+ * 567     19.10.2026.                                    *
+ * ------  --------------  ----------------------------   *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#ifdef J2_STATS
+#include <stdatomic.h>
+#endif
+
+#include "../diag/diag.h"
+
+#ifndef J2_STATS_INCLUDE
+#define J2_STATS_INCLUDE
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @enum @c j2stats_counter
+ * 
+ *      @brief What is counted.
+ * 
+ *      @tparam @b J2_STATS_ALLOC
+ *      Blocks allocated by j2string_allocate().
+ *      @tparam @b J2_STATS_FREE
+ *      Blocks released by j2string_free().
+ *      @tparam @b J2_STATS_REALLOC
+ *      Calls to realloc() of a string, of any size.
+ *      @tparam @b J2_STATS_GROW
+ *      A string or a container was made bigger.
+ *      @tparam @b J2_STATS_SHRINK
+ *      A string or a container was made smaller.
+ *      @tparam @b J2_STATS_BYTES_COPIED
+ *      Bytes moved by the copy primitives every cpy, cat and their 
+ *      variants go through.
+ *      @tparam @b J2_STATS_UTF8_SLOW
+ *      8 byte chunks the UTF-8 readers had to go through byte by byte 
+ *      because they held non ASCII characters.
+ * 
+ */
+enum j2stats_counter {
+
+        J2_STATS_ALLOC,
+        J2_STATS_FREE,
+        J2_STATS_REALLOC,
+        J2_STATS_GROW,
+        J2_STATS_SHRINK,
+        J2_STATS_BYTES_COPIED,
+        J2_STATS_UTF8_SLOW,
+        J2_STATS_COUNTERS
+
+};
+
+/**
+ * @struct @c j2stats
+ * 
+ *      @brief Snapshot of every counter, summed over all threads since the
+ *      last j2stats_reset().
+ * 
+ */
+typedef struct j2stats {
+
+        uint64_t counters[J2_STATS_COUNTERS];
+
+} j2stats;
+
+#ifdef J2_STATS
+
+/**
+ * @struct @c j2stats_block
+ * 
+ *      @brief Counters of one thread. Only its own thread writes them, 
+ *      with a relaxed load and store instead of a locked add, everybody
+ *      else only reads them.
+ * 
+ */
+struct j2stats_block {
+
+        _Atomic uint64_t counters[J2_STATS_COUNTERS];
+        struct j2stats_block * next;
+
+};
+
+extern _Thread_local struct j2stats_block * j2stats_local;
+
+struct j2stats_block *
+j2stats_register(
+        void
+);
+
+/**
+ * @fn @c j2stats_add(2)
+ * 
+ *      @brief Add @c "amount" to a counter of the calling thread, the 
+ *      first call of a thread registers its counters.
+ * 
+ */
+static inline void
+j2stats_add(
+        enum j2stats_counter counter,
+        uint64_t amount )
+{
+
+        struct j2stats_block * block = j2stats_local;
+        if(!block && !(block = j2stats_register())) return;
+
+        uint64_t value = atomic_load_explicit(&block->counters[counter],
+                                              memory_order_relaxed);
+        atomic_store_explicit(&block->counters[counter], value + amount,
+                              memory_order_relaxed);
+
+}
+
+/**
+ * @brief 
+ * Count an event, nothing at all without J2_STATS. The arguments are not
+ * evaluated then either.
+ */
+#define J2_STATS_ADD(counter, amount) j2stats_add((counter), (amount))
+
+#else
+
+#define J2_STATS_ADD(counter, amount) ((void)0)
+
+#endif
+
+bool
+j2stats_enabled(
+        void
+);
+
+void
+j2stats_snapshot(
+        j2stats * stats
+);
+
+void
+j2stats_reset(
+        void
+);
+
+const char *
+j2stats_name(
+        enum j2stats_counter counter
+);
+
+int
+j2stats_dump(
+        FILE * stream
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /** @c J2_STATS_INCLUDE */
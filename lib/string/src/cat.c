@@ -46,14 +46,12 @@
  *********************************************************/
 
 #include "../string.h"
+#include "../utf8.h"
+#include "sink.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <errno.h>
 
-#ifdef __J2_DEV__
-#include "../../../ext/viwerr/viwerr.h"
-#endif
-
 /*******************************************************************************
  * @fn @c j2string_cat(2)
  * 
@@ -86,24 +84,16 @@ j2string_cat(
 #ifdef __J2_DEV__
         if(!dst || !src) {
                 errno = EINVAL;
-                viwerr(VIWERR_PUSH, &(viwerr_package){
-                        .code    = EINVAL,
-                        .group   = (char*)"j2",
-                        .name    = (char*)"j2err: Invalid parameter...",
-                        .message = (char*)"j2string_cat() / j2.string.cat()"
-                                   " parameter dst/src is a NULL ptr."
-                });
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_cat() / j2.string.cat()"
+                        " parameter dst/src is a NULL ptr.");
                 return 0;
         }
         if(!(*dst)) {
                 errno = EINVAL;
-                viwerr(VIWERR_PUSH, &(viwerr_package){
-                        .code    = EINVAL,
-                        .group   = (char*)"j2",
-                        .name    = (char*)"j2err: Invalid parameter...",
-                        .message = (char*)"j2string_cat() / j2.string.cat()"
-                                   " parameter dst is a pointer to a NULL ptr."
-                });
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_cat() / j2.string.cat()"
+                        " parameter dst is a pointer to a NULL ptr.");
                 return 0;
         }
 #endif
@@ -114,18 +104,19 @@ j2string_cat(
 #ifdef __J2_DEV__
         if(!infosrc || !infodst){
                 errno = EINVAL;
-                viwerr(VIWERR_PUSH, &(viwerr_package){
-                        .code    = EINVAL,
-                        .group   = (char*)"j2",
-                        .name    = (char*)"j2err: Invalid parameter...",
-                        .message = (char*)"j2string_cat() / j2.string.cat()"
-                                   " j2string type parameters \"dst\" & \"src\""
-                                   " both contain invalid j2string info."
-                });
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_cat() / j2.string.cat()"
+                        " j2string type parameters \"dst\" & \"src\""
+                        " both contain invalid j2string info.");
                 return 0;
         }
 #endif
 
+        /// A piece the sink can't hold goes straight through it.
+        if(J2_STRING_SINK_PASSES(infodst, infosrc->filled))
+                return j2string_sink_pass((*dst), src, infosrc->filled) 
+                     ? 0 : (long)utf8_count(src, infosrc->filled);
+
         (*dst) = j2string_update((*dst), 
                 infosrc->filled + infodst->filled + 1
         );
@@ -142,6 +133,7 @@ j2string_cat(
 
         infodst->filled += written;
         infodst->length += length;
+        J2_STRING_HASH_INVALIDATE(infodst);
 
         return (long)length;
 
@@ -177,24 +169,16 @@ j2string_noutf8_cat(
 #ifdef __J2_DEV__
         if(!dst || !src) {
                 errno = EINVAL;
-                viwerr(VIWERR_PUSH, &(viwerr_package){
-                        .code    = EINVAL,
-                        .group   = (char*)"j2",
-                        .name    = (char*)"j2err: Invalid parameter...",
-                        .message = (char*)"j2string_cat() / j2.string.cat()"
-                                   " parameter dst/src is a NULL ptr"
-                });
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_cat() / j2.string.cat()"
+                        " parameter dst/src is a NULL ptr");
                 return 0;
         }
         if(!(*dst)) {
                 errno = EINVAL;
-                viwerr(VIWERR_PUSH, &(viwerr_package){
-                        .code    = EINVAL,
-                        .group   = (char*)"j2",
-                        .name    = (char*)"j2err: Invalid parameter...",
-                        .message = (char*)"j2string_cat() / j2.string.cat()"
-                                   " parameter dst is a pointer to a NULL ptr"
-                });
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_cat() / j2.string.cat()"
+                        " parameter dst is a pointer to a NULL ptr");
                 return 0;
         }
 #endif
@@ -205,21 +189,25 @@ j2string_noutf8_cat(
 #ifdef __J2_DEV__
         if(!infosrc || !infodst){
                 errno = EINVAL;
-                viwerr(VIWERR_PUSH, &(viwerr_package){
-                        .code    = EINVAL,
-                        .group   = (char*)"j2",
-                        .name    = (char*)"j2err: Invalid parameter...",
-                        .message = (char*)"j2string_cat() / j2.string.cat()"
-                                   " j2string type parameters \"dst\" & \"src\""
-                                   " both contain invalid j2string info."
-                });
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_cat() / j2.string.cat()"
+                        " j2string type parameters \"dst\" & \"src\""
+                        " both contain invalid j2string info.");
                 return 0;
         }
 #endif
 
+        /// A piece the sink can't hold goes straight through it.
+        if(J2_STRING_SINK_PASSES(infodst, infosrc->filled))
+                return j2string_sink_pass((*dst), src, infosrc->filled) 
+                     ? 0 : (long)infosrc->filled;
+
         (*dst) = j2string_update((*dst), 
                 infosrc->filled + infodst->filled + 1
         );
+        if(!(*dst)) return 0;
+
+        infodst = J2_STRING_INFO((*dst));
 
         size_t written = 0;
         size_t length = j2string_utf8_nhbc_strcpy_sn(
@@ -230,6 +218,7 @@ j2string_noutf8_cat(
 
         infodst->filled += written;
         infodst->length += length;
+        J2_STRING_HASH_INVALIDATE(infodst);
 
         return (long)written;
 
@@ -0,0 +1,393 @@
+/*** LICENSE: LGPLV2. *************************************
+ *                                                        *
+ *                                                        *
+ * This file is a part of the j2 project.                 *
+ * Copyright (C) 2022 Joško Križanović                    *
+ * <jkriza02@fesb.com>                                    *
+ *                                                        *
+ * This library is free software; you can redistribute    *
+ * it and/or modify it under the terms of the GNU Lesser  *
+ * General Public License as published by the Free        *
+ * Software Foundation; either version 2.1 of the         *
+ * License, or (at your option) any later version.        *
+ *                                                        *
+ * This library is distributed in the hope that it will   *
+ * be useful,                                             *
+ * but WITHOUT ANY WARRANTY; without even the implied     *
+ * warranty of MERCHANTABILITY or FITNESS FOR A           *
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public  *
+ * License for more details.                              *
+ *                                                        *
+ * You should have received a copy of the GNU Lesser      *
+ * General Public License along with this library; if     *
+ * not, write to the Free Software Foundation, Inc.,      *
+ * 51 Franklin Street, Fifth Floor, Boston,               *
+ * MA  02110-1301  USA                                    *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: FILE, AUTHOR & DATE INFORMATION. *********
+ *                                                        *
+ *                                                        *
+ * FILE:                                                  *
+ * Concatenation of many strings at once, the total size  *
+ * is summed up first so the destination grows only once. *
+ *                                                        *
+ *                                                        *
+ * AUTHOR:                                                *
+ *      NAME:  Joško Križanović                           *
+ *      EMAIL: jkriza02@fesb.com                          *
+ *                                                        *
+ *                                                        *
+ * DATE:                                                  *
+ * 19.10.2026.                                            *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+#include "../string.h"
+#include "../utf8.h"
+#include "sink.h"
+#include "../../stats/stats.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+/**
+ * Amount of C string pieces whose sizes j2string_ccatn() remembers on the
+ * stack, more than this and the sizes go onto the heap.
+ */
+#define J2_STRING_CATN_STACK 32
+
+/**
+ * @brief 
+ * UTF-8 length of a piece, counted here if it is a mapped string that only
+ * knows its byte count.
+ */
+static size_t
+catn_length(
+        const_j2string piece )
+{
+        const struct j2string_st * info = J2_STRING_INFO(piece);
+        return J2_STRING_IS_UNCOUNTED(info) ? utf8_count(piece, info->filled)
+                                            : info->length;
+}
+
+/*******************************************************************************
+ * @fn @c j2string_catn(3)
+ * 
+ *      @brief Concatenate @c "count" j2strings from @c "src" onto the end of 
+ *      @c "(*dst)" in order. 
+ *      
+ *      The sizes of all pieces are summed up from their info first so 
+ *      @c "(*dst)" is resized at most once, afterwards every piece is a 
+ *      single memcpy() and nothing is rescanned. If everything does not fit
+ *      we stop at the first piece that doesn't and fit as much of it as we
+ *      can without leaving half baked UTF8 characters, like 
+ *      @c j2string_cat(2).
+ * 
+ *      @c "(*dst)" itself is allowed to be one of the pieces.
+ * 
+ *     
+ *      @param @b dst
+ *             j2string type string to concatenate to.
+ * 
+ *      @param @b src
+ *             Array of j2string type strings that will be concatenated.
+ * 
+ *      @param @b count
+ *             Amount of strings inside of @c "src".
+ * 
+ *      
+ *      @throw @a EINVAL - If @c dst and/or @c src and/or @c (*dst) are NULL 
+ *                         pointers,
+ *                         If @c (*dst) or one of the pieces is not a valid 
+ *                         j2string type.
+ *      @throw @a ENOMEM - j2string_update() throwable.
+ * 
+ *      @returns The number of UTF8 characters concatenated to @c "(*dst)".
+ * 
+ */
+long
+j2string_catn(
+        restrict_j2string * dst,
+        const j2string * src,
+        size_t count )
+{
+
+#ifdef __J2_DEV__
+        if(!dst || !src) {
+                errno = EINVAL;
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_catn() / j2.string.catn()"
+                        " parameter dst/src is a NULL ptr.");
+                return 0;
+        }
+        if(!(*dst)) {
+                errno = EINVAL;
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_catn() / j2.string.catn()"
+                        " parameter dst is a pointer to a NULL ptr.");
+                return 0;
+        }
+#endif
+
+        struct j2string_st * infodst = J2_STRING_INFO((*dst));
+
+#ifdef __J2_DEV__
+        if(!infodst){
+                errno = EINVAL;
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_catn() / j2.string.catn()"
+                        " j2string type parameter \"dst\""
+                        " contains invalid j2string info.");
+                return 0;
+        }
+        for(size_t i = 0; i < count; i++) {
+                struct j2string_st * infosrc = 
+                        src[i] ? J2_STRING_INFO(src[i]) : NULL;
+                if(!infosrc) {
+                        errno = EINVAL;
+                        J2_DIAG(J2_DIAG_INVALID,
+                                "j2string_catn() /"
+                                " j2.string.catn() a string"
+                                " inside of \"src\" is NULL or"
+                                " contains invalid j2string info.");
+                        return 0;
+                }
+        }
+#endif
+
+        /// Pass 1: sum up the sizes.
+        size_t total  = 0;
+        bool   inside = false;
+        for(size_t i = 0; i < count; i++) {
+                total  += J2_STRING_INFO(src[i])->filled;
+                inside |= src[i] == (*dst);
+        }
+
+        /// A sink that can't take every piece at once gets them one by 
+        /// one, flushing in between, so it doesn't grow past its mark.
+        if(J2_STRING_IS_SINK(infodst) && !inside
+        && infodst->filled + total + 1 > infodst->allocated) {
+                long length = 0;
+                for(size_t i = 0; i < count; i++) 
+                        length += j2string_cat(dst, src[i]);
+                return length;
+        }
+
+        /// "(*dst)" might be one of the pieces, its contents don't move
+        /// while we append behind them but their address might.
+        const j2string old     = (*dst);
+        const size_t   filled  = infodst->filled;
+        const size_t   oldlen  = infodst->length;
+
+        if(filled + total + 1 > infodst->allocated) {
+                (*dst)  = j2string_update((*dst), (long)(filled + total + 1));
+                infodst = J2_STRING_INFO((*dst));
+        }
+
+        /// Pass 2: one memcpy per piece, behind whatever a sink kept.
+        char * p      = (*dst) + infodst->filled;
+        size_t room   = infodst->allocated - infodst->filled - 1;
+        size_t length = 0;
+
+        for(size_t i = 0; i < count; i++) {
+
+                const bool self = src[i] == old;
+                const char * piece = self ? (*dst) : src[i];
+                const size_t size  = self ? filled 
+                                          : J2_STRING_INFO(src[i])->filled;
+
+                if(size > room) {
+                        size_t written = 0;
+                        length += j2string_utf8_strcpy_sn(
+                                p, piece, room + 1, &written
+                        );
+                        p += written;
+                        break;
+                }
+
+                /// A sink that flushed moved its own contents under p.
+                if(self) memmove(p, piece, size);
+                else     memcpy(p, piece, size);
+                J2_STATS_ADD(J2_STATS_BYTES_COPIED, size);
+                p      += size;
+                room   -= size;
+                length += self ? oldlen : catn_length(src[i]);
+
+        }
+
+        (*p) = '\0';
+        infodst->filled  = (size_t)(p - (*dst));
+        infodst->length += length;
+        J2_STRING_HASH_INVALIDATE(infodst);
+
+        return (long)length;
+
+}
+
+/*******************************************************************************
+ * @fn @c j2string_ccatn(3)
+ * 
+ *      @brief Concatenate @c "count" C strings from @c "src" onto the end of 
+ *      @c "(*dst)" in order.
+ * 
+ *      Every piece is scanned once for its size and UTF8 length, then 
+ *      @c "(*dst)" is resized at most once and every piece is a single 
+ *      memcpy(). Pieces that don't fit are handled like in 
+ *      @c j2string_catn(3).
+ * 
+ *     
+ *      @param @b dst
+ *             j2string type string to concatenate to.
+ * 
+ *      @param @b src
+ *             Array of C type strings that will be concatenated, none of 
+ *             them may point inside of @c "(*dst)".
+ * 
+ *      @param @b count
+ *             Amount of strings inside of @c "src".
+ * 
+ *      
+ *      @throw @a EINVAL - If @c dst and/or @c src and/or @c (*dst) or one of
+ *                         the pieces are NULL pointers,
+ *                         If @c (*dst) is not a valid j2string type.
+ *      @throw @a ENOMEM - j2string_update() throwable or we could not 
+ *                         allocate space for the sizes of more than
+ *                         @c J2_STRING_CATN_STACK pieces.
+ * 
+ *      @returns The number of UTF8 characters concatenated to @c "(*dst)".
+ * 
+ */
+long
+j2string_ccatn(
+        restrict_j2string * dst,
+        const char * const * src,
+        size_t count )
+{
+
+#ifdef __J2_DEV__
+        if(!dst || !src) {
+                errno = EINVAL;
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_ccatn() / j2.string.ccatn()"
+                        " parameter dst/src is a NULL ptr.");
+                return 0;
+        }
+        if(!(*dst)) {
+                errno = EINVAL;
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_ccatn() / j2.string.ccatn()"
+                        " parameter dst is a pointer to a NULL ptr.");
+                return 0;
+        }
+        for(size_t i = 0; i < count; i++) {
+                if(!src[i]) {
+                        errno = EINVAL;
+                        J2_DIAG(J2_DIAG_INVALID,
+                                "j2string_ccatn() /"
+                                " j2.string.ccatn() a string"
+                                " inside of \"src\" is a NULL ptr.");
+                        return 0;
+                }
+        }
+#endif
+
+        struct j2string_st * infodst = J2_STRING_INFO((*dst));
+
+#ifdef __J2_DEV__
+        if(!infodst){
+                errno = EINVAL;
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_ccatn() / j2.string.ccatn()"
+                        " j2string type parameter \"dst\""
+                        " contains invalid j2string info.");
+                return 0;
+        }
+#endif
+
+        size_t   stack[J2_STRING_CATN_STACK];
+        size_t * sizes = stack;
+        if(count > J2_STRING_CATN_STACK) {
+                sizes = malloc(count * sizeof(size_t));
+                if(!sizes) {
+                        errno = ENOMEM;
+                        return 0;
+                }
+        }
+
+        /// Pass 1: one scan per piece for its size, the UTF8 length comes
+        /// along for free.
+        size_t total = 0, length = 0;
+        for(size_t i = 0; i < count; i++) {
+                length += j2string_utf8_strlen_sn(
+                        src[i], J2_STRING_MAX_SIZE, &sizes[i]
+                );
+                total  += sizes[i];
+        }
+
+        /// Same as in j2string_catn().
+        if(J2_STRING_IS_SINK(infodst)
+        && infodst->filled + total + 1 > infodst->allocated) {
+                if(sizes != stack) free(sizes);
+                length = 0;
+                for(size_t i = 0; i < count; i++) 
+                        length += j2string_ccat(dst, src[i]);
+                return (long)length;
+        }
+
+        if(infodst->filled + total + 1 > infodst->allocated) {
+                (*dst)  = j2string_update((*dst), 
+                        (long)(infodst->filled + total + 1));
+                infodst = J2_STRING_INFO((*dst));
+        }
+
+        char * p    = (*dst) + infodst->filled;
+        size_t room = infodst->allocated - infodst->filled - 1;
+
+        if(total <= room) {
+
+                /// Pass 2: one memcpy per piece.
+                for(size_t i = 0; i < count; i++) {
+                        memcpy(p, src[i], sizes[i]);
+                        J2_STATS_ADD(J2_STATS_BYTES_COPIED, sizes[i]);
+                        p += sizes[i];
+                }
+
+        } else {
+
+                /// Doesn't fit, recount what we actually write.
+                length = 0;
+                for(size_t i = 0; i < count; i++) {
+                        if(sizes[i] > room) {
+                                size_t written = 0;
+                                length += j2string_utf8_strcpy_sn(
+                                        p, src[i], room + 1, &written
+                                );
+                                p += written;
+                                break;
+                        }
+                        memcpy(p, src[i], sizes[i]);
+                        J2_STATS_ADD(J2_STATS_BYTES_COPIED, sizes[i]);
+                        length += j2string_utf8_strlen_sn(
+                                src[i], sizes[i] + 1, NULL
+                        );
+                        p    += sizes[i];
+                        room -= sizes[i];
+                }
+
+        }
+
+        if(sizes != stack) free(sizes);
+
+        (*p) = '\0';
+        infodst->filled  = (size_t)(p - (*dst));
+        infodst->length += length;
+        J2_STRING_HASH_INVALIDATE(infodst);
+
+        return (long)length;
+
+}
@@ -46,14 +46,12 @@
  *********************************************************/
 
 #include "../string.h"
+#include "../utf8.h"
+#include "sink.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <errno.h>
 
-#ifdef __J2_DEV__
-#include "../../../ext/viwerr/viwerr.h"
-#endif
-
 /*******************************************************************************
  * @fn @c j2string_ccat(2)
  * 
@@ -85,24 +83,16 @@ j2string_ccat(
 #ifdef __J2_DEV__
         if(!dst || !src) {
                 errno = EINVAL;
-                viwerr(VIWERR_PUSH, &(viwerr_package){
-                        .code    = EINVAL,
-                        .group   = (char*)"j2",
-                        .name    = (char*)"j2err: Invalid parameter...",
-                        .message = (char*)"j2string_ccat() / j2.string.ccat()"
-                                   " parameter dst/src is a NULL ptr."
-                });
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_ccat() / j2.string.ccat()"
+                        " parameter dst/src is a NULL ptr.");
                 return 0;
         }
         if(!(*dst)) {
                 errno = EINVAL;
-                viwerr(VIWERR_PUSH, &(viwerr_package){
-                        .code    = EINVAL,
-                        .group   = (char*)"j2",
-                        .name    = (char*)"j2err: Invalid parameter...",
-                        .message = (char*)"j2string_ccat() / j2.string.ccat()"
-                                   " parameter dst is a pointer to a NULL ptr."
-                });
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_ccat() / j2.string.ccat()"
+                        " parameter dst is a pointer to a NULL ptr.");
                 return 0;
         }
 #endif
@@ -112,20 +102,21 @@ j2string_ccat(
 #ifdef __J2_DEV__
         if(!infodst){
                 errno = EINVAL;
-                viwerr(VIWERR_PUSH, &(viwerr_package){
-                        .code    = EINVAL,
-                        .group   = (char*)"j2",
-                        .name    = (char*)"j2err: Invalid parameter...",
-                        .message = (char*)"j2string_ccat() / j2.string.ccat()"
-                                   " j2string type parameters \"dst\" & \"src\""
-                                   " both contain invalid j2string info."
-                });
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_ccat() / j2.string.ccat()"
+                        " j2string type parameters \"dst\" & \"src\""
+                        " both contain invalid j2string info.");
                 return 0;
         }
 #endif
 
         size_t filled = j2string_strlen_sn(src, J2_STRING_MAX_SIZE);
 
+        /// A piece the sink can't hold goes straight through it.
+        if(J2_STRING_SINK_PASSES(infodst, filled))
+                return j2string_sink_pass((*dst), src, filled) 
+                     ? 0 : (long)utf8_count(src, filled);
+
         (*dst) = j2string_update((*dst), 
                 filled + infodst->filled + 1);
         if(!(*dst)) return 0;
@@ -141,6 +132,7 @@ j2string_ccat(
 
         infodst->filled += written;
         infodst->length += length;
+        J2_STRING_HASH_INVALIDATE(infodst);
 
         return (long)length;
 
@@ -176,26 +168,18 @@ j2string_noutf8_ccat(
 #ifdef __J2_DEV__
         if(!dst || !src) {
                 errno = EINVAL;
-                viwerr(VIWERR_PUSH, &(viwerr_package){
-                        .code    = EINVAL,
-                        .group   = (char*)"j2",
-                        .name    = (char*)"j2err: Invalid parameter...",
-                        .message = (char*)"j2string_noutf8_ccat() /"
-                                   " j2.string.noutf8.ccat()"
-                                   " parameter dst/src is a NULL ptr."
-                });
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_noutf8_ccat() /"
+                        " j2.string.noutf8.ccat()"
+                        " parameter dst/src is a NULL ptr.");
                 return 0;
         }
         if(!(*dst)) {
                 errno = EINVAL;
-                viwerr(VIWERR_PUSH, &(viwerr_package){
-                        .code    = EINVAL,
-                        .group   = (char*)"j2",
-                        .name    = (char*)"j2err: Invalid parameter...",
-                        .message = (char*)"j2string_noutf8_ccat() /"
-                                   " j2.string.noutf8.ccat()"
-                                   " parameter dst is a pointer to a NULL ptr."
-                });
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_noutf8_ccat() /"
+                        " j2.string.noutf8.ccat()"
+                        " parameter dst is a pointer to a NULL ptr.");
                 return 0;
         }
 #endif
@@ -205,21 +189,22 @@ j2string_noutf8_ccat(
 #ifdef __J2_DEV__
         if(!infodst){
                 errno = EINVAL;
-                viwerr(VIWERR_PUSH, &(viwerr_package){
-                        .code    = EINVAL,
-                        .group   = (char*)"j2",
-                        .name    = (char*)"j2err: Invalid parameter...",
-                        .message = (char*)"j2string_noutf8_ccat() /"
-                                   " j2.string.noutf8.ccat()"
-                                   " j2string type parameters \"dst\" & \"src\""
-                                   " both contain invalid j2string info."
-                });
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_noutf8_ccat() /"
+                        " j2.string.noutf8.ccat()"
+                        " j2string type parameters \"dst\" & \"src\""
+                        " both contain invalid j2string info.");
                 return 0;
         }
 #endif
 
         size_t filled = j2string_strlen_sn(src, J2_STRING_MAX_SIZE);
 
+        /// A piece the sink can't hold goes straight through it.
+        if(J2_STRING_SINK_PASSES(infodst, filled))
+                return j2string_sink_pass((*dst), src, filled) 
+                     ? 0 : (long)filled;
+
         (*dst) = j2string_update((*dst), 
                 filled + infodst->filled + 1);
         if(!(*dst)) return 0;
@@ -235,6 +220,7 @@ j2string_noutf8_ccat(
 
         infodst->filled += written;
         infodst->length += length;
+        J2_STRING_HASH_INVALIDATE(infodst);
 
         return (long)written;
 }
\ No newline at end of file
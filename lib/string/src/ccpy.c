@@ -46,14 +46,12 @@
  *********************************************************/
 
 #include "../string.h"
+#include "../utf8.h"
+#include "sink.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <errno.h>
 
-#ifdef __J2_DEV__
-#include "../../../ext/viwerr/viwerr.h"
-#endif
-
 /*******************************************************************************
  * @fn @c j2string_ccpy(2)
  * 
@@ -85,25 +83,17 @@ j2string_ccpy(
 #ifdef __J2_DEV__
         if(!src || !dst){
                 errno = EINVAL;
-                viwerr(VIWERR_PUSH, &(viwerr_package){
-                        .code    = EINVAL,
-                        .group   = (char*)"j2",
-                        .name    = (char*)"j2err: Invalid parameter...",
-                        .message = (char*)"j2string_ccpy() / j2.string.ccpy()"
-                                   " parameter dst/src is a NULL ptr."
-                });
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_ccpy() / j2.string.ccpy()"
+                        " parameter dst/src is a NULL ptr.");
                 return 0;
 
         } else if(!(*dst)) {
 
                 errno = EINVAL;
-                viwerr(VIWERR_PUSH, &(viwerr_package){
-                        .code    = EINVAL,
-                        .group   = (char*)"j2",
-                        .name    = (char*)"j2err: Invalid parameter...",
-                        .message = (char*)"j2string_ccpy() / j2.string.ccpy()"
-                                   " parameter dst is a pointer to a NULL ptr."
-                });
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_ccpy() / j2.string.ccpy()"
+                        " parameter dst is a pointer to a NULL ptr.");
                 return 0;
 
         }
@@ -114,20 +104,24 @@ j2string_ccpy(
 #ifdef __J2_DEV__
         if(!dstinfo){
                 errno = EINVAL;
-                viwerr(VIWERR_PUSH, &(viwerr_package){
-                        .code    = EINVAL,
-                        .group   = (char*)"j2",
-                        .name    = (char*)"j2err: Invalid parameter...",
-                        .message = (char*)"j2string_cat() / j2.string.cat()"
-                                   " j2string type parameter \"dst\""
-                                   " contains invalid j2string info."
-                });
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_cat() / j2.string.cat()"
+                        " j2string type parameter \"dst\""
+                        " contains invalid j2string info.");
                 return 0;
         }
 #endif
 
         size_t size = j2string_strlen_sn(src, dstinfo->max-1)+1;
 
+        /// A sink sends out what it holds before it gets replaced.
+        if(J2_STRING_IS_SINK(dstinfo)) j2string_sink_flush((*dst));
+
+        /// A piece the sink can't hold goes straight through it.
+        if(J2_STRING_SINK_PASSES(dstinfo, size - 1))
+                return j2string_sink_pass((*dst), src, size - 1) 
+                     ? 0 : (long)utf8_count(src, size - 1);
+
         (*dst) = j2string_update((*dst), (long)size);
         if((*dst) == NULL) return 0;
 
@@ -139,6 +133,8 @@ j2string_ccpy(
                 &dstinfo->filled
         );
 
+        J2_STRING_HASH_INVALIDATE(dstinfo);
+
         return dstinfo->length;
 
 }
@@ -173,25 +169,17 @@ j2string_noutf8_ccpy(
 #ifdef __J2_DEV__
         if(!src || !dst){
                 errno = EINVAL;
-                viwerr(VIWERR_PUSH, &(viwerr_package){
-                        .code    = EINVAL,
-                        .group   = (char*)"j2",
-                        .name    = (char*)"j2err: Invalid parameter...",
-                        .message = (char*)"j2string_ccpy() / j2.string.ccpy()"
-                                   " parameter dst/src is a NULL ptr."
-                });
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_ccpy() / j2.string.ccpy()"
+                        " parameter dst/src is a NULL ptr.");
                 return 0;
 
         } else if(!(*dst)) {
 
                 errno = EINVAL;
-                viwerr(VIWERR_PUSH, &(viwerr_package){
-                        .code    = EINVAL,
-                        .group   = (char*)"j2",
-                        .name    = (char*)"j2err: Invalid parameter...",
-                        .message = (char*)"j2string_ccpy() / j2.string.ccpy()"
-                                   " parameter dst is a pointer to a NULL ptr."
-                });
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_ccpy() / j2.string.ccpy()"
+                        " parameter dst is a pointer to a NULL ptr.");
                 return 0;
 
         }
@@ -202,20 +190,24 @@ j2string_noutf8_ccpy(
 #ifdef __J2_DEV__
         if(!dstinfo){
                 errno = EINVAL;
-                viwerr(VIWERR_PUSH, &(viwerr_package){
-                        .code    = EINVAL,
-                        .group   = (char*)"j2",
-                        .name    = (char*)"j2err: Invalid parameter...",
-                        .message = (char*)"j2string_cat() / j2.string.cat()"
-                                   " j2string type parameter \"dst\""
-                                   " contains invalid j2string info."
-                });
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_cat() / j2.string.cat()"
+                        " j2string type parameter \"dst\""
+                        " contains invalid j2string info.");
                 return 0;
         }
 #endif
 
         size_t size = j2string_strlen_sn(src, dstinfo->max-1)+1;
 
+        /// A sink sends out what it holds before it gets replaced.
+        if(J2_STRING_IS_SINK(dstinfo)) j2string_sink_flush((*dst));
+
+        /// A piece the sink can't hold goes straight through it.
+        if(J2_STRING_SINK_PASSES(dstinfo, size - 1))
+                return j2string_sink_pass((*dst), src, size - 1) 
+                     ? 0 : (long)(size - 1);
+
         (*dst) = j2string_update((*dst), (long)size);
         if((*dst) == NULL) return 0;
 
@@ -227,6 +219,8 @@ j2string_noutf8_ccpy(
                 &dstinfo->filled
         );
 
+        J2_STRING_HASH_INVALIDATE(dstinfo);
+
         return dstinfo->filled;
 
 }
\ No newline at end of file
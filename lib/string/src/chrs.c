@@ -50,10 +50,6 @@
 #include <stdlib.h>
 #include <errno.h>
 
-#ifdef __J2_DEV__
-#include "../../../ext/viwerr/viwerr.h"
-#endif
-
 /**
  * @brief strchr but it returns a long instead
  * 
@@ -46,14 +46,11 @@
  *********************************************************/
 
 #include "../string.h"
+#include "kernel.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <errno.h>
 
-#ifdef __J2_DEV__
-#include "../../../ext/viwerr/viwerr.h"
-#endif
-
 /**
  * @brief 
  * count character
@@ -83,11 +80,27 @@ j2string_cnt(
         }
 #endif
 
-        if(c == '\0') return 0;
+        if(c == '\0' || info->filled == 0) return 0;
+
+        return (long)j2string_kernel.cnt(string, info->filled, c);
+
+}
+
+/**
+ * @brief 
+ * Scalar kernel of j2string_cnt(), counts @c "c" in front of the first null
+ * character or @c "max" bytes.
+ */
+size_t
+j2string_cnt_scalar(
+        const char * str,
+        size_t max,
+        unsigned char c )
+{
 
         size_t i, counter;
-        for(i = counter = 0; string[i] != '\0' && i < info->filled; i++) {
-                if(string[i] == c) counter++;
+        for(i = counter = 0; str[i] != '\0' && i < max; i++) {
+                if((unsigned char)str[i] == c) counter++;
         }
         return counter;
 
@@ -46,14 +46,12 @@
  *********************************************************/
 
 #include "../string.h"
+#include "../utf8.h"
+#include "sink.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <errno.h>
 
-#ifdef __J2_DEV__
-#include "../../../ext/viwerr/viwerr.h"
-#endif
-
 /*******************************************************************************
  * @fn @c j2string_cpy(2)
  * 
@@ -85,24 +83,16 @@ j2string_cpy(
 #ifdef __J2_DEV__
         if(!dst || !src) {
                 errno = EINVAL;
-                viwerr(VIWERR_PUSH, &(viwerr_package){
-                        .code    = EINVAL,
-                        .group   = (char*)"j2",
-                        .name    = (char*)"j2err: Invalid parameter...",
-                        .message = (char*)"j2string_cpy() / j2.string.cpy()"
-                                   " parameter dst/src is a NULL ptr."
-                });
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_cpy() / j2.string.cpy()"
+                        " parameter dst/src is a NULL ptr.");
                 return 0;
         }
         if(!(*dst)) {
                 errno = EINVAL;
-                viwerr(VIWERR_PUSH, &(viwerr_package){
-                        .code    = EINVAL,
-                        .group   = (char*)"j2",
-                        .name    = (char*)"j2err: Invalid parameter...",
-                        .message = (char*)"j2string_cpy() / j2.string.cpy()"
-                                   " parameter dst is a pointer to a NULL ptr."
-                });
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_cpy() / j2.string.cpy()"
+                        " parameter dst is a pointer to a NULL ptr.");
                 return 0;
         }
 #endif
@@ -113,18 +103,22 @@ j2string_cpy(
 #ifdef   __J2_DEV__
         if(!infosrc || !infodst){
                 errno = EINVAL;
-                viwerr(VIWERR_PUSH, &(viwerr_package){
-                        .code    = EINVAL,
-                        .group   = (char*)"j2",
-                        .name    = (char*)"j2err: Invalid parameter...",
-                        .message = (char*)"j2string_cpy() / j2.string.cpy()"
-                                   " j2string type parameters \"dst\" & \"src\""
-                                   " both contain invalid j2string info."
-                });
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_cpy() / j2.string.cpy()"
+                        " j2string type parameters \"dst\" & \"src\""
+                        " both contain invalid j2string info.");
                 return 0;
         }
 #endif
 
+        /// A sink sends out what it holds before it gets replaced.
+        if(J2_STRING_IS_SINK(infodst)) j2string_sink_flush((*dst));
+
+        /// A piece the sink can't hold goes straight through it.
+        if(J2_STRING_SINK_PASSES(infodst, infosrc->filled))
+                return j2string_sink_pass((*dst), src, infosrc->filled) 
+                     ? 0 : (long)utf8_count(src, infosrc->filled);
+
         (*dst) = j2string_update((*dst), infosrc->filled+1);
         if(!(*dst)) return 0;
 
@@ -136,6 +130,8 @@ j2string_cpy(
                 &infodst->filled
         );
 
+        J2_STRING_HASH_INVALIDATE(infodst);
+
         return (long)infodst->length;
 
 }
@@ -170,24 +166,16 @@ j2string_noutf8_cpy(
 #ifdef __J2_DEV__
         if(!dst || !src) {
                 errno = EINVAL;
-                viwerr(VIWERR_PUSH, &(viwerr_package){
-                        .code    = EINVAL,
-                        .group   = (char*)"j2",
-                        .name    = (char*)"j2err: Invalid parameter...",
-                        .message = (char*)"j2string_cpy() / j2.string.cpy()"
-                                   " parameter dst/src is a NULL ptr."
-                });
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_cpy() / j2.string.cpy()"
+                        " parameter dst/src is a NULL ptr.");
                 return 0;
         }
         if(!(*dst)) {
                 errno = EINVAL;
-                viwerr(VIWERR_PUSH, &(viwerr_package){
-                        .code    = EINVAL,
-                        .group   = (char*)"j2",
-                        .name    = (char*)"j2err: Invalid parameter...",
-                        .message = (char*)"j2string_cpy() / j2.string.cpy()"
-                                   " parameter dst is a pointer to a NULL ptr."
-                });
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_cpy() / j2.string.cpy()"
+                        " parameter dst is a pointer to a NULL ptr.");
                 return 0;
         }
 #endif
@@ -198,18 +186,22 @@ j2string_noutf8_cpy(
 #ifdef   __J2_DEV__
         if(!infosrc || !infodst){
                 errno = EINVAL;
-                viwerr(VIWERR_PUSH, &(viwerr_package){
-                        .code    = EINVAL,
-                        .group   = (char*)"j2",
-                        .name    = (char*)"j2err: Invalid parameter...",
-                        .message = (char*)"j2string_cpy() / j2.string.cpy()"
-                                   " j2string type parameters \"dst\" & \"src\""
-                                   " both contain invalid j2string info."
-                });
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_cpy() / j2.string.cpy()"
+                        " j2string type parameters \"dst\" & \"src\""
+                        " both contain invalid j2string info.");
                 return 0;
         }
 #endif
 
+        /// A sink sends out what it holds before it gets replaced.
+        if(J2_STRING_IS_SINK(infodst)) j2string_sink_flush((*dst));
+
+        /// A piece the sink can't hold goes straight through it.
+        if(J2_STRING_SINK_PASSES(infodst, infosrc->filled))
+                return j2string_sink_pass((*dst), src, infosrc->filled) 
+                     ? 0 : (long)infosrc->filled;
+
         (*dst) = j2string_update((*dst), infosrc->filled+1);
         if(!(*dst)) return 0;
 
@@ -221,6 +213,8 @@ j2string_noutf8_cpy(
                 &infodst->filled
         );
 
+        J2_STRING_HASH_INVALIDATE(infodst);
+
         return (long)infodst->filled;
 
 }
\ No newline at end of file
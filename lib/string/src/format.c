@@ -1,8 +1,6 @@
 #include "../string.h"
+#include <errno.h>
 
-#ifdef __J2_DEV__
-#include "../../../ext/viwerr/viwerr.h"
-#endif
 long
 j2string_format(
         const_restrict_j2string * string,
@@ -13,53 +11,37 @@ j2string_format(
 #ifdef __J2_DEV__
         if(!string) {
                 errno = EINVAL;
-                viwerr(VIWERR_PUSH, &(viwerr_package){
-                        .code    = EINVAL,
-                        .name    = (char*)"j2err: Invalid parameters",
-                        .message = (char*)"j2string_format() / "
-                                   "j2.string.format(): "
-                                   "parameter \"string\" is a NULL pointer.",
-                        .group   = (char*)"j2"
-                });
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_format() / "
+                        "j2.string.format(): "
+                        "parameter \"string\" is a NULL pointer.");
                 return 0;
         }
         if(!format) {
                 errno = EINVAL;
-                viwerr(VIWERR_PUSH, &(viwerr_package){
-                        .code    = EINVAL,
-                        .name    = (char*)"j2err: Invalid parameters",
-                        .message = (char*)"j2string_format() / "
-                                   "j2.string.format(): "
-                                   "parameter \"format\" is a NULL pointer.",
-                        .group   = (char*)"j2"
-                });
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_format() / "
+                        "j2.string.format(): "
+                        "parameter \"format\" is a NULL pointer.");
                 return 0;
         }
         if(!(*string)) {
                 errno = EINVAL;
-                viwerr(VIWERR_PUSH, &(viwerr_package){
-                        .code    = EINVAL,
-                        .name    = (char*)"j2err: Invalid parameters",
-                        .message = (char*)"j2string_format() / "
-                                   "j2.string.format(): "
-                                   "parameter \"string\" points to a NULL "
-                                   "pointer.",
-                        .group   = (char*)"j2"
-                });
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_format() / "
+                        "j2.string.format(): "
+                        "parameter \"string\" points to a NULL "
+                        "pointer.");
                 return 0;
         }
         if(J2_STRING_INFO((*string)) == NULL) {
                 errno = EINVAL;
-                viwerr(VIWERR_PUSH, &(viwerr_package){
-                        .code    = EINVAL,
-                        .name    = (char*)"j2err: Invalid parameters",
-                        .message = (char*)"j2string_format() / "
-                                   "j2.string.format(): "
-                                   "parameter \"string\" does not contain "
-                                   "a valid j2string... "
-                                   "J2_STRING_INFO((*string)) returned NULL.",
-                        .group   = (char*)"j2"
-                });
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_format() / "
+                        "j2.string.format(): "
+                        "parameter \"string\" does not contain "
+                        "a valid j2string... "
+                        "J2_STRING_INFO((*string)) returned NULL.");
                 return 0;
         }
 #endif
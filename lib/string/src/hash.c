@@ -0,0 +1,288 @@
+/*** LICENSE: LGPLV2. *************************************
+ *                                                        *
+ *                                                        *
+ * This file is a part of the j2 project.                 *
+ * Copyright (C) 2022 Joško Križanović                    *
+ * <jkriza02@fesb.com>                                    *
+ *                                                        *
+ * This library is free software; you can redistribute    *
+ * it and/or modify it under the terms of the GNU Lesser  *
+ * General Public License as published by the Free        *
+ * Software Foundation; either version 2.1 of the         *
+ * License, or (at your option) any later version.        *
+ *                                                        *
+ * This library is distributed in the hope that it will   *
+ * be useful,                                             *
+ * but WITHOUT ANY WARRANTY; without even the implied     *
+ * warranty of MERCHANTABILITY or FITNESS FOR A           *
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public  *
+ * License for more details.                              *
+ *                                                        *
+ * You should have received a copy of the GNU Lesser      *
+ * General Public License along with this library; if     *
+ * not, write to the Free Software Foundation, Inc.,      *
+ * 51 Franklin Street, Fifth Floor, Boston,               *
+ * MA  02110-1301  USA                                    *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: FILE, AUTHOR & DATE INFORMATION. *********
+ *                                                        *
+ *                                                        *
+ * FILE:                                                  *
+ * Fast non cryptographic hashing of j2strings, the hash  *
+ * of a j2string is cached inside of its header.          *
+ *                                                        *
+ *                                                        *
+ * AUTHOR:                                                *
+ *      NAME:  Joško Križanović                           *
+ *      EMAIL: jkriza02@fesb.com                          *
+ *                                                        *
+ *                                                        *
+ * DATE:                                                  *
+ * 19.10.2026.                                            *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+#include "../string.h"
+#include "valmath.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+
+/**
+ * The hash is wyhash (final version 4), it reads 8 bytes at a time and
+ * folds them with a 64x64->128 bit multiply. Three independent lanes run
+ * over inputs longer than 48 bytes so the multiplies overlap.
+ */
+static const uint64_t hash_secret[4] = {
+        0x2D358DCCAA6C78A5ULL, 0x8BB84B93962EACC9ULL,
+        0x4B33A62ED433D4A3ULL, 0x4D5A2DA51DE1AA47ULL
+};
+
+static inline uint64_t
+hash_mix(
+        uint64_t a,
+        uint64_t b )
+{
+        a = valmath_umul128(a, b, &b);
+        return a ^ b;
+}
+
+/**
+ * Unaligned little endian reads.
+ */
+static inline uint64_t
+hash_r8(
+        const unsigned char * p )
+{
+
+        uint64_t v;
+        memcpy(&v, p, sizeof(v));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        v = __builtin_bswap64(v);
+#endif
+        return v;
+
+}
+
+static inline uint64_t
+hash_r4(
+        const unsigned char * p )
+{
+
+        uint32_t v;
+        memcpy(&v, p, sizeof(v));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        v = __builtin_bswap32(v);
+#endif
+        return v;
+
+}
+
+static inline uint64_t
+hash_r3(
+        const unsigned char * p,
+        size_t k )
+{
+        return ((uint64_t)p[0] << 16) | ((uint64_t)p[k >> 1] << 8) | p[k - 1];
+}
+
+/**
+ * @fn @c j2string_hash_sn(3)
+ * 
+ *      @brief Hash exactly @c "bytes" bytes of @c "str", null values 
+ *      included, nothing past them is read.
+ * 
+ * 
+ *      @param @b str
+ *             Bytes to hash.
+ * 
+ *      @param @b bytes
+ *             Amount of bytes to hash.
+ * 
+ *      @param @b seed
+ *             Seed of the hash, different seeds give unrelated hashes.
+ * 
+ * 
+ *      @throw None.
+ * 
+ * 
+ *      @returns The 64 bit hash.
+ * 
+ */
+uint64_t
+j2string_hash_sn(
+        const char * str,
+        size_t bytes,
+        uint64_t seed )
+{
+
+        const unsigned char * p = (const unsigned char *)str;
+        uint64_t a, b;
+
+        seed ^= hash_mix(seed ^ hash_secret[0], hash_secret[1]);
+
+        if(bytes <= 16) {
+
+                if(bytes >= 4) {
+                        size_t shift = (bytes >> 3) << 2;
+                        a = (hash_r4(p) << 32) | hash_r4(p + shift);
+                        b = (hash_r4(p + bytes - 4) << 32) 
+                          |  hash_r4(p + bytes - 4 - shift);
+                } else if(bytes > 0) {
+                        a = hash_r3(p, bytes);
+                        b = 0;
+                } else {
+                        a = b = 0;
+                }
+
+        } else {
+
+                size_t i = bytes;
+                if(i > 48) {
+                        uint64_t see1 = seed, see2 = seed;
+                        do {
+                                seed = hash_mix(hash_r8(p)      ^ hash_secret[1],
+                                                hash_r8(p + 8)  ^ seed);
+                                see1 = hash_mix(hash_r8(p + 16) ^ hash_secret[2],
+                                                hash_r8(p + 24) ^ see1);
+                                see2 = hash_mix(hash_r8(p + 32) ^ hash_secret[3],
+                                                hash_r8(p + 40) ^ see2);
+                                p += 48; 
+                                i -= 48;
+                        } while(i > 48);
+                        seed ^= see1 ^ see2;
+                }
+
+                while(i > 16) {
+                        seed = hash_mix(hash_r8(p)     ^ hash_secret[1],
+                                        hash_r8(p + 8) ^ seed);
+                        p += 16;
+                        i -= 16;
+                }
+
+                a = hash_r8(p + i - 16);
+                b = hash_r8(p + i - 8);
+
+        }
+
+        a ^= hash_secret[1];
+        b ^= seed;
+        a = valmath_umul128(a, b, &b);
+
+        return hash_mix(a ^ hash_secret[0] ^ bytes, b ^ hash_secret[1]);
+
+}
+
+/**
+ * @fn @c j2string_chash_sn(2)
+ * 
+ *      @brief Hash exactly @c "bytes" bytes of @c "str" the way 
+ *      j2string_hash() caches it, the value is never J2_STRING_HASH_NONE.
+ * 
+ * 
+ *      @param @b str
+ *             Bytes to hash.
+ * 
+ *      @param @b bytes
+ *             Amount of bytes to hash.
+ * 
+ * 
+ *      @throw None.
+ * 
+ * 
+ *      @returns The 64 bit hash, j2string_hash() of a j2string with the 
+ *      same contents.
+ * 
+ */
+uint64_t
+j2string_chash_sn(
+        const char * str,
+        size_t bytes )
+{
+
+        uint64_t hash = j2string_hash_sn(str, bytes, 0);
+        return hash == J2_STRING_HASH_NONE ? 1 : hash;
+
+}
+
+/**
+ * @fn @c j2string_hash(1)
+ * 
+ *      @brief Hash the contents of a j2string, up to its @c filled value.
+ * 
+ *      The first call stores the hash inside of the header of @c "string",
+ *      every j2string function that changes the contents clears it so the
+ *      next call hashes again. Writing into the string by hand (through
+ *      @c "string[i]" or @c "memcpy()") doesn't, call 
+ *      @c J2_STRING_HASH_INVALIDATE() afterwards in that case.
+ * 
+ *      The cache is written without any locking, hashing the same string 
+ *      from many threads is fine as they all store the same value but 
+ *      changing it while another thread hashes it is not.
+ * 
+ * 
+ *      @param @b string
+ *             j2string type string to hash.
+ * 
+ * 
+ *      @throw @a EINVAL - If @c "string" is a NULL ptr or not a valid 
+ *                         j2string.
+ * 
+ * 
+ *      @returns The 64 bit hash, never 0, equal to 
+ *      @c j2string_hash_sn(string, filled, 0) unless that one is 0.
+ * 
+ */
+uint64_t
+j2string_hash(
+        const_j2string string )
+{
+
+#ifdef __J2_DEV__
+        const struct j2string_st * check = 
+                string ? J2_STRING_INFO(string) : NULL;
+        if(!check) {
+                errno = EINVAL;
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_hash() / j2.string.hash()"
+                        " parameter string is a NULL ptr or"
+                        " contains invalid j2string info.");
+                return 0;
+        }
+#endif
+
+        /// The cache isn't part of the value of the string.
+        struct j2string_st * info = J2_STRING_INFO((j2string)string);
+
+        if(info->hash == J2_STRING_HASH_NONE)
+                info->hash = j2string_chash_sn(string, info->filled);
+
+        return info->hash;
+
+}
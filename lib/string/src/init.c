@@ -46,14 +46,12 @@
  *********************************************************/
 
 #include "../string.h"
+#include "../../stats/stats.h"
+#include "sink.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <errno.h>
 
-#ifdef __J2_DEV__
-#include "../../../ext/viwerr/viwerr.h"
-#endif
-
 /**
  * @fn @c j2string_allocate(1)
  * 
@@ -88,11 +86,15 @@ j2string_allocate(
         if(!memory) 
                 return NULL;
 
+        J2_STATS_ADD(J2_STATS_ALLOC, 1);
+
         memory->padding   = parameters.padding;
         memory->allocated = parameters.allocate;
         memory->max       = parameters.max;
         memory->filled    = 0;
         memory->length    = 0;
+        memory->reserved  = 0;
+        memory->hash      = J2_STRING_HASH_NONE;
         memory->ensure    = J2_STRING_ENSURE_HEXSPEAK;
         J2_STRING_REACH_FOR_STRING(memory)[memory->allocated] = '\0';
 
@@ -130,7 +132,11 @@ j2string_free(
                 return;
 #endif
 
-        free(J2_STRING_REACH_FOR_STRUCT(string));
+        struct j2string_st * info = J2_STRING_REACH_FOR_STRUCT(string);
+
+        J2_STATS_ADD(J2_STATS_FREE, 1);
+        free(J2_STRING_IS_SINK(info) ? (void *)J2_STRING_SINK_OF(info) 
+                                     : (void *)info);
 
 }
 
@@ -185,6 +191,10 @@ j2string_update(
 
         struct j2string_st * info = J2_STRING_INFO(string);
 
+        /// Sinks flush instead of growing.
+        if(J2_STRING_IS_SINK(info)) 
+                return j2string_sink_update(string, newsize);
+
         /// Calculate the updated size of the string.
         size_t calcsize = J2_STRING_GET_NEW_SIZE(
                 info->allocated,
@@ -193,6 +203,10 @@ j2string_update(
                 info->max
         );
 
+        /// Don't shrink under the size asked for by j2string_reserve().
+        if(info->padding != 0 && calcsize < info->reserved)
+                calcsize = info->reserved;
+
         if(calcsize != info->allocated) {
 
                 /// Reallocate to fit newly calculated size.
@@ -201,8 +215,14 @@ j2string_update(
                         info, J2_STRING_GET_MEMORY_SIZE(calcsize));
                 if(errno == ENOMEM || info == NULL) return string;
 
+                J2_STATS_ADD(J2_STATS_REALLOC, 1);
+                J2_STATS_ADD(calcsize > info->allocated ? J2_STATS_GROW 
+                                                        : J2_STATS_SHRINK, 1);
+                J2_TRACE2(string_realloc, info->allocated, calcsize);
+
                 /// Failsafe NULL value.
                 info->allocated = calcsize;
+                J2_STRING_HASH_INVALIDATE(info);
                 J2_STRING_REACH_FOR_STRING(info)[
                         calcsize // J2_STRING_GET_MEMORY_SIZE has one byte
                                  // outside of the string for storing a failsafe
@@ -223,6 +243,209 @@ j2string_update(
 
 }
 
+/**
+ * @fn @c j2string_reserve(2)
+ * 
+ *      @brief 
+ *      Make sure the dynamic j2string @c "string" has room for @c "size" bytes
+ *      (null value included) without going through the padding.
+ *      
+ *      The reserved size also stays as a floor for j2string_update() so 
+ *      shrinking the contents of @c "string" doesn't give the memory back,
+ *      j2string_shrink_to_fit() removes it.
+ * 
+ * 
+ *      @param @b string
+ *                The dynamic j2string type string to reserve memory for.
+ *      
+ *      @param @b size
+ *                The amount of bytes to reserve, clamped to the @c max of 
+ *                @c "string".
+ * 
+ * 
+ *      @throw @a EINVAL - If @c "string" points NULL, @c "string" isn't of type
+ *                         j2string or size <= 0.
+ *      @throw @a ERANGE - If @c "string" is a static j2string or a sink.
+ *      @throw @a ENOMEM - If @c realloc() fails with ENOMEM.
+ * 
+ * 
+ *      @return The j2string @c "string" with at least @c "size" bytes 
+ *      allocated or the unaltered original @c "string" if an error occured.
+ * 
+ */
+j2string
+j2string_reserve(
+        j2string string,
+        long size )
+{
+
+#ifdef __J2_DEV__
+        if(string == NULL 
+        || size < 1){
+
+                errno = EINVAL;
+                return string;
+
+        } else if( J2_STRING_INFO(string) == NULL){
+
+                errno = EINVAL;
+                return string;
+
+        }
+#endif
+
+        struct j2string_st * info = J2_STRING_INFO(string);
+
+        if(info->padding == 0 || J2_STRING_IS_SINK(info)) {
+                errno = ERANGE;
+                return string;
+        }
+
+        if((size_t)size > info->max) 
+                size = (long)info->max;
+
+        info->reserved = (size_t)size;
+
+        if((size_t)size > info->allocated) {
+
+                errno = 0;
+                info  = realloc(
+                        info, J2_STRING_GET_MEMORY_SIZE(size));
+                if(errno == ENOMEM || info == NULL) return string;
+
+                J2_STATS_ADD(J2_STATS_REALLOC, 1);
+                J2_STATS_ADD(J2_STATS_GROW, 1);
+                J2_TRACE2(string_realloc, info->allocated, (size_t)size);
+
+                info->allocated = (size_t)size;
+                J2_STRING_REACH_FOR_STRING(info)[size] = '\0';
+
+        }
+
+        return J2_STRING_REACH_FOR_STRING(info);
+
+}
+
+/**
+ * @fn @c j2string_shrink_to_fit(1)
+ * 
+ *      @brief 
+ *      Resize the dynamic j2string @c "string" to exactly fit its contents 
+ *      and the null value, without going through the padding. Any size 
+ *      reserved by j2string_reserve() is dropped.
+ * 
+ * 
+ *      @param @b string
+ *                The dynamic j2string type string to shrink.
+ * 
+ * 
+ *      @throw @a EINVAL - If @c "string" points NULL or @c "string" isn't of 
+ *                         type j2string.
+ *      @throw @a ERANGE - If @c "string" is a static j2string or a sink.
+ *      @throw @a ENOMEM - If @c realloc() fails with ENOMEM.
+ * 
+ * 
+ *      @return The shrunk j2string or the unaltered original @c "string" if an
+ *      error occured.
+ * 
+ */
+j2string
+j2string_shrink_to_fit(
+        j2string string )
+{
+
+#ifdef __J2_DEV__
+        if(string == NULL){
+
+                errno = EINVAL;
+                return string;
+
+        } else if( J2_STRING_INFO(string) == NULL){
+
+                errno = EINVAL;
+                return string;
+
+        }
+#endif
+
+        struct j2string_st * info = J2_STRING_INFO(string);
+
+        if(info->padding == 0 || J2_STRING_IS_SINK(info)) {
+                errno = ERANGE;
+                return string;
+        }
+
+        info->reserved = 0;
+
+        size_t size = info->filled + 1;
+        if(size != info->allocated) {
+
+                errno = 0;
+                info  = realloc(
+                        info, J2_STRING_GET_MEMORY_SIZE(size));
+                if(errno == ENOMEM || info == NULL) return string;
+
+                J2_STATS_ADD(J2_STATS_REALLOC, 1);
+                J2_STATS_ADD(size > info->allocated ? J2_STATS_GROW 
+                                                    : J2_STATS_SHRINK, 1);
+                J2_TRACE2(string_realloc, info->allocated, size);
+
+                info->allocated = size;
+                J2_STRING_REACH_FOR_STRING(info)[size] = '\0';
+
+        }
+
+        return J2_STRING_REACH_FOR_STRING(info);
+
+}
+
+/**
+ * @fn @c j2string_clear(1)
+ * 
+ *      @brief 
+ *      Empty the j2string @c "string" while keeping all of its memory, 
+ *      for reusing one buffer over and over.
+ * 
+ * 
+ *      @param @b string
+ *                The j2string type string to empty.
+ * 
+ * 
+ *      @throw @a EINVAL - If @c "string" points NULL or @c "string" isn't of 
+ *                         type j2string.
+ * 
+ * 
+ *      @return Nothing.
+ * 
+ */
+void
+j2string_clear(
+        j2string string )
+{
+
+#ifdef __J2_DEV__
+        if(string == NULL){
+
+                errno = EINVAL;
+                return;
+
+        } else if( J2_STRING_INFO(string) == NULL){
+
+                errno = EINVAL;
+                return;
+
+        }
+#endif
+
+        struct j2string_st * info = J2_STRING_INFO(string);
+
+        info->filled = 0;
+        info->length = 0;
+        string[0]    = '\0';
+        J2_STRING_HASH_INVALIDATE(info);
+
+}
+
 /**
  * @fn @c j2string_normalize_param(2)
  * 
@@ -0,0 +1,506 @@
+/*** LICENSE: LGPLV2. *************************************
+ *                                                        *
+ *                                                        *
+ * This file is a part of the j2 project.                 *
+ * Copyright (C) 2022 Joško Križanović                    *
+ * <jkriza02@fesb.com>                                    *
+ *                                                        *
+ * This library is free software; you can redistribute    *
+ * it and/or modify it under the terms of the GNU Lesser  *
+ * General Public License as published by the Free        *
+ * Software Foundation; either version 2.1 of the         *
+ * License, or (at your option) any later version.        *
+ *                                                        *
+ * This library is distributed in the hope that it will   *
+ * be useful,                                             *
+ * but WITHOUT ANY WARRANTY; without even the implied     *
+ * warranty of MERCHANTABILITY or FITNESS FOR A           *
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public  *
+ * License for more details.                              *
+ *                                                        *
+ * You should have received a copy of the GNU Lesser      *
+ * General Public License along with this library; if     *
+ * not, write to the Free Software Foundation, Inc.,      *
+ * 51 Franklin Street, Fifth Floor, Boston,               *
+ * MA  02110-1301  USA                                    *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: FILE, AUTHOR & DATE INFORMATION. *********
+ *                                                        *
+ *                                                        *
+ * FILE:                                                  *
+ * Intern pool handing out one shared immutable j2string  *
+ * for every distinct content, so equal strings compare   *
+ * by pointer.                                            *
+ *                                                        *
+ *                                                        *
+ * AUTHOR:                                                *
+ *      NAME:  Joško Križanović                           *
+ *      EMAIL: jkriza02@fesb.com                          *
+ *                                                        *
+ *                                                        *
+ * DATE:                                                  *
+ * 19.10.2026.                                            *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+#include "../string.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <pthread.h>
+
+/**
+ * Starting amount of slots inside of every shard, always a power of 2.
+ */
+#define J2_STRING_INTERN_SLOTS 64
+
+/**
+ * @struct @c j2string_intern_slot
+ * 
+ *      @brief One slot of a shards open addressing table, empty when 
+ *      @c "string" is NULL.
+ * 
+ */
+struct j2string_intern_slot {
+
+        j2string string;
+        uint64_t hash;
+        size_t   refs;
+
+};
+
+/**
+ * @struct @c j2string_intern_shard
+ * 
+ *      @brief A linear probing table with its own lock, the top bits of the
+ *      hash pick the shard so threads interning different strings rarely 
+ *      wait on each other.
+ * 
+ */
+struct j2string_intern_shard {
+
+        _Alignas(64) pthread_mutex_t lock;
+        struct j2string_intern_slot * slots;
+        size_t capacity;
+        size_t count;
+
+};
+
+struct j2string_intern_pool {
+
+        struct j2string_intern_shard shards[J2_STRING_INTERN_SHARDS];
+        bool refcount;
+
+};
+
+static inline struct j2string_intern_shard *
+intern_shard(
+        j2string_intern_pool * pool,
+        uint64_t hash )
+{
+        return &pool->shards[hash >> 56 & (J2_STRING_INTERN_SHARDS - 1)];
+}
+
+/**
+ * @brief 
+ * Double the amount of slots in @c "shard", returns -1 if out of memory.
+ */
+static int
+intern_grow(
+        struct j2string_intern_shard * shard )
+{
+
+        size_t capacity = shard->capacity * 2;
+        struct j2string_intern_slot * slots = calloc(
+                capacity, sizeof(struct j2string_intern_slot)
+        );
+        if(!slots) {
+                errno = ENOMEM;
+                return -1;
+        }
+
+        for(size_t i = 0; i < shard->capacity; i++) {
+                if(!shard->slots[i].string) continue;
+                size_t j = shard->slots[i].hash & (capacity - 1);
+                while(slots[j].string) j = (j + 1) & (capacity - 1);
+                slots[j] = shard->slots[i];
+        }
+
+        free(shard->slots);
+        shard->slots    = slots;
+        shard->capacity = capacity;
+
+        return 0;
+
+}
+
+/**
+ * @brief 
+ * Find or add @c "bytes" bytes of @c "str" hashed to @c "hash", 
+ * @c "length" is its UTF-8 length or SIZE_MAX if it still has to be 
+ * counted.
+ */
+static const_j2string
+intern_sn(
+        j2string_intern_pool * pool,
+        const char * str,
+        size_t bytes,
+        size_t length,
+        uint64_t hash )
+{
+
+        struct j2string_intern_shard * shard = intern_shard(pool, hash);
+
+        pthread_mutex_lock(&shard->lock);
+
+        size_t mask = shard->capacity - 1;
+        size_t i    = hash & mask;
+        for(; shard->slots[i].string; i = (i + 1) & mask) {
+
+                struct j2string_intern_slot * slot = &shard->slots[i];
+                if(slot->hash == hash
+                && J2_STRING_INFO(slot->string)->filled == bytes
+                && !memcmp(slot->string, str, bytes)) {
+                        if(pool->refcount) slot->refs++;
+                        j2string found = slot->string;
+                        pthread_mutex_unlock(&shard->lock);
+                        return found;
+                }
+
+        }
+
+        /// Not inside yet, keep the load under 3/4.
+        if((shard->count + 1) * 4 > shard->capacity * 3) {
+                if(intern_grow(shard)) {
+                        pthread_mutex_unlock(&shard->lock);
+                        return NULL;
+                }
+                mask = shard->capacity - 1;
+                i    = hash & mask;
+                while(shard->slots[i].string) i = (i + 1) & mask;
+        }
+
+        /// A static j2string of the exact size, nothing can grow it.
+        j2string string = j2string_allocate((j2string_param){
+                .allocate = bytes + 1,
+                .padding  = 0,
+                .max      = bytes + 1
+        });
+        if(!string) {
+                pthread_mutex_unlock(&shard->lock);
+                errno = ENOMEM;
+                return NULL;
+        }
+
+        memcpy(string, str, bytes);
+        string[bytes] = '\0';
+
+        struct j2string_st * info = J2_STRING_INFO(string);
+        info->filled = bytes;
+        info->length = length != SIZE_MAX ? length 
+                     : bytes ? j2string_utf8_strlen_sn(str, bytes, NULL) 
+                     : 0;
+        info->hash   = hash;
+
+        shard->slots[i].string = string;
+        shard->slots[i].hash   = hash;
+        shard->slots[i].refs   = 1;
+        shard->count++;
+
+        pthread_mutex_unlock(&shard->lock);
+
+        return string;
+
+}
+
+/**
+ * @fn @c j2string_intern_new(1)
+ * 
+ *      @brief Create an empty intern pool.
+ * 
+ * 
+ *      @param @b refcount
+ *             If true every j2string_intern() call takes a reference that
+ *             has to be given back with j2string_intern_release(), the 
+ *             string is freed when the last one is. Otherwise strings live
+ *             until the pool is freed.
+ * 
+ * 
+ *      @throw @a ENOMEM - Exhausted all memory spaces.
+ * 
+ * 
+ *      @returns The new pool or NULL on failure.
+ * 
+ */
+j2string_intern_pool *
+j2string_intern_new(
+        bool refcount )
+{
+
+        /// Every shard starts on its own cache line, malloc() only gives 16
+        /// bytes of alignment.
+        j2string_intern_pool * pool = aligned_alloc(
+                _Alignof(j2string_intern_pool), 
+                sizeof(j2string_intern_pool)
+        );
+        if(!pool) {
+                errno = ENOMEM;
+                return NULL;
+        }
+
+        pool->refcount = refcount;
+
+        for(size_t s = 0; s < J2_STRING_INTERN_SHARDS; s++) {
+
+                struct j2string_intern_shard * shard = &pool->shards[s];
+                shard->capacity = J2_STRING_INTERN_SLOTS;
+                shard->count    = 0;
+                shard->slots    = calloc(
+                        J2_STRING_INTERN_SLOTS, 
+                        sizeof(struct j2string_intern_slot)
+                );
+
+                if(!shard->slots) {
+                        while(s--) {
+                                pthread_mutex_destroy(&pool->shards[s].lock);
+                                free(pool->shards[s].slots);
+                        }
+                        free(pool);
+                        errno = ENOMEM;
+                        return NULL;
+                }
+
+                pthread_mutex_init(&shard->lock, NULL);
+
+        }
+
+        return pool;
+
+}
+
+/**
+ * @fn @c j2string_intern_free(1)
+ * 
+ *      @brief Free the pool and every string inside of it, no matter how 
+ *      many references are still out there.
+ * 
+ */
+void
+j2string_intern_free(
+        j2string_intern_pool * pool )
+{
+
+        if(!pool) return;
+
+        for(size_t s = 0; s < J2_STRING_INTERN_SHARDS; s++) {
+                struct j2string_intern_shard * shard = &pool->shards[s];
+                for(size_t i = 0; i < shard->capacity; i++)
+                        if(shard->slots[i].string) 
+                                j2string_free(shard->slots[i].string);
+                free(shard->slots);
+                pthread_mutex_destroy(&shard->lock);
+        }
+
+        free(pool);
+
+}
+
+/**
+ * @fn @c j2string_intern(2)
+ * 
+ *      @brief Get the canonical copy of the contents of @c "string" from 
+ *      @c "pool", adding it if it isn't inside yet.
+ * 
+ *      Two interned strings from the same pool are equal exactly when their
+ *      pointers are. The returned string is a static j2string and must not 
+ *      be changed or freed with j2string_free(). Safe to call from many 
+ *      threads at once.
+ * 
+ * 
+ *      @param @b pool
+ *             The intern pool.
+ * 
+ *      @param @b string
+ *             j2string type string whose contents are interned.
+ * 
+ * 
+ *      @throw @a EINVAL - If @c "pool" or @c "string" are NULL ptrs or 
+ *                         @c "string" isn't a valid j2string.
+ *      @throw @a ENOMEM - Exhausted all memory spaces.
+ * 
+ * 
+ *      @returns The canonical j2string or NULL on failure.
+ * 
+ */
+const_j2string
+j2string_intern(
+        j2string_intern_pool * pool,
+        const_j2string string )
+{
+
+#ifdef __J2_DEV__
+        const struct j2string_st * check = 
+                string ? J2_STRING_INFO(string) : NULL;
+        if(!pool || !check) {
+                errno = EINVAL;
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_intern() /"
+                        " j2.string.intern.get() parameter"
+                        " pool/string is a NULL ptr or string"
+                        " contains invalid j2string info.");
+                return NULL;
+        }
+#endif
+
+        const struct j2string_st * info = J2_STRING_INFO(string);
+
+        return intern_sn(pool, string, info->filled, info->length, 
+                         j2string_hash(string));
+
+}
+
+/**
+ * @fn @c j2string_cintern(2)
+ * 
+ *      @brief Same as @c j2string_intern(2) but for a C type string.
+ * 
+ * 
+ *      @throw @a EINVAL - If @c "pool" or @c "cstr" are NULL ptrs.
+ *      @throw @a ENOMEM - Exhausted all memory spaces.
+ * 
+ * 
+ *      @returns The canonical j2string or NULL on failure.
+ * 
+ */
+const_j2string
+j2string_cintern(
+        j2string_intern_pool * pool,
+        const char * cstr )
+{
+
+#ifdef __J2_DEV__
+        if(!pool || !cstr) {
+                errno = EINVAL;
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_cintern() /"
+                        " j2.string.intern.cget() parameter"
+                        " pool/cstr is a NULL ptr.");
+                return NULL;
+        }
+#endif
+
+        size_t bytes = strlen(cstr);
+
+        return intern_sn(pool, cstr, bytes, SIZE_MAX, 
+                         j2string_chash_sn(cstr, bytes));
+
+}
+
+/**
+ * @fn @c j2string_intern_release(2)
+ * 
+ *      @brief Give back a reference taken by j2string_intern() or 
+ *      j2string_cintern(), the last one frees the string. Does nothing for
+ *      pools created without reference counting.
+ * 
+ * 
+ *      @param @b pool
+ *             The intern pool @c "string" came from.
+ * 
+ *      @param @b string
+ *             An interned string of @c "pool".
+ * 
+ * 
+ *      @throw @a EINVAL - If @c "pool" or @c "string" are NULL ptrs.
+ * 
+ * 
+ *      @returns Nothing.
+ * 
+ */
+void
+j2string_intern_release(
+        j2string_intern_pool * pool,
+        const_j2string string )
+{
+
+#ifdef __J2_DEV__
+        if(!pool || !string) {
+                errno = EINVAL;
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_intern_release() /"
+                        " j2.string.intern.release() parameter"
+                        " pool/string is a NULL ptr.");
+                return;
+        }
+#endif
+
+        if(!pool->refcount) return;
+
+        uint64_t hash = j2string_hash(string);
+        struct j2string_intern_shard * shard = intern_shard(pool, hash);
+
+        pthread_mutex_lock(&shard->lock);
+
+        size_t mask = shard->capacity - 1;
+        size_t i    = hash & mask;
+        while(shard->slots[i].string && shard->slots[i].string != string)
+                i = (i + 1) & mask;
+
+        if(!shard->slots[i].string || --shard->slots[i].refs) {
+                pthread_mutex_unlock(&shard->lock);
+                return;
+        }
+
+        j2string_free(shard->slots[i].string);
+        shard->count--;
+
+        /// Backward shift deletion, pull every following slot of the 
+        /// cluster that may sit at "i" one step closer to its home.
+        size_t j = i;
+        while(1) {
+                shard->slots[i].string = NULL;
+                size_t home;
+                do {
+                        j = (j + 1) & mask;
+                        if(!shard->slots[j].string) {
+                                pthread_mutex_unlock(&shard->lock);
+                                return;
+                        }
+                        home = shard->slots[j].hash & mask;
+                } while(i <= j ? (i < home && home <= j) 
+                               : (i < home || home <= j));
+                shard->slots[i] = shard->slots[j];
+                i = j;
+        }
+
+}
+
+/**
+ * @fn @c j2string_intern_count(1)
+ * 
+ *      @returns The amount of distinct strings inside of @c "pool".
+ * 
+ */
+size_t
+j2string_intern_count(
+        j2string_intern_pool * pool )
+{
+
+        if(!pool) return 0;
+
+        size_t count = 0;
+        for(size_t s = 0; s < J2_STRING_INTERN_SHARDS; s++) {
+                pthread_mutex_lock(&pool->shards[s].lock);
+                count += pool->shards[s].count;
+                pthread_mutex_unlock(&pool->shards[s].lock);
+        }
+
+        return count;
+
+}
@@ -0,0 +1,409 @@
+/*** LICENSE: LGPLV2. *************************************
+ *                                                        *
+ *                                                        *
+ * This file is a part of the j2 project.                 *
+ * Copyright (C) 2022 Joško Križanović                    *
+ * <jkriza02@fesb.com>                                    *
+ *                                                        *
+ * This library is free software; you can redistribute    *
+ * it and/or modify it under the terms of the GNU Lesser  *
+ * General Public License as published by the Free        *
+ * Software Foundation; either version 2.1 of the         *
+ * License, or (at your option) any later version.        *
+ *                                                        *
+ * This library is distributed in the hope that it will   *
+ * be useful,                                             *
+ * but WITHOUT ANY WARRANTY; without even the implied     *
+ * warranty of MERCHANTABILITY or FITNESS FOR A           *
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public  *
+ * License for more details.                              *
+ *                                                        *
+ * You should have received a copy of the GNU Lesser      *
+ * General Public License along with this library; if     *
+ * not, write to the Free Software Foundation, Inc.,      *
+ * 51 Franklin Street, Fifth Floor, Boston,               *
+ * MA  02110-1301  USA                                    *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: FILE, AUTHOR & DATE INFORMATION. *********
+ *                                                        *
+ *                                                        *
+ * FILE:                                                  *
+ * Reading files and file descriptors straight into the   *
+ * payload of a j2string, counting UTF-8 characters while *
+ * the bytes come in, and reading lines into one reused   *
+ * string.                                                *
+ *                                                        *
+ *                                                        *
+ * AUTHOR:                                                *
+ *      NAME:  Joško Križanović                           *
+ *      EMAIL: jkriza02@fesb.com                          *
+ *                                                        *
+ *                                                        *
+ * DATE:                                                  *
+ * 19.10.2026.                                            *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+
+/// flockfile() and getc_unlocked().
+#define _DEFAULT_SOURCE
+#define _POSIX_C_SOURCE 200809L
+
+#include "../string.h"
+#include "../utf8.h"
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+
+#ifdef _WIN32
+#include <io.h>
+#define io_read(fd, buffer, size) _read((fd), (buffer), (unsigned)(size))
+#define io_open(path)             _open((path), _O_RDONLY | _O_BINARY)
+#define io_close(fd)              _close(fd)
+#define io_stat                   struct _stat64
+#define io_fstat(fd, st)          _fstat64((fd), (st))
+#define io_lock(stream)           _lock_file(stream)
+#define io_unlock(stream)         _unlock_file(stream)
+#define io_getc(stream)           _getc_nolock(stream)
+#else
+#include <unistd.h>
+#ifdef O_CLOEXEC
+#define io_open(path)             open((path), O_RDONLY | O_CLOEXEC)
+#else
+#define io_open(path)             open((path), O_RDONLY)
+#endif
+#define io_read(fd, buffer, size) read((fd), (buffer), (size))
+#define io_close(fd)              close(fd)
+#define io_stat                   struct stat
+#define io_fstat(fd, st)          fstat((fd), (st))
+#define io_lock(stream)           flockfile(stream)
+#define io_unlock(stream)         funlockfile(stream)
+#define io_getc(stream)           getc_unlocked(stream)
+#endif
+
+/**
+ * @brief 
+ * What a read asks for when the size of what is left is unknown, doubled
+ * with the string after that.
+ */
+#define IO_CHUNK _IEEE1541_INT_KiB(64)
+
+/**
+ * @brief 
+ * Most a single read() is asked for, within what every platform takes.
+ */
+#define IO_READ_MAX _IEEE1541_INT_GiB(1)
+
+/**
+ * @brief 
+ * Bytes of @c "fd" that are still ahead of its offset if it is a regular
+ * file, 0 if it can't be known.
+ */
+static size_t
+io_remaining(
+        int fd )
+{
+
+        io_stat st;
+        if(io_fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size <= 0) 
+                return 0;
+
+#ifdef _WIN32
+        long long offset = _lseeki64(fd, 0, SEEK_CUR);
+#else
+        off_t offset = lseek(fd, 0, SEEK_CUR);
+#endif
+        if(offset < 0 || offset >= st.st_size) return 0;
+
+        return (size_t)(st.st_size - offset);
+
+}
+
+/**
+ * @brief 
+ * Make room for @c "want" more bytes behind the contents of 
+ * @c "(*string)", less if its max doesn't allow for it.
+ * 
+ * @returns False if there is no room for even one more byte, errno is 
+ * ERANGE then.
+ */
+static bool
+io_grow(
+        restrict_j2string * string,
+        size_t want )
+{
+
+        struct j2string_st * info = J2_STRING_INFO((*string));
+
+        if(info->allocated - info->filled - 1 < want
+        && info->padding != 0 && info->filled + 1 < info->max) {
+
+                if(want > info->max - info->filled - 1) 
+                        want = info->max - info->filled - 1;
+                (*string) = j2string_update((*string), 
+                        (long)(info->filled + want + 1));
+                info = J2_STRING_INFO((*string));
+
+        }
+
+        if(info->allocated - info->filled <= 1) {
+                errno = ERANGE;
+                return false;
+        }
+        return true;
+
+}
+
+/**
+ * @fn @c j2string_read_fd(2)
+ * 
+ *      @brief Read @c "fd" until its end and append everything onto 
+ *      @c "(*string)". A regular file is reserved for in one go from its
+ *      size, anything else grows the string by doubling. The bytes are 
+ *      read straight into the payload and counted as UTF-8 characters on 
+ *      the way, they are not checked or filtered like j2string_ccat() does.
+ * 
+ *      @param @b string
+ *             j2string to append to, dynamic to read more than fits into it.
+ *      @param @b fd
+ *             Open file descriptor to read from.
+ * 
+ *      @throw @a EINVAL - If @c string and/or @c (*string) are NULL 
+ *                         pointers or @c fd is negative.
+ *      @throw @a ERANGE - If the string reached its max, or is static and
+ *                         full, before the end of @c "fd". What fit was
+ *                         read and the rest is left in @c "fd".
+ *      @throw @a ...    - Anything read() throws.
+ * 
+ *      @returns The number of bytes appended, or -1 if read() failed. The
+ *      bytes read before the failure stay in the string.
+ * 
+ */
+long
+j2string_read_fd(
+        restrict_j2string * string,
+        int fd )
+{
+
+#ifdef __J2_DEV__
+        if(!string || !(*string) || fd < 0) {
+                errno = EINVAL;
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_read_fd() / j2.string.io.read_fd()"
+                        " parameter string/(*string) is a NULL ptr or fd"
+                        " is negative.");
+                return -1;
+        }
+#endif
+
+        struct j2string_st * info = J2_STRING_INFO((*string));
+        size_t expected = io_remaining(fd);
+        size_t total    = 0;
+
+        /// Room for all of a regular file at once.
+        if(expected) io_grow(string, expected);
+        info = J2_STRING_INFO((*string));
+
+        while(1) {
+
+                if(info->allocated - info->filled <= 1) {
+
+                        /// A regular file read whole doesn't need room for 
+                        /// the read() that would return 0.
+                        if(expected && total >= expected) break;
+
+                        if(!io_grow(string, expected > total ? expected - total
+                                          : info->filled > IO_CHUNK 
+                                          ? info->filled : IO_CHUNK)) break;
+                        info = J2_STRING_INFO((*string));
+
+                }
+
+                size_t space = info->allocated - info->filled - 1;
+                if(space > IO_READ_MAX) space = IO_READ_MAX;
+
+                long got = (long)io_read(fd, (*string) + info->filled, space);
+                if(got < 0) {
+                        if(errno == EINTR) continue;
+                        (*string)[info->filled] = '\0';
+                        J2_STRING_HASH_INVALIDATE(info);
+                        return -1;
+                }
+                if(got == 0) break;
+
+                info->length += utf8_count((*string) + info->filled, 
+                                           (size_t)got);
+                info->filled += (size_t)got;
+                total        += (size_t)got;
+
+        }
+
+        (*string)[info->filled] = '\0';
+        J2_STRING_HASH_INVALIDATE(info);
+
+        return (long)total;
+
+}
+
+/**
+ * @fn @c j2string_read_file(2)
+ * 
+ *      @brief Create a j2string holding the whole file at @c "path", sized
+ *      from the file so it is allocated and read once.
+ * 
+ *      @param @b path
+ *             Path of the file.
+ *      @param @b parameters
+ *             Like j2string_init(), except that a @c max of 0 means the 
+ *             size of the file (J2_STRING_MAX_SIZE for smaller files) instead 
+ *             of J2_STRING_MAX_SIZE, and @c allocate of 0 the size of the 
+ *             file. A padding of 0 gives a static string that holds the 
+ *             file as it was when it was opened.
+ * 
+ *      @throw @a EINVAL - If @c path is a NULL pointer.
+ *      @throw @a ERANGE - If the file didn't fit under @c max, the string 
+ *                         holds what did.
+ *      @throw @a ...    - Anything open(), read() and j2string_allocate() 
+ *                         throw.
+ * 
+ *      @returns The new j2string or NULL if the file couldn't be opened or
+ *      read.
+ * 
+ */
+j2string
+j2string_read_file(
+        const char * path,
+        j2string_param parameters )
+{
+
+#ifdef __J2_DEV__
+        if(!path) {
+                errno = EINVAL;
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_read_file() / j2.string.io.read_file()"
+                        " parameter path is a NULL ptr.");
+                return NULL;
+        }
+#endif
+
+        int fd = io_open(path);
+        if(fd < 0) return NULL;
+
+        size_t size = io_remaining(fd);
+
+        if(parameters.max == 0) 
+                parameters.max = size + 1 > J2_STRING_MAX_SIZE 
+                               ? size + 1 : J2_STRING_MAX_SIZE;
+        if(parameters.allocate == 0) 
+                parameters.allocate = size + 1;
+
+        j2string string = j2string_allocate(
+                j2string_normalize_param(parameters, (long)(size + 1)));
+        if(!string) {
+                io_close(fd);
+                return NULL;
+        }
+
+        long got   = j2string_read_fd(&string, fd);
+        int  error = errno;
+
+        io_close(fd);
+        if(got < 0) {
+                j2string_free(string);
+                string = NULL;
+        }
+
+        errno = error;
+        return string;
+
+}
+
+/**
+ * @fn @c j2string_getline(2)
+ * 
+ *      @brief Read the next line of @c "stream" into @c "(*line)", which
+ *      is cleared first. Reusing one dynamic string for every line of a 
+ *      stream reads them without allocating once it grew to the longest
+ *      one. The line is read with the stream locked once, byte by byte 
+ *      straight into the payload, null characters inside of it are kept.
+ * 
+ *      @param @b line
+ *             j2string to read the line into.
+ *      @param @b stream
+ *             Stream to read from.
+ * 
+ *      @throw @a EINVAL - If @c line, @c (*line) and/or @c stream are 
+ *                         NULL pointers.
+ *      @throw @a ERANGE - If the line didn't fit under the max of the 
+ *                         string, the rest of it is left in @c "stream".
+ * 
+ *      @returns The number of bytes read including the new line character,
+ *      or -1 at the end of the stream or on an error, ferror() tells them 
+ *      apart.
+ * 
+ */
+long
+j2string_getline(
+        restrict_j2string * line,
+        FILE * stream )
+{
+
+#ifdef __J2_DEV__
+        if(!line || !(*line) || !stream) {
+                errno = EINVAL;
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_getline() / j2.string.io.getline()"
+                        " parameter line/(*line)/stream is a NULL ptr.");
+                return -1;
+        }
+#endif
+
+        j2string_clear((*line));
+        struct j2string_st * info = J2_STRING_INFO((*line));
+
+        io_lock(stream);
+
+        int c = EOF;
+        while(1) {
+
+                if(info->allocated - info->filled <= 1) {
+
+                        if(!io_grow(line, info->filled > 128 
+                                          ? info->filled : 128)) break;
+                        info = J2_STRING_INFO((*line));
+
+                }
+
+                char * at   = (*line) + info->filled;
+                size_t room = info->allocated - info->filled - 1;
+                size_t got  = 0;
+
+                while(got < room && (c = io_getc(stream)) != EOF) {
+                        at[got++] = (char)c;
+                        if(c == '\n') break;
+                }
+                at[got] = '\0';
+
+                info->length += utf8_count(at, got);
+                info->filled += got;
+
+                if(c == EOF || c == '\n') break;
+
+        }
+
+        io_unlock(stream);
+
+        J2_STRING_HASH_INVALIDATE(info);
+
+        return info->filled ? (long)info->filled : -1;
+
+}
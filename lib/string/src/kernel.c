@@ -0,0 +1,295 @@
+/*** LICENSE: LGPLV2. *************************************
+ *                                                        *
+ *                                                        *
+ * This file is a part of the j2 project.                 *
+ * Copyright (C) 2022 Joško Križanović                    *
+ * <jkriza02@fesb.com>                                    *
+ *                                                        *
+ * This library is free software; you can redistribute    *
+ * it and/or modify it under the terms of the GNU Lesser  *
+ * General Public License as published by the Free        *
+ * Software Foundation; either version 2.1 of the         *
+ * License, or (at your option) any later version.        *
+ *                                                        *
+ * This library is distributed in the hope that it will   *
+ * be useful,                                             *
+ * but WITHOUT ANY WARRANTY; without even the implied     *
+ * warranty of MERCHANTABILITY or FITNESS FOR A           *
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public  *
+ * License for more details.                              *
+ *                                                        *
+ * You should have received a copy of the GNU Lesser      *
+ * General Public License along with this library; if     *
+ * not, write to the Free Software Foundation, Inc.,      *
+ * 51 Franklin Street, Fifth Floor, Boston,               *
+ * MA  02110-1301  USA                                    *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: FILE, AUTHOR & DATE INFORMATION. *********
+ *                                                        *
+ *                                                        *
+ * FILE:                                                  *
+ * Picking the kernels of the string primitives when the  *
+ * library is loaded, the best the CPU has unless the     *
+ * J2_STRING_KERNEL environment variable pins them.       *
+ *                                                        *
+ *                                                        *
+ * AUTHOR:                                                *
+ *      NAME:  Joško Križanović                           *
+ *      EMAIL: jkriza02@fesb.com                          *
+ *                                                        *
+ *                                                        *
+ * DATE:                                                  *
+ * 19.10.2026.                                            *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+
+#include "kernel.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <errno.h>
+
+struct j2string_kernels j2string_kernel = {
+        .strlen_sn      = &j2string_strlen_sn_scalar,
+        .utf8_strlen_sn = &j2string_utf8_strlen_sn_scalar,
+        .cnt            = &j2string_cnt_scalar,
+        .strcpy_sn      = &j2string_strcpy_sn_scalar,
+        .utf8_strcpy_sn = &j2string_utf8_strcpy_sn_scalar
+};
+
+static const char * const kernel_isa_names[J2_STRING_ISAS] = {
+        [J2_STRING_ISA_SCALAR] = "scalar",
+        [J2_STRING_ISA_NEON]   = "neon",
+        [J2_STRING_ISA_SSE2]   = "sse2",
+        [J2_STRING_ISA_AVX2]   = "avx2",
+        [J2_STRING_ISA_AVX512] = "avx512"
+};
+
+static const char * const kernel_primitive_names[J2_STRING_PRIMITIVES] = {
+        [J2_STRING_PRIMITIVE_STRLEN]      = "strlen",
+        [J2_STRING_PRIMITIVE_UTF8_STRLEN] = "utf8_strlen",
+        [J2_STRING_PRIMITIVE_CNT]         = "cnt",
+        [J2_STRING_PRIMITIVE_STRCPY]      = "strcpy",
+        [J2_STRING_PRIMITIVE_UTF8_STRCPY] = "utf8_strcpy"
+};
+
+static const struct j2string_kernels kernel_scalar = {
+        .strlen_sn      = &j2string_strlen_sn_scalar,
+        .utf8_strlen_sn = &j2string_utf8_strlen_sn_scalar,
+        .cnt            = &j2string_cnt_scalar,
+        .strcpy_sn      = &j2string_strcpy_sn_scalar,
+        .utf8_strcpy_sn = &j2string_utf8_strcpy_sn_scalar
+};
+
+/**
+ * @brief 
+ * Instruction set of the kernel in use for every primitive.
+ */
+static enum j2string_isa kernel_picked[J2_STRING_PRIMITIVES];
+
+/**
+ * @brief 
+ * Kernels of @c "isa" if they were built and the CPU can run them, 
+ * otherwise NULL.
+ */
+static const struct j2string_kernels *
+kernel_set(
+        enum j2string_isa isa )
+{
+
+        switch(isa) {
+        case J2_STRING_ISA_SCALAR:
+                return &kernel_scalar;
+#if defined(J2_STRING_KERNEL_X86)
+        case J2_STRING_ISA_SSE2:
+                __builtin_cpu_init();
+                return __builtin_cpu_supports("sse2") 
+                     ? &j2string_kernels_sse2 : NULL;
+        case J2_STRING_ISA_AVX2:
+                __builtin_cpu_init();
+                return __builtin_cpu_supports("avx2") 
+                    && __builtin_cpu_supports("popcnt")
+                     ? &j2string_kernels_avx2 : NULL;
+        case J2_STRING_ISA_AVX512:
+                __builtin_cpu_init();
+                return __builtin_cpu_supports("avx512f") 
+                    && __builtin_cpu_supports("avx512bw")
+                    && __builtin_cpu_supports("popcnt")
+                     ? &j2string_kernels_avx512 : NULL;
+#elif defined(J2_STRING_KERNEL_NEON)
+        case J2_STRING_ISA_NEON:
+                return &j2string_kernels_neon;
+#endif
+        default:
+                return NULL;
+        }
+
+}
+
+/**
+ * @brief 
+ * The most preferred instruction set the CPU can run.
+ */
+static enum j2string_isa
+kernel_best(
+        void )
+{
+
+        enum j2string_isa isa = J2_STRING_ISAS;
+        while(isa-- > J2_STRING_ISA_SCALAR)
+                if(kernel_set(isa)) return isa;
+        return J2_STRING_ISA_SCALAR;
+
+}
+
+/**
+ * @brief 
+ * Index of the @c "length" long @c "name" in @c "names" or -1.
+ */
+static int
+kernel_lookup(
+        const char * const * names,
+        int count,
+        const char * name,
+        size_t length )
+{
+
+        for(int i = 0; i < count; i++)
+                if(strlen(names[i]) == length 
+                && !strncmp(names[i], name, length)) return i;
+        return -1;
+
+}
+
+/**
+ * @fn @c j2string_kernel_pin(1)
+ * 
+ *      @brief Pick the kernels of the string primitives. @c "spec" is a 
+ *      comma separated list of instruction sets (@c "scalar", @c "sse2",
+ *      @c "avx2", @c "avx512", @c "neon" or @c "auto" for the best one)
+ *      for every primitive, or of @c "primitive=set" pairs for one 
+ *      primitive (@c "strlen", @c "utf8_strlen", @c "cnt", @c "strcpy",
+ *      @c "utf8_strcpy"). Later entries
+ *      win, primitives not named get the best set. A NULL @c "spec" picks
+ *      the best set for every primitive.
+ * 
+ *      The library calls it with the J2_STRING_KERNEL environment variable
+ *      when it is loaded. Pin again only before other threads use strings.
+ * 
+ *      @throw @a EINVAL  - If @c "spec" names an unknown set or primitive.
+ *      @throw @a ENOTSUP - If the CPU can't run a named set or it wasn't 
+ *                          built.
+ * 
+ *      @returns 0, or -1 and nothing is changed.
+ * 
+ */
+int
+j2string_kernel_pin(
+        const char * spec )
+{
+
+        enum j2string_isa picked[J2_STRING_PRIMITIVES];
+        enum j2string_isa best = kernel_best();
+        for(int i = 0; i < J2_STRING_PRIMITIVES; i++) picked[i] = best;
+
+        while(spec && *spec) {
+
+                size_t length = strcspn(spec, ",");
+                const char * equal = memchr(spec, '=', length);
+
+                int primitive = -1;
+                const char * name = spec;
+                size_t namelen = length;
+                if(equal) {
+                        primitive = kernel_lookup(kernel_primitive_names, 
+                                J2_STRING_PRIMITIVES, spec, 
+                                (size_t)(equal - spec));
+                        name    = equal + 1;
+                        namelen = length - (size_t)(name - spec);
+                }
+
+                int isa = namelen == 4 && !strncmp(name, "auto", 4) 
+                        ? (int)best
+                        : kernel_lookup(kernel_isa_names, J2_STRING_ISAS, 
+                                        name, namelen);
+
+                if(isa < 0 || (equal && primitive < 0)) {
+                        errno = EINVAL;
+#ifdef __J2_DEV__
+                        J2_DIAG(J2_DIAG_INVALID,
+                                "j2string_kernel_pin() / j2.string.kernel.pin()"
+                                " parameter spec names an unknown kernel.");
+#endif
+                        return -1;
+                }
+                if(!kernel_set((enum j2string_isa)isa)) {
+                        errno = ENOTSUP;
+                        return -1;
+                }
+
+                if(equal) picked[primitive] = (enum j2string_isa)isa;
+                else for(int i = 0; i < J2_STRING_PRIMITIVES; i++) 
+                        picked[i] = (enum j2string_isa)isa;
+
+                spec += length;
+                if(*spec == ',') spec++;
+
+        }
+
+        j2string_kernel.strlen_sn = kernel_set(
+                picked[J2_STRING_PRIMITIVE_STRLEN])->strlen_sn;
+        j2string_kernel.utf8_strlen_sn = kernel_set(
+                picked[J2_STRING_PRIMITIVE_UTF8_STRLEN])->utf8_strlen_sn;
+        j2string_kernel.cnt = kernel_set(
+                picked[J2_STRING_PRIMITIVE_CNT])->cnt;
+        j2string_kernel.strcpy_sn = kernel_set(
+                picked[J2_STRING_PRIMITIVE_STRCPY])->strcpy_sn;
+        j2string_kernel.utf8_strcpy_sn = kernel_set(
+                picked[J2_STRING_PRIMITIVE_UTF8_STRCPY])->utf8_strcpy_sn;
+
+        memcpy(kernel_picked, picked, sizeof(picked));
+        return 0;
+
+}
+
+/**
+ * @fn @c j2string_kernel_name(1)
+ * 
+ *      @brief Instruction set of the kernel in use for @c "primitive".
+ * 
+ *      @returns Its name or NULL for an unknown primitive.
+ * 
+ */
+const char *
+j2string_kernel_name(
+        enum j2string_primitive primitive )
+{
+
+        if((unsigned)primitive >= J2_STRING_PRIMITIVES) return NULL;
+        return kernel_isa_names[kernel_picked[primitive]];
+
+}
+
+/**
+ * @brief 
+ * Pick the kernels when the library is loaded, without constructors the 
+ * scalar ones stay until j2string_kernel_pin() is called. A bad 
+ * J2_STRING_KERNEL is ignored.
+ */
+#ifdef __GNUC__
+__attribute__((constructor))
+#endif
+static void
+kernel_load(
+        void )
+{
+
+        if(j2string_kernel_pin(getenv("J2_STRING_KERNEL")))
+                j2string_kernel_pin(NULL);
+
+}
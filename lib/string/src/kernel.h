@@ -0,0 +1,353 @@
+/*** LICENSE: LGPLV2. *************************************
+ *                                                        *
+ *                                                        *
+ * This file is a part of the j2 project.                 *
+ * Copyright (C) 2022 Joško Križanović                    *
+ * <jkriza02@fesb.com>                                    *
+ *                                                        *
+ * This library is free software; you can redistribute    *
+ * it and/or modify it under the terms of the GNU Lesser  *
+ * General Public License as published by the Free        *
+ * Software Foundation; either version 2.1 of the         *
+ * License, or (at your option) any later version.        *
+ *                                                        *
+ * This library is distributed in the hope that it will   *
+ * be useful,                                             *
+ * but WITHOUT ANY WARRANTY; without even the implied     *
+ * warranty of MERCHANTABILITY or FITNESS FOR A           *
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public  *
+ * License for more details.                              *
+ *                                                        *
+ * You should have received a copy of the GNU Lesser      *
+ * General Public License along with this library; if     *
+ * not, write to the Free Software Foundation, Inc.,      *
+ * 51 Franklin Street, Fifth Floor, Boston,               *
+ * MA  02110-1301  USA                                    *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: FILE, AUTHOR & DATE INFORMATION. *********
+ *                                                        *
+ *                                                        *
+ * FILE:                                                  *
+ * Kernels of the string primitives for every instruction *
+ * set and the table that calls the ones picked when the  *
+ * library is loaded, with the block walks they share.    *
+ *                                                        *
+ *                                                        *
+ * AUTHOR:                                                *
+ *      NAME:  Joško Križanović                           *
+ *      EMAIL: jkriza02@fesb.com                          *
+ *                                                        *
+ *                                                        *
+ * DATE:                                                  *
+ * 19.10.2026.                                            *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+
+#include "../string.h"
+#include "../utf8.h"
+#include "../../stats/stats.h"
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#ifndef J2_STRING_KERNEL_INCLUDE
+#define J2_STRING_KERNEL_INCLUDE
+
+/**
+ * @brief 
+ * Define J2_STRING_NO_SIMD to only build the scalar kernels.
+ */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) \
+ && !defined(J2_STRING_NO_SIMD)
+#define J2_STRING_KERNEL_X86
+#elif defined(__GNUC__) && defined(__ARM_NEON) && defined(__aarch64__) \
+   && !defined(J2_STRING_NO_SIMD)
+#define J2_STRING_KERNEL_NEON
+#endif
+
+/**
+ * @enum @c j2string_isa
+ * 
+ *      @brief Instruction sets the primitives have kernels for, in the 
+ *      order they are preferred in.
+ * 
+ */
+enum j2string_isa {
+
+        J2_STRING_ISA_SCALAR,
+        J2_STRING_ISA_NEON,
+        J2_STRING_ISA_SSE2,
+        J2_STRING_ISA_AVX2,
+        J2_STRING_ISA_AVX512,
+        J2_STRING_ISAS
+
+};
+
+/**
+ * @struct @c j2string_kernels
+ * 
+ *      @brief One kernel for every primitive. All of them stop at the first
+ *      null character or at @c "max" bytes, whichever comes first, and 
+ *      @c "max" is at least 1. The copies write @c "max" bytes at most, 
+ *      their null character included.
+ * 
+ */
+struct j2string_kernels {
+
+        size_t (*strlen_sn)(
+                const char * str,
+                size_t max
+        );
+        size_t (*utf8_strlen_sn)(
+                const char * str,
+                size_t max,
+                size_t * bytelen
+        );
+        size_t (*cnt)(
+                const char * str,
+                size_t max,
+                unsigned char c
+        );
+        size_t (*strcpy_sn)(
+                char * __restrict dst,
+                const char * __restrict src,
+                size_t max
+        );
+        size_t (*utf8_strcpy_sn)(
+                char * __restrict dst,
+                const char * __restrict src,
+                size_t max,
+                size_t * bytelen
+        );
+
+};
+
+/**
+ * @brief 
+ * The kernels in use, scalar until the library is loaded.
+ */
+extern struct j2string_kernels j2string_kernel;
+
+size_t
+j2string_strlen_sn_scalar(
+        const char * str,
+        size_t max
+);
+
+size_t
+j2string_utf8_strlen_sn_scalar(
+        const char * str,
+        size_t max,
+        size_t * bytelen
+);
+
+size_t
+j2string_cnt_scalar(
+        const char * str,
+        size_t max,
+        unsigned char c
+);
+
+size_t
+j2string_strcpy_sn_scalar(
+        char * __restrict dst,
+        const char * __restrict src,
+        size_t max
+);
+
+size_t
+j2string_utf8_strcpy_sn_scalar(
+        char * __restrict dst,
+        const char * __restrict src,
+        size_t max,
+        size_t * bytelen
+);
+
+#if defined(J2_STRING_KERNEL_X86)
+extern const struct j2string_kernels j2string_kernels_sse2;
+extern const struct j2string_kernels j2string_kernels_avx2;
+extern const struct j2string_kernels j2string_kernels_avx512;
+#elif defined(J2_STRING_KERNEL_NEON)
+extern const struct j2string_kernels j2string_kernels_neon;
+#endif
+
+#if defined(J2_STRING_KERNEL_X86) || defined(J2_STRING_KERNEL_NEON)
+
+/**
+ * @brief 
+ * Mask of the bytes of an aligned block that equal @c "c" or that start a
+ * character, @c "bits" bits for every byte with the first byte lowest.
+ */
+typedef uint64_t (*j2string_kernel_mask)(
+        const char * block,
+        unsigned char c
+);
+
+/**
+ * @brief 
+ * Mask of the lowest @c "count" bytes.
+ */
+static inline uint64_t
+j2string_kernel_below(
+        size_t count,
+        unsigned bits )
+{
+        return count * bits >= 64 ? ~0ULL : (1ULL << (count * bits)) - 1;
+}
+
+/**
+ * @fn @c j2string_kernel_walk(7)
+ * 
+ *      @brief Walk @c "str" in aligned blocks of @c "width" bytes up to
+ *      the first null character or @c "max" bytes. Counts the bytes 
+ *      @c "count" flags on the way if it is given.
+ * 
+ *      An aligned block never crosses into another page, so the walk may 
+ *      read past the null character like strlen() of libc does. The 
+ *      kernels around it are built without address sanitizer checks for
+ *      that reason.
+ * 
+ *      @returns The bytes walked, the count goes into @c "counted".
+ * 
+ */
+static inline __attribute__((always_inline, no_sanitize_address)) size_t
+j2string_kernel_walk(
+        const char * str,
+        size_t max,
+        size_t width,
+        unsigned bits,
+        j2string_kernel_mask zero,
+        j2string_kernel_mask count,
+        unsigned char c,
+        size_t * counted )
+{
+
+        const char * block = (const char *)(
+                (uintptr_t)str & ~(uintptr_t)(width - 1));
+        unsigned skip   = (unsigned)(str - block) * bits;
+        size_t   walked = 0;
+        size_t   span   = width - (size_t)(str - block);
+        size_t   total  = 0;
+
+        while(1) {
+
+                uint64_t nul  = zero(block, '\0') >> skip;
+                size_t   end  = span;
+                int      stop = 0;
+
+                if(nul) {
+                        end  = (size_t)__builtin_ctzll(nul) / bits;
+                        stop = 1;
+                }
+                if(end >= max - walked) {
+                        end  = max - walked;
+                        stop = 1;
+                }
+                if(count) total += (size_t)__builtin_popcountll(
+                        (count(block, c) >> skip) 
+                        & j2string_kernel_below(end, bits)) / bits;
+
+                walked += end;
+                if(stop) break;
+
+                block += width;
+                span   = width;
+                skip   = 0;
+
+        }
+
+        if(counted) (*counted) = total;
+        return walked;
+
+}
+
+/**
+ * @fn @c j2string_kernel_copy(4)
+ * 
+ *      @brief Copy kernel on top of the @c "strlen_sn" kernel of a set, 
+ *      find the end of @c "src" with it and hand the bytes to memcpy().
+ * 
+ *      @returns The bytes copied, the null character not included.
+ * 
+ */
+static inline __attribute__((always_inline)) size_t
+j2string_kernel_copy(
+        char * __restrict dst,
+        const char * __restrict src,
+        size_t max,
+        size_t (*strlen_sn)(const char *, size_t) )
+{
+
+        size_t size = max > 1 ? strlen_sn(src, max - 1) : 0;
+
+        memcpy(dst, src, size);
+        dst[size] = '\0';
+        J2_STATS_ADD(J2_STATS_BYTES_COPIED, size);
+
+        return size;
+
+}
+
+/**
+ * @fn @c j2string_kernel_utf8_copy(6)
+ * 
+ *      @brief Same as j2string_kernel_copy() but drops an unfinished UTF-8
+ *      character from the end of the copy, cut by @c "max" or followed by
+ *      the null character, like the scalar kernel does. The characters are
+ *      counted with the @c "utf8_strlen_sn" kernel of the set.
+ * 
+ *      @returns The UTF-8 characters copied, the bytes go into 
+ *      @c "bytelen".
+ * 
+ */
+static inline __attribute__((always_inline)) size_t
+j2string_kernel_utf8_copy(
+        char * __restrict dst,
+        const char * __restrict src,
+        size_t max,
+        size_t * bytelen,
+        size_t (*strlen_sn)(const char *, size_t),
+        size_t (*utf8_strlen_sn)(const char *, size_t, size_t *) )
+{
+
+        size_t size = max > 1 ? strlen_sn(src, max - 1) : 0;
+
+        if(size) {
+                /// Count the continuation bytes behind the last head, cut
+                /// the head off if it needs more of them.
+                int cnt = 0;
+                for(size_t k = size; k-- > 0;) {
+                        unsigned char byte = (unsigned char)src[k];
+                        if(!is_utf8_payload(byte)) {
+                                cnt++;
+                                continue;
+                        }
+                        if(is_utf8_head_w_type(byte) != cnt) size = k;
+                        break;
+                }
+        }
+
+        memcpy(dst, src, size);
+        dst[size] = '\0';
+        J2_STATS_ADD(J2_STATS_BYTES_COPIED, size);
+
+        if(bytelen) (*bytelen) = size;
+        return size ? utf8_strlen_sn(src, size, NULL) : 0;
+
+}
+
+/**
+ * @brief 
+ * Attributes of a kernel built for the instruction set @c "isa".
+ */
+#define J2_STRING_KERNEL_TARGET(isa) \
+        __attribute__((target(isa), no_sanitize_address))
+
+#endif
+
+#endif /** @c J2_STRING_KERNEL_INCLUDE */
@@ -0,0 +1,162 @@
+/*** LICENSE: LGPLV2. *************************************
+ *                                                        *
+ *                                                        *
+ * This file is a part of the j2 project.                 *
+ * Copyright (C) 2022 Joško Križanović                    *
+ * <jkriza02@fesb.com>                                    *
+ *                                                        *
+ * This library is free software; you can redistribute    *
+ * it and/or modify it under the terms of the GNU Lesser  *
+ * General Public License as published by the Free        *
+ * Software Foundation; either version 2.1 of the         *
+ * License, or (at your option) any later version.        *
+ *                                                        *
+ * This library is distributed in the hope that it will   *
+ * be useful,                                             *
+ * but WITHOUT ANY WARRANTY; without even the implied     *
+ * warranty of MERCHANTABILITY or FITNESS FOR A           *
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public  *
+ * License for more details.                              *
+ *                                                        *
+ * You should have received a copy of the GNU Lesser      *
+ * General Public License along with this library; if     *
+ * not, write to the Free Software Foundation, Inc.,      *
+ * 51 Franklin Street, Fifth Floor, Boston,               *
+ * MA  02110-1301  USA                                    *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: FILE, AUTHOR & DATE INFORMATION. *********
+ *                                                        *
+ *                                                        *
+ * FILE:                                                  *
+ * NEON kernels of the string primitives, NEON is always  *
+ * there on AArch64.                                      *
+ *                                                        *
+ *                                                        *
+ * AUTHOR:                                                *
+ *      NAME:  Joško Križanović                           *
+ *      EMAIL: jkriza02@fesb.com                          *
+ *                                                        *
+ *                                                        *
+ * DATE:                                                  *
+ * 19.10.2026.                                            *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+
+#include "kernel.h"
+
+#ifdef J2_STRING_KERNEL_NEON
+
+#include <arm_neon.h>
+
+/**
+ * @brief 
+ * NEON has no movemask, narrowing the 0x00/0xFF compare result by 4 bits 
+ * leaves 4 bits for every byte in a 64 bit mask instead.
+ */
+static inline __attribute__((no_sanitize_address)) uint64_t
+neon_mask(
+        uint8x16_t compared )
+{
+        return vget_lane_u64(vreinterpret_u64_u8(
+                vshrn_n_u16(vreinterpretq_u16_u8(compared), 4)), 0);
+}
+
+static inline __attribute__((no_sanitize_address)) uint64_t
+neon_match(
+        const char * block,
+        unsigned char c )
+{
+        uint8x16_t bytes = vld1q_u8((const uint8_t *)block);
+        return neon_mask(vceqq_u8(bytes, vdupq_n_u8(c)));
+}
+
+/**
+ * @brief 
+ * Characters start on every byte that isn't a continuation byte, 
+ * 0x80 to 0xBF.
+ */
+static inline __attribute__((no_sanitize_address)) uint64_t
+neon_lead(
+        const char * block,
+        unsigned char c )
+{
+        uint8x16_t bytes = vld1q_u8((const uint8_t *)block);
+        return neon_mask(vmvnq_u8(vceqq_u8(vandq_u8(bytes, vdupq_n_u8(0xC0)),
+                                           vdupq_n_u8(0x80))));
+}
+
+static __attribute__((no_sanitize_address)) size_t
+neon_strlen_sn(
+        const char * str,
+        size_t max )
+{
+        return j2string_kernel_walk(str, max, 16, 4, 
+                                    &neon_match, NULL, '\0', NULL);
+}
+
+static __attribute__((no_sanitize_address)) size_t
+neon_utf8_strlen_sn(
+        const char * str,
+        size_t max,
+        size_t * bytelen )
+{
+        size_t characters = 0;
+        size_t walked = j2string_kernel_walk(str, max, 16, 4, 
+                                             &neon_match, &neon_lead,
+                                             '\0', &characters);
+        if(bytelen) (*bytelen) = walked;
+        return characters;
+}
+
+static __attribute__((no_sanitize_address)) size_t
+neon_cnt(
+        const char * str,
+        size_t max,
+        unsigned char c )
+{
+        size_t found = 0;
+        j2string_kernel_walk(str, max, 16, 4, 
+                             &neon_match, &neon_match, c, &found);
+        return found;
+}
+
+static __attribute__((no_sanitize_address)) size_t
+neon_strcpy_sn(
+        char * __restrict dst,
+        const char * __restrict src,
+        size_t max )
+{
+        return j2string_kernel_copy(dst, src, max, &neon_strlen_sn);
+}
+
+static __attribute__((no_sanitize_address)) size_t
+neon_utf8_strcpy_sn(
+        char * __restrict dst,
+        const char * __restrict src,
+        size_t max,
+        size_t * bytelen )
+{
+        return j2string_kernel_utf8_copy(dst, src, max, bytelen,
+                                         &neon_strlen_sn, 
+                                         &neon_utf8_strlen_sn);
+}
+
+const struct j2string_kernels j2string_kernels_neon = {
+        .strlen_sn      = &neon_strlen_sn,
+        .utf8_strlen_sn = &neon_utf8_strlen_sn,
+        .cnt            = &neon_cnt,
+        .strcpy_sn      = &neon_strcpy_sn,
+        .utf8_strcpy_sn = &neon_utf8_strcpy_sn
+};
+
+#else
+
+/// ISO C doesn't allow an empty translation unit.
+typedef int j2string_kneon_unused;
+
+#endif
@@ -0,0 +1,206 @@
+/*** LICENSE: LGPLV2. *************************************
+ *                                                        *
+ *                                                        *
+ * This file is a part of the j2 project.                 *
+ * Copyright (C) 2022 Joško Križanović                    *
+ * <jkriza02@fesb.com>                                    *
+ *                                                        *
+ * This library is free software; you can redistribute    *
+ * it and/or modify it under the terms of the GNU Lesser  *
+ * General Public License as published by the Free        *
+ * Software Foundation; either version 2.1 of the         *
+ * License, or (at your option) any later version.        *
+ *                                                        *
+ * This library is distributed in the hope that it will   *
+ * be useful,                                             *
+ * but WITHOUT ANY WARRANTY; without even the implied     *
+ * warranty of MERCHANTABILITY or FITNESS FOR A           *
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public  *
+ * License for more details.                              *
+ *                                                        *
+ * You should have received a copy of the GNU Lesser      *
+ * General Public License along with this library; if     *
+ * not, write to the Free Software Foundation, Inc.,      *
+ * 51 Franklin Street, Fifth Floor, Boston,               *
+ * MA  02110-1301  USA                                    *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: FILE, AUTHOR & DATE INFORMATION. *********
+ *                                                        *
+ *                                                        *
+ * FILE:                                                  *
+ * SSE2, AVX2 and AVX-512 kernels of the string           *
+ * primitives. Each is built for its own instruction set  *
+ * with target attributes and only called once the CPU is *
+ * known to have it.                                      *
+ *                                                        *
+ *                                                        *
+ * AUTHOR:                                                *
+ *      NAME:  Joško Križanović                           *
+ *      EMAIL: jkriza02@fesb.com                          *
+ *                                                        *
+ *                                                        *
+ * DATE:                                                  *
+ * 19.10.2026.                                            *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+
+#include "kernel.h"
+
+#ifdef J2_STRING_KERNEL_X86
+
+#include <immintrin.h>
+
+/**
+ * @brief 
+ * Characters start on every byte that isn't a continuation byte, those 
+ * are 0x80 to 0xBF or -128 to -65 as signed bytes.
+ */
+#define X86_LEAD_ABOVE (-65)
+
+static inline J2_STRING_KERNEL_TARGET("sse2") uint64_t
+sse2_match(
+        const char * block,
+        unsigned char c )
+{
+        __m128i bytes = _mm_load_si128((const __m128i *)block);
+        return (uint64_t)(uint32_t)_mm_movemask_epi8(
+                _mm_cmpeq_epi8(bytes, _mm_set1_epi8((char)c)));
+}
+
+static inline J2_STRING_KERNEL_TARGET("sse2") uint64_t
+sse2_lead(
+        const char * block,
+        unsigned char c )
+{
+        __m128i bytes = _mm_load_si128((const __m128i *)block);
+        return (uint64_t)(uint32_t)_mm_movemask_epi8(
+                _mm_cmpgt_epi8(bytes, _mm_set1_epi8(X86_LEAD_ABOVE)));
+}
+
+static inline J2_STRING_KERNEL_TARGET("avx2") uint64_t
+avx2_match(
+        const char * block,
+        unsigned char c )
+{
+        __m256i bytes = _mm256_load_si256((const __m256i *)block);
+        return (uint64_t)(uint32_t)_mm256_movemask_epi8(
+                _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8((char)c)));
+}
+
+static inline J2_STRING_KERNEL_TARGET("avx2") uint64_t
+avx2_lead(
+        const char * block,
+        unsigned char c )
+{
+        __m256i bytes = _mm256_load_si256((const __m256i *)block);
+        return (uint64_t)(uint32_t)_mm256_movemask_epi8(
+                _mm256_cmpgt_epi8(bytes, _mm256_set1_epi8(X86_LEAD_ABOVE)));
+}
+
+static inline J2_STRING_KERNEL_TARGET("avx512f,avx512bw") uint64_t
+avx512_match(
+        const char * block,
+        unsigned char c )
+{
+        __m512i bytes = _mm512_load_si512((const void *)block);
+        return (uint64_t)_mm512_cmpeq_epi8_mask(
+                bytes, _mm512_set1_epi8((char)c));
+}
+
+static inline J2_STRING_KERNEL_TARGET("avx512f,avx512bw") uint64_t
+avx512_lead(
+        const char * block,
+        unsigned char c )
+{
+        __m512i bytes = _mm512_load_si512((const void *)block);
+        return (uint64_t)_mm512_cmpgt_epi8_mask(
+                bytes, _mm512_set1_epi8(X86_LEAD_ABOVE));
+}
+
+/**
+ * @brief 
+ * The kernels of one instruction set, the scans are a walk over blocks
+ * of @c "width" bytes with its mask functions and the copies are built on
+ * top of them.
+ */
+#define X86_KERNELS(isa, target, width)                                        \
+                                                                               \
+static J2_STRING_KERNEL_TARGET(target) size_t                                  \
+isa##_strlen_sn(                                                               \
+        const char * str,                                                      \
+        size_t max )                                                           \
+{                                                                              \
+        return j2string_kernel_walk(str, max, (width), 1,                      \
+                                    &isa##_match, NULL, '\0', NULL);           \
+}                                                                              \
+                                                                               \
+static J2_STRING_KERNEL_TARGET(target) size_t                                  \
+isa##_utf8_strlen_sn(                                                          \
+        const char * str,                                                      \
+        size_t max,                                                            \
+        size_t * bytelen )                                                     \
+{                                                                              \
+        size_t characters = 0;                                                 \
+        size_t walked = j2string_kernel_walk(str, max, (width), 1,             \
+                                             &isa##_match, &isa##_lead,        \
+                                             '\0', &characters);               \
+        if(bytelen) (*bytelen) = walked;                                       \
+        return characters;                                                     \
+}                                                                              \
+                                                                               \
+static J2_STRING_KERNEL_TARGET(target) size_t                                  \
+isa##_cnt(                                                                     \
+        const char * str,                                                      \
+        size_t max,                                                            \
+        unsigned char c )                                                      \
+{                                                                              \
+        size_t found = 0;                                                      \
+        j2string_kernel_walk(str, max, (width), 1,                             \
+                             &isa##_match, &isa##_match, c, &found);           \
+        return found;                                                          \
+}                                                                              \
+                                                                               \
+static J2_STRING_KERNEL_TARGET(target) size_t                                  \
+isa##_strcpy_sn(                                                               \
+        char * __restrict dst,                                                 \
+        const char * __restrict src,                                           \
+        size_t max )                                                           \
+{                                                                              \
+        return j2string_kernel_copy(dst, src, max, &isa##_strlen_sn);          \
+}                                                                              \
+                                                                               \
+static J2_STRING_KERNEL_TARGET(target) size_t                                  \
+isa##_utf8_strcpy_sn(                                                          \
+        char * __restrict dst,                                                 \
+        const char * __restrict src,                                           \
+        size_t max,                                                            \
+        size_t * bytelen )                                                     \
+{                                                                              \
+        return j2string_kernel_utf8_copy(dst, src, max, bytelen,               \
+                                         &isa##_strlen_sn,                     \
+                                         &isa##_utf8_strlen_sn);               \
+}                                                                              \
+                                                                               \
+const struct j2string_kernels j2string_kernels_##isa = {                       \
+        .strlen_sn      = &isa##_strlen_sn,                                    \
+        .utf8_strlen_sn = &isa##_utf8_strlen_sn,                               \
+        .cnt            = &isa##_cnt,                                          \
+        .strcpy_sn      = &isa##_strcpy_sn,                                    \
+        .utf8_strcpy_sn = &isa##_utf8_strcpy_sn                                \
+};
+
+X86_KERNELS(sse2,   "sse2",                     16)
+X86_KERNELS(avx2,   "avx2,popcnt",              32)
+X86_KERNELS(avx512, "avx512f,avx512bw,popcnt",  64)
+
+#else
+
+/// ISO C doesn't allow an empty translation unit.
+typedef int j2string_kx86_unused;
+
+#endif
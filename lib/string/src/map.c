@@ -0,0 +1,350 @@
+/*** LICENSE: LGPLV2. *************************************
+ *                                                        *
+ *                                                        *
+ * This file is a part of the j2 project.                 *
+ * Copyright (C) 2022 Joško Križanović                    *
+ * <jkriza02@fesb.com>                                    *
+ *                                                        *
+ * This library is free software; you can redistribute    *
+ * it and/or modify it under the terms of the GNU Lesser  *
+ * General Public License as published by the Free        *
+ * Software Foundation; either version 2.1 of the         *
+ * License, or (at your option) any later version.        *
+ *                                                        *
+ * This library is distributed in the hope that it will   *
+ * be useful,                                             *
+ * but WITHOUT ANY WARRANTY; without even the implied     *
+ * warranty of MERCHANTABILITY or FITNESS FOR A           *
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public  *
+ * License for more details.                              *
+ *                                                        *
+ * You should have received a copy of the GNU Lesser      *
+ * General Public License along with this library; if     *
+ * not, write to the Free Software Foundation, Inc.,      *
+ * 51 Franklin Street, Fifth Floor, Boston,               *
+ * MA  02110-1301  USA                                    *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: FILE, AUTHOR & DATE INFORMATION. *********
+ *                                                        *
+ *                                                        *
+ * FILE:                                                  *
+ * Read only j2strings over memory mapped files. The      *
+ * header sits in a page of its own right in front of the *
+ * mapping and a zeroed page right behind it terminates   *
+ * the string, so every read only primitive works on a    *
+ * file without copying it.                               *
+ *                                                        *
+ *                                                        *
+ * AUTHOR:                                                *
+ *      NAME:  Joško Križanović                           *
+ *      EMAIL: jkriza02@fesb.com                          *
+ *                                                        *
+ *                                                        *
+ * DATE:                                                  *
+ * 19.10.2026.                                            *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+
+/// MAP_ANONYMOUS, posix_madvise() and sysconf().
+#define _DEFAULT_SOURCE
+#define _POSIX_C_SOURCE 200809L
+
+#include "../string.h"
+#include "../utf8.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <errno.h>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+
+/**
+ * @brief 
+ * Bytes the mapping of a @c "size" byte file takes up: the header page, 
+ * the file rounded up to whole pages and the terminating page.
+ */
+static size_t
+map_span(
+        size_t size,
+        size_t page )
+{
+        return page + (size + page - 1) / page * page + page;
+}
+
+static size_t
+map_page(
+        void )
+{
+        long page = sysconf(_SC_PAGESIZE);
+        return page > 0 ? (size_t)page : 4096;
+}
+
+/**
+ * @brief 
+ * Hand the hints of @c "flags" over to the kernel, the last one given 
+ * wins.
+ */
+static int
+map_hint(
+        const char * data,
+        size_t size,
+        int flags )
+{
+
+        if(!size) return 0;
+
+        int advice = -1;
+        if(flags & J2_STRING_MAP_SEQUENTIAL) advice = POSIX_MADV_SEQUENTIAL;
+        if(flags & J2_STRING_MAP_RANDOM)     advice = POSIX_MADV_RANDOM;
+        if(flags & J2_STRING_MAP_WILLNEED)   advice = POSIX_MADV_WILLNEED;
+        if(advice < 0) return 0;
+
+        int error = posix_madvise((void *)data, size, advice);
+        if(error) {
+                errno = error;
+                return -1;
+        }
+        return 0;
+
+}
+#endif
+
+/**
+ * @fn @c j2string_map_fd(2)
+ * 
+ *      @brief Map the file open as @c "fd" into memory as a read only 
+ *      j2string. The file isn't copied, pages are read in as the string 
+ *      is. @c "fd" can be closed right after.
+ * 
+ *      The string works with every function that doesn't change a 
+ *      string: length, search, count, span, compare and hash. It is 
+ *      static and its bytes are read only, changing it faults, so don't
+ *      cpy or cat into it and give it to j2string_unmap(), not 
+ *      j2string_free().
+ * 
+ *      @param @b fd
+ *             File descriptor of a regular file, open for reading.
+ *      @param @b flags
+ *             J2_STRING_MAP_... hints or 0. J2_STRING_MAP_LENGTH counts the
+ *             UTF-8 length, which reads the whole file, without it the 
+ *             length is the byte count.
+ * 
+ *      @throw @a EINVAL - If @c fd is negative or not a regular file.
+ *      @throw @a ENOSYS - If there is no mmap() on this platform.
+ *      @throw @a ...    - Anything fstat(), mmap() and mprotect() throw.
+ * 
+ *      @returns The mapped string or NULL.
+ * 
+ */
+const_j2string
+j2string_map_fd(
+        int fd,
+        int flags )
+{
+
+#ifdef _WIN32
+        errno = ENOSYS;
+        return NULL;
+#else
+
+#ifdef __J2_DEV__
+        if(fd < 0) {
+                errno = EINVAL;
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_map_fd() / j2.string.map.fd()"
+                        " parameter fd is negative.");
+                return NULL;
+        }
+#endif
+
+        struct stat st;
+        if(fstat(fd, &st) != 0) return NULL;
+        if(!S_ISREG(st.st_mode) || st.st_size < 0) {
+                errno = EINVAL;
+                return NULL;
+        }
+
+        size_t size = (size_t)st.st_size;
+        size_t page = map_page();
+        size_t span = map_span(size, page);
+
+        /// Reserve the whole span zeroed, then lay the file over the middle.
+        uint8_t * base = mmap(NULL, span, PROT_READ | PROT_WRITE, 
+                              MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if(base == MAP_FAILED) return NULL;
+
+        if(size && mmap(base + page, size, PROT_READ, 
+                        MAP_PRIVATE | MAP_FIXED, fd, 0) == MAP_FAILED) {
+                int error = errno;
+                munmap(base, span);
+                errno = error;
+                return NULL;
+        }
+
+        /// Past the file the last page of the mapping is zero filled and
+        /// the terminating page is anonymous, make it read only as well.
+        size_t tail = (size + page - 1) / page * page;
+        if(mprotect(base + page + tail, page, PROT_READ) != 0) {
+                int error = errno;
+                munmap(base, span);
+                errno = error;
+                return NULL;
+        }
+
+        /// The null character lives in the zero filled tail past the file.
+        struct j2string_st * info = (struct j2string_st *)(
+                base + page - sizeof(struct j2string_st));
+        *info = (struct j2string_st){
+                .allocated = size + 1,
+                .padding   = 0,
+                .max       = size + 1,
+                .filled    = size,
+                .length    = size,
+                .reserved  = J2_STRING_MAP_UNCOUNTED,
+                .hash      = J2_STRING_HASH_NONE,
+                .ensure    = J2_STRING_ENSURE_HEXSPEAK
+        };
+
+        const_j2string string = J2_STRING_REACH_FOR_STRING(info);
+
+        map_hint(string, size, flags);
+
+        /// Counting reads the whole file, so it is only done when asked for.
+        if(flags & J2_STRING_MAP_LENGTH) {
+                info->length   = utf8_count(string, size);
+                info->reserved = 0;
+        }
+
+        return string;
+
+#endif
+
+}
+
+/**
+ * @fn @c j2string_map(2)
+ * 
+ *      @brief Map the file at @c "path" as a read only j2string, see 
+ *      j2string_map_fd().
+ * 
+ *      @returns The mapped string or NULL.
+ * 
+ */
+const_j2string
+j2string_map(
+        const char * path,
+        int flags )
+{
+
+#ifdef _WIN32
+        (void)path;
+        (void)flags;
+        errno = ENOSYS;
+        return NULL;
+#else
+
+#ifdef __J2_DEV__
+        if(!path) {
+                errno = EINVAL;
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_map() / j2.string.map.file()"
+                        " parameter path is a NULL ptr.");
+                return NULL;
+        }
+#endif
+
+        int fd = open(path, O_RDONLY | O_CLOEXEC);
+        if(fd < 0) return NULL;
+
+        const_j2string string = j2string_map_fd(fd, flags);
+        int error = errno;
+        close(fd);
+        errno = error;
+
+        return string;
+
+#endif
+
+}
+
+/**
+ * @fn @c j2string_map_advise(2)
+ * 
+ *      @brief Give the kernel a new J2_STRING_MAP_... hint for how a mapped
+ *      string will be read, e.g. sequential for a scan and random for 
+ *      lookups afterwards.
+ * 
+ *      @returns 0 or -1 with errno set.
+ * 
+ */
+int
+j2string_map_advise(
+        const_j2string string,
+        int flags )
+{
+
+#ifdef _WIN32
+        (void)string;
+        (void)flags;
+        errno = ENOSYS;
+        return -1;
+#else
+
+        struct j2string_st * info = 
+                string ? J2_STRING_INFO(string) : NULL;
+
+        if(!info) {
+                errno = EINVAL;
+#ifdef __J2_DEV__
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_map_advise() / j2.string.map.advise()"
+                        " parameter string is a NULL ptr or not a j2string.");
+#endif
+                return -1;
+        }
+
+        return map_hint(string, info->filled, flags);
+
+#endif
+
+}
+
+/**
+ * @fn @c j2string_unmap(1)
+ * 
+ *      @brief Unmap a string made by j2string_map() or j2string_map_fd().
+ * 
+ */
+void
+j2string_unmap(
+        const_j2string string )
+{
+
+#ifndef _WIN32
+
+        struct j2string_st * info = 
+                string ? J2_STRING_INFO(string) : NULL;
+        if(!info) return;
+
+        size_t page = map_page();
+        size_t size = info->allocated - 1;
+
+        munmap((uint8_t *)string - page, map_span(size, page));
+
+#else
+        (void)string;
+#endif
+
+}
@@ -0,0 +1,467 @@
+/*** LICENSE: LGPLV2. *************************************
+ *                                                        *
+ *                                                        *
+ * This file is a part of the j2 project.                 *
+ * Copyright (C) 2022 Joško Križanović                    *
+ * <jkriza02@fesb.com>                                    *
+ *                                                        *
+ * This library is free software; you can redistribute    *
+ * it and/or modify it under the terms of the GNU Lesser  *
+ * General Public License as published by the Free        *
+ * Software Foundation; either version 2.1 of the         *
+ * License, or (at your option) any later version.        *
+ *                                                        *
+ * This library is distributed in the hope that it will   *
+ * be useful,                                             *
+ * but WITHOUT ANY WARRANTY; without even the implied     *
+ * warranty of MERCHANTABILITY or FITNESS FOR A           *
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public  *
+ * License for more details.                              *
+ *                                                        *
+ * You should have received a copy of the GNU Lesser      *
+ * General Public License along with this library; if     *
+ * not, write to the Free Software Foundation, Inc.,      *
+ * 51 Franklin Street, Fifth Floor, Boston,               *
+ * MA  02110-1301  USA                                    *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: FILE, AUTHOR & DATE INFORMATION. *********
+ *                                                        *
+ *                                                        *
+ * FILE:                                                  *
+ * Sinks, dynamic j2strings that flush their contents to  *
+ * a callback or a file descriptor at a high-water mark   *
+ * and start over, so output of any size is built in      *
+ * bounded memory.                                        *
+ *                                                        *
+ *                                                        *
+ * AUTHOR:                                                *
+ *      NAME:  Joško Križanović                           *
+ *      EMAIL: jkriza02@fesb.com                          *
+ *                                                        *
+ *                                                        *
+ * DATE:                                                  *
+ * 19.10.2026.                                            *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+
+
+#include "../string.h"
+#include "sink.h"
+#include "../../stats/stats.h"
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <errno.h>
+
+#ifdef _WIN32
+#include <io.h>
+#define sink_write(fd, bytes, size) _write((fd), (bytes), (unsigned)(size))
+#else
+#include <unistd.h>
+#define sink_write(fd, bytes, size) write((fd), (bytes), (size))
+#endif
+
+/**
+ * @brief 
+ * Most bytes a single write() is asked for.
+ */
+#define SINK_WRITE_MAX _IEEE1541_INT_GiB(1)
+
+/**
+ * @brief 
+ * Bytes of the whole block of a sink holding @c "allocated" bytes.
+ */
+#define SINK_MEMORY_SIZE(allocated)                                            \
+        (sizeof(struct j2string_sink_st) + J2_STRING_GET_MEMORY_SIZE(allocated))
+
+/**
+ * @brief 
+ * Write all @c "size" bytes to @c "fd", picking up partial writes and EINTR.
+ */
+static int
+sink_write_fd(
+        int fd,
+        const char * bytes,
+        size_t size )
+{
+
+        while(size) {
+                size_t ask = size < SINK_WRITE_MAX ? size : SINK_WRITE_MAX;
+                long wrote = (long)sink_write(fd, bytes, ask);
+                if(wrote < 0) {
+                        if(errno == EINTR) continue;
+                        return -1;
+                }
+                bytes += wrote;
+                size  -= (size_t)wrote;
+        }
+
+        return 0;
+
+}
+
+/**
+ * @brief 
+ * Hand @c "size" bytes to the callback or fd of @c "sink". On failure the
+ * errno is kept for j2string_sink_close().
+ */
+static int
+sink_send(
+        struct j2string_sink_st * sink,
+        const char * bytes,
+        size_t size )
+{
+
+        errno = 0;
+        int failed = sink->write ? 
+                sink->write(bytes, size, sink->data) :
+                sink_write_fd(sink->fd, bytes, size);
+        if(failed) {
+                if(!errno) errno = EIO;
+                if(!sink->error) sink->error = errno;
+                return -1;
+        }
+
+        J2_TRACE2(string_sink_flush, sink->flushed, size);
+
+        sink->flushed += size;
+        return 0;
+
+}
+
+/**
+ * @brief 
+ * Send the contents of the sink @c "info" out and empty it. On failure the
+ * contents stay.
+ */
+static int
+sink_drain(
+        struct j2string_st * info )
+{
+
+        if(!info->filled) return 0;
+
+        if(sink_send(J2_STRING_SINK_OF(info), 
+                     J2_STRING_REACH_FOR_STRING(info), info->filled) != 0)
+                return -1;
+
+        info->filled   = 0;
+        info->length   = 0;
+        J2_STRING_HASH_INVALIDATE(info);
+        J2_STRING_REACH_FOR_STRING(info)[0] = '\0';
+
+        return 0;
+
+}
+
+/**
+ * @brief 
+ * Shared by j2string_sink() and j2string_sink_fd().
+ */
+static j2string
+sink_new(
+        size_t highwater,
+        j2string_sink_fn write,
+        void * data,
+        int fd )
+{
+
+        if(highwater < 2) highwater = 2;
+
+        struct j2string_sink_st * sink = malloc(SINK_MEMORY_SIZE(highwater));
+        if(!sink) {
+                errno = ENOMEM;
+                return NULL;
+        }
+
+        J2_STATS_ADD(J2_STATS_ALLOC, 1);
+
+        *sink = (struct j2string_sink_st){
+                .write     = write,
+                .data      = data,
+                .fd        = fd,
+                .error     = 0,
+                .highwater = highwater,
+                .flushed   = 0
+        };
+
+        struct j2string_st * info = (struct j2string_st *)(sink + 1);
+        *info = (struct j2string_st){
+                .allocated = highwater,
+                .padding   = J2_STRING_SINK_PADDING,
+                .max       = SIZE_MAX,
+                .filled    = 0,
+                .length    = 0,
+                .reserved  = 0,
+                .hash      = J2_STRING_HASH_NONE,
+                .ensure    = J2_STRING_ENSURE_HEXSPEAK
+        };
+
+        j2string string = J2_STRING_REACH_FOR_STRING(info);
+        string[0]         = '\0';
+        string[highwater] = '\0';
+
+        return string;
+
+}
+
+/**
+ * @fn @c j2string_sink_pass(3)
+ * 
+ *      @brief Append of a piece that doesn't fit even an empty sink, see
+ *      J2_STRING_SINK_PASSES(). What the sink holds is flushed and the 
+ *      piece is handed straight on behind it, the sink never grows for it.
+ * 
+ *      @returns 0, or -1 if a flush failed and the piece wasn't sent.
+ * 
+ */
+int
+j2string_sink_pass(
+        j2string string,
+        const char * piece,
+        size_t size )
+{
+
+        struct j2string_st * info = J2_STRING_INFO(string);
+
+        if(sink_drain(info) != 0) return -1;
+
+        return sink_send(J2_STRING_SINK_OF(info), piece, size);
+
+}
+
+/**
+ * @fn @c j2string_sink_update(2)
+ * 
+ *      @brief j2string_update() of a sink. Asked for more than it holds, 
+ *      the sink flushes and keeps the memory it has. Pieces that don't fit
+ *      an empty sink go through j2string_sink_pass() instead, only a 
+ *      number of j2string_write_*() bigger than the high-water mark or a 
+ *      sink appended to itself still grows it. The next flush shrinks it
+ *      back.
+ * 
+ *      @returns The sink, moved if it was resized. If the flush fails it 
+ *      stays as it was and whatever doesn't fit is cut off like at the max
+ *      of a dynamic string.
+ * 
+ */
+j2string
+j2string_sink_update(
+        j2string string,
+        long newsize )
+{
+
+        struct j2string_st * info = J2_STRING_INFO(string);
+
+        if((size_t)newsize <= info->allocated) return string;
+
+        /// Appends ask for what is in there plus the new piece, after the
+        /// flush only the new piece is left. cpy & ccpy flush the sink 
+        /// before asking, so for them this is the whole newsize.
+        size_t need = (size_t)newsize > info->filled ? 
+                (size_t)newsize - info->filled : 1;
+
+        if(sink_drain(info) != 0) return string;
+
+        size_t highwater = J2_STRING_SINK_OF(info)->highwater;
+        size_t size      = need > highwater ? need : highwater;
+        if(size == info->allocated) return string;
+
+        struct j2string_sink_st * sink = realloc(
+                J2_STRING_SINK_OF(info), SINK_MEMORY_SIZE(size));
+        if(!sink) {
+                errno = ENOMEM;
+                return string;
+        }
+
+        J2_STATS_ADD(J2_STATS_REALLOC, 1);
+        J2_STATS_ADD(size > info->allocated ? J2_STATS_GROW 
+                                            : J2_STATS_SHRINK, 1);
+
+        info = (struct j2string_st *)(sink + 1);
+        J2_TRACE2(string_realloc, info->allocated, size);
+
+        info->allocated = size;
+        J2_STRING_REACH_FOR_STRING(info)[size] = '\0';
+
+        return J2_STRING_REACH_FOR_STRING(info);
+
+}
+
+/**
+ * @fn @c j2string_sink(3)
+ * 
+ *      @brief Create a sink, a dynamic j2string that hands its contents to
+ *      @c "write" whenever the next append wouldn't fit under 
+ *      @c "highwater" bytes and then starts over empty. Output of any size
+ *      goes through it without ever holding more than @c "highwater" 
+ *      bytes, or one number of j2string_write_*() if it is bigger.
+ * 
+ *      Everything that appends works on a sink: j2string_cat(), 
+ *      j2string_ccat(), j2string_catn(), j2string_ccatn() and the 
+ *      j2string_write_*() number writers. j2string_cpy() and 
+ *      j2string_ccpy() flush what the sink holds first and then replace 
+ *      it, reserve and shrink_to_fit don't work on sinks. A piece bigger 
+ *      than the high-water mark is written straight through after a flush
+ *      instead of being copied in.
+ * 
+ *      Free a sink with j2string_sink_close() which flushes the rest, 
+ *      j2string_free() only frees it.
+ * 
+ * 
+ *      @param @b highwater
+ *             Bytes the sink holds, null value included.
+ * 
+ *      @param @b write
+ *             Callback the contents are flushed to, it has to take all of
+ *             them and return 0, or -1 with errno set.
+ * 
+ *      @param @b data
+ *             Pointer @c "write" gets back.
+ * 
+ * 
+ *      @throw @a EINVAL - If @c "write" is a NULL ptr.
+ *      @throw @a ENOMEM - Exhausted all memory spaces.
+ * 
+ * 
+ *      @returns The sink or NULL.
+ * 
+ */
+j2string
+j2string_sink(
+        size_t highwater,
+        j2string_sink_fn write,
+        void * data )
+{
+
+#ifdef __J2_DEV__
+        if(!write) {
+                errno = EINVAL;
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_sink() / j2.string.sink.create()"
+                        " parameter write is a NULL ptr.");
+                return NULL;
+        }
+#endif
+
+        return sink_new(highwater, write, data, -1);
+
+}
+
+/**
+ * @fn @c j2string_sink_fd(2)
+ * 
+ *      @brief Same as j2string_sink() but the contents are written to 
+ *      @c "fd", partial writes and EINTR are picked up where they stopped.
+ * 
+ *      @returns The sink or NULL.
+ * 
+ */
+j2string
+j2string_sink_fd(
+        size_t highwater,
+        int fd )
+{
+
+#ifdef __J2_DEV__
+        if(fd < 0) {
+                errno = EINVAL;
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_sink_fd() / j2.string.sink.fd()"
+                        " parameter fd is negative.");
+                return NULL;
+        }
+#endif
+
+        return sink_new(highwater, NULL, NULL, fd);
+
+}
+
+/**
+ * @fn @c j2string_sink_flush(1)
+ * 
+ *      @brief Flush the contents of a sink now, e.g. at the end of a 
+ *      response.
+ * 
+ * 
+ *      @throw @a EINVAL - If @c "string" isn't a sink.
+ *      @throw @a ...    - Anything the callback or write() throws.
+ * 
+ * 
+ *      @returns Bytes flushed or -1, the contents stay then.
+ * 
+ */
+long
+j2string_sink_flush(
+        j2string string )
+{
+
+        struct j2string_st * info = 
+                string ? J2_STRING_INFO(string) : NULL;
+
+        if(!info || !J2_STRING_IS_SINK(info)) {
+                errno = EINVAL;
+#ifdef __J2_DEV__
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_sink_flush() / j2.string.sink.flush()"
+                        " parameter string is not a sink.");
+#endif
+                return -1;
+        }
+
+        size_t filled = info->filled;
+        if(sink_drain(info) != 0) return -1;
+
+        return (long)filled;
+
+}
+
+/**
+ * @fn @c j2string_sink_close(1)
+ * 
+ *      @brief Flush the rest of a sink and free it.
+ * 
+ * 
+ *      @throw @a EINVAL - If @c "string" isn't a sink.
+ *      @throw @a ...    - The errno of the first flush that failed.
+ * 
+ * 
+ *      @returns Bytes the sink sent out over its whole life, -1 if any 
+ *      flush failed. The sink is freed either way.
+ * 
+ */
+long
+j2string_sink_close(
+        j2string string )
+{
+
+        struct j2string_st * info = 
+                string ? J2_STRING_INFO(string) : NULL;
+
+        if(!info || !J2_STRING_IS_SINK(info)) {
+                errno = EINVAL;
+#ifdef __J2_DEV__
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_sink_close() / j2.string.sink.close()"
+                        " parameter string is not a sink.");
+#endif
+                return -1;
+        }
+
+        sink_drain(info);
+
+        struct j2string_sink_st * sink = J2_STRING_SINK_OF(info);
+        long result = sink->error ? -1 : (long)sink->flushed;
+        if(sink->error) errno = sink->error;
+
+        J2_STATS_ADD(J2_STATS_FREE, 1);
+        free(sink);
+
+        return result;
+
+}
@@ -0,0 +1,146 @@
+/*** LICENSE: LGPLV2. *************************************
+ *                                                        *
+ *                                                        *
+ * This file is a part of the j2 project.                 *
+ * Copyright (C) 2022 Joško Križanović                    *
+ * <jkriza02@fesb.com>                                    *
+ *                                                        *
+ * This library is free software; you can redistribute    *
+ * it and/or modify it under the terms of the GNU Lesser  *
+ * General Public License as published by the Free        *
+ * Software Foundation; either version 2.1 of the         *
+ * License, or (at your option) any later version.        *
+ *                                                        *
+ * This library is distributed in the hope that it will   *
+ * be useful,                                             *
+ * but WITHOUT ANY WARRANTY; without even the implied     *
+ * warranty of MERCHANTABILITY or FITNESS FOR A           *
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public  *
+ * License for more details.                              *
+ *                                                        *
+ * You should have received a copy of the GNU Lesser      *
+ * General Public License along with this library; if     *
+ * not, write to the Free Software Foundation, Inc.,      *
+ * 51 Franklin Street, Fifth Floor, Boston,               *
+ * MA  02110-1301  USA                                    *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: FILE, AUTHOR & DATE INFORMATION. *********
+ *                                                        *
+ *                                                        *
+ * FILE:                                                  *
+ * The part of a sink that sits in front of its j2string  *
+ * header, shared by the sink functions and               *
+ * j2string_update().                                     *
+ *                                                        *
+ *                                                        *
+ * AUTHOR:                                                *
+ *      NAME:  Joško Križanović                           *
+ *      EMAIL: jkriza02@fesb.com                          *
+ *                                                        *
+ *                                                        *
+ * DATE:                                                  *
+ * 19.10.2026.                                            *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+
+
+#include "../string.h"
+#include <stdint.h>
+#include <stddef.h>
+
+#ifndef J2_STRING_SINK_INCLUDE
+#define J2_STRING_SINK_INCLUDE
+
+/**
+ * @struct @c j2string_sink_st
+ * 
+ *      @brief Where a sink sends its contents, allocated in the same block 
+ *      right in front of the j2string_st of the sink.
+ * 
+ * 
+ *      @tparam @b write
+ *      @tparam @b data
+ *      @tparam @b fd
+ *      @tparam @b highwater
+ *      @tparam @b flushed
+ *      @tparam @b error
+ *   
+ */
+struct j2string_sink_st {
+
+        /**
+         * @tparam @b write @b data
+         * Callback the contents go to and the pointer it gets back, NULL for
+         * a sink that writes to @c fd.
+         */
+        j2string_sink_fn write;
+        void * data;
+
+        /**
+         * @tparam @b fd
+         * File descriptor the contents go to if there is no callback.
+         */
+        int fd;
+
+        /**
+         * @tparam @b error
+         * errno of the first flush that failed, 0 if none did.
+         */
+        int error;
+
+        /**
+         * @tparam @b highwater
+         * Bytes the sink holds before it flushes, its allocated size.
+         */
+        size_t highwater;
+
+        /**
+         * @tparam @b flushed
+         * Bytes sent out so far.
+         */
+        size_t flushed;
+
+};
+
+/**
+ * @brief 
+ * Jump from the j2string_st of a sink to the sink part in front of it.
+ */
+#define J2_STRING_SINK_OF(info)                                                \
+((struct j2string_sink_st *)( (uint8_t*)(info)                                 \
+                              - sizeof(struct j2string_sink_st) ))
+
+/**
+ * @brief 
+ * True if @c "info" is the j2string_st of a sink.
+ */
+#define J2_STRING_IS_SINK(info) ((info)->padding == J2_STRING_SINK_PADDING)
+
+/**
+ * @brief 
+ * True if an append of @c "size" bytes doesn't fit even the empty sink 
+ * @c "info" and goes through j2string_sink_pass() instead.
+ */
+#define J2_STRING_SINK_PASSES(info, size)                                      \
+        (J2_STRING_IS_SINK(info)                                               \
+         && (size) >= J2_STRING_SINK_OF(info)->highwater)
+
+int
+j2string_sink_pass(
+        j2string string,
+        const char * piece,
+        size_t size
+);
+
+j2string
+j2string_sink_update(
+        j2string string,
+        long newsize
+);
+
+#endif
@@ -46,16 +46,14 @@
  *********************************************************/
 
 #include "../string.h"
+#include "kernel.h"
+#include "../../stats/stats.h"
 #include "../utf8.h"
 #include <stdio.h>
 #include <stdint.h>
 #include <stdlib.h>
 #include <errno.h>
 
-#ifdef __J2_DEV__
-#include "../../../ext/viwerr/viwerr.h"
-#endif
-
 // #define chunk_has_zero(v)
 //         (((v) - 0x0101010101010101ULL) & ~(v) & 0x8080808080808080ULL)
 
@@ -107,43 +105,43 @@ j2string_strcpy_sn(
 #ifdef __J2_DEV__
         if(!dst){
                 errno = EINVAL;
-                viwerr(VIWERR_PUSH, &(viwerr_package){
-                        .code    = EINVAL,
-                        .name    = (char*)"j2err: Invalid parameter...",
-                        .message = (char*)
-                                   "j2string_strlen_sn() / j2.string.clen()"
-                                   " parameter \"dst\" is a NULL ptr.",
-                        .group   = (char*)"j2"
-                });
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_strlen_sn() / j2.string.clen()"
+                        " parameter \"dst\" is a NULL ptr.");
                 return 0;
         }
         if(!src){
                 errno = EINVAL;
-                viwerr(VIWERR_PUSH, &(viwerr_package){
-                        .code    = EINVAL,
-                        .name    = (char*)"j2err: Invalid parameter...",
-                        .message = (char*)
-                                   "j2string_strlen_sn() / j2.string.clen()"
-                                   " parameter \"src\" is a NULL ptr.",
-                        .group   = (char*)"j2"
-                });
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_strlen_sn() / j2.string.clen()"
+                        " parameter \"src\" is a NULL ptr.");
                 return 0;
         } 
         if(max < 1) {
                 errno = EINVAL;
-                viwerr(VIWERR_PUSH, &(viwerr_package){
-                        .code    = EINVAL,
-                        .name    = (char*)"j2err: Invalid parameter...",
-                        .message = (char*)
-                                   "j2string_strlen_sn() / j2.string.clen()"
-                                   " parameter \"max\" is less than 1.",
-                        .group   = (char*)"j2"
-                });
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_strlen_sn() / j2.string.clen()"
+                        " parameter \"max\" is less than 1.");
                 return 0;
         }
 #else
         if(max < 1) return 0;
 #endif
+
+        return j2string_kernel.strcpy_sn(dst, src, max);
+
+}
+
+/**
+ * @brief 
+ * Scalar kernel of j2string_strcpy_sn(), copies 8 bytes at a time.
+ */
+size_t
+j2string_strcpy_sn_scalar(
+        char * __restrict dst,
+        const char * __restrict src,
+        size_t max )
+{
         
         chunk_t 
                 chunk = 0,
@@ -275,7 +273,8 @@ j2string_strcpy_sn(
  * @fn @c j2string_utf8_strcpy_sn(2)
  * 
  *      @brief 
- *      "Safe" strcpy implementation for UTF-8 strings.
+ *      "Safe" strcpy implementation for UTF-8 strings. An unfinished UTF-8
+ *      character at the end of the copy is dropped.
  * 
  * 
  *      @param @b dst 
@@ -312,44 +311,45 @@ j2string_utf8_strcpy_sn(
 #ifdef __J2_DEV__
         if(!dst){
                 errno = EINVAL;
-                viwerr(VIWERR_PUSH, &(viwerr_package){
-                        .code    = EINVAL,
-                        .name    = (char*)"j2err: Invalid parameter...",
-                        .message = (char*)
-                                   "j2string_strlen_sn() / j2.string.clen()"
-                                   " parameter \"dst\" is a NULL ptr.",
-                        .group   = (char*)"j2"
-                });
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_strlen_sn() / j2.string.clen()"
+                        " parameter \"dst\" is a NULL ptr.");
                 return 0;
         }
         if(!src){
                 errno = EINVAL;
-                viwerr(VIWERR_PUSH, &(viwerr_package){
-                        .code    = EINVAL,
-                        .name    = (char*)"j2err: Invalid parameter...",
-                        .message = (char*)
-                                   "j2string_strlen_sn() / j2.string.clen()"
-                                   " parameter \"src\" is a NULL ptr.",
-                        .group   = (char*)"j2"
-                });
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_strlen_sn() / j2.string.clen()"
+                        " parameter \"src\" is a NULL ptr.");
                 return 0;
         } 
         if(max < 1) {
                 errno = EINVAL;
-                viwerr(VIWERR_PUSH, &(viwerr_package){
-                        .code    = EINVAL,
-                        .name    = (char*)"j2err: Invalid parameter...",
-                        .message = (char*)
-                                   "j2string_strlen_sn() / j2.string.clen()"
-                                   " parameter \"max\" is less than 1.",
-                        .group   = (char*)"j2"
-                });
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_strlen_sn() / j2.string.clen()"
+                        " parameter \"max\" is less than 1.");
                 return 0;
         }
 #else
         if(max < 1) return 0;
 #endif
 
+        return j2string_kernel.utf8_strcpy_sn(dst, src, max, bytelen);
+
+}
+
+/**
+ * @brief 
+ * Scalar kernel of j2string_utf8_strcpy_sn(), copies 8 bytes at a time.
+ */
+size_t
+j2string_utf8_strcpy_sn_scalar(
+        char * __restrict dst,
+        const char * __restrict src,
+        size_t max,
+        size_t * bytelen )
+{
+
         chunk_t 
                 chunk = 0,
                 *w = (chunk_t *)dst,
@@ -493,7 +493,7 @@ j2string_utf8_strcpy_sn(
                         ws[0] = rs[0];
                         if(rs[0] == 0) {
                                 bytes = i*chunksize;
-                                goto ret_success;
+                                break;
                         }
                         if(is_utf8_payload(rs[0])) ch++;
 
@@ -501,7 +501,7 @@ j2string_utf8_strcpy_sn(
                         ws[1] = rs[1];
                         if(rs[1] == 0)  {
                                 bytes = i*chunksize+1;
-                                goto ret_success;
+                                break;
                         }
                         if(is_utf8_payload(rs[1])) ch++;
 
@@ -509,7 +509,7 @@ j2string_utf8_strcpy_sn(
                         ws[2] = rs[2];
                         if(rs[2] == 0)  {
                                 bytes = i*chunksize+2;
-                                goto ret_success;
+                                break;
                         }
                         if(is_utf8_payload(rs[2])) ch++;
 
@@ -517,7 +517,7 @@ j2string_utf8_strcpy_sn(
                         ws[3] = rs[3];
                         if(rs[3] == 0)  {
                                bytes = i*chunksize+3;
-                               goto ret_success;
+                               break;
                         }
                         if(is_utf8_payload(rs[3])) ch++;
 
@@ -525,7 +525,7 @@ j2string_utf8_strcpy_sn(
                         ws[4] = rs[4];
                         if(rs[4] == 0)  {
                                bytes = i*chunksize+4;
-                               goto ret_success;
+                               break;
                         }
                         if(is_utf8_payload(rs[4])) ch++;
 
@@ -533,7 +533,7 @@ j2string_utf8_strcpy_sn(
                         ws[5] = rs[5];
                         if(rs[5] == 0)  {
                                 bytes = i*chunksize+5;
-                                goto ret_success;
+                                break;
                         }
                         if(is_utf8_payload(rs[5])) ch++;
 
@@ -541,18 +541,19 @@ j2string_utf8_strcpy_sn(
                         ws[6] = rs[6];
                         if(rs[6] == 0)  {
                                 bytes = i*chunksize+6;
-                                goto ret_success;
+                                break;
                         }
                         if(is_utf8_payload(rs[6])) ch++;
 
 
                         ws[7] = '\0';
                         bytes = i*chunksize+7;
-                        goto ret_success;
+                        break;
 
 
                 } else if(utf8_in_64(chunk)) {
                         
+                        J2_STATS_ADD(J2_STATS_UTF8_SLOW, 1);
                         unsigned char * rs = (unsigned char *)(&r[i]);
                         if(is_utf8_payload(rs[0])) ch++;
                         if(is_utf8_payload(rs[1])) ch++;
@@ -578,7 +579,8 @@ j2string_utf8_strcpy_sn(
         int cnt = 0;
         unsigned char * rs = (unsigned char *)dst;
         
-        /// Remove half baked UTF-8 characters from the end of the string.
+        /// Remove half baked UTF-8 characters from the end of the string,
+        /// cut by "max" or not.
         for(int64_t k = (int64_t)bytes; k >= 0; k--) {
 
                 /// First '\0'.
@@ -610,7 +612,7 @@ j2string_utf8_strcpy_sn(
 
         }
 
-ret_success:
+        J2_STATS_ADD(J2_STATS_BYTES_COPIED, bytes);
         if(bytelen) (*bytelen) = bytes;
         return ch;
 
@@ -767,38 +769,23 @@ j2string_utf8_nhbc_strcpy_sn(
 #ifdef __J2_DEV__
         if(!dst){
                 errno = EINVAL;
-                viwerr(VIWERR_PUSH, &(viwerr_package){
-                        .code    = EINVAL,
-                        .name    = (char*)"j2err: Invalid parameter...",
-                        .message = (char*)
-                                   "j2string_strlen_sn() / j2.string.clen()"
-                                   " parameter \"dst\" is a NULL ptr.",
-                        .group   = (char*)"j2"
-                });
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_strlen_sn() / j2.string.clen()"
+                        " parameter \"dst\" is a NULL ptr.");
                 return 0;
         }
         if(!src){
                 errno = EINVAL;
-                viwerr(VIWERR_PUSH, &(viwerr_package){
-                        .code    = EINVAL,
-                        .name    = (char*)"j2err: Invalid parameter...",
-                        .message = (char*)
-                                   "j2string_strlen_sn() / j2.string.clen()"
-                                   " parameter \"src\" is a NULL ptr.",
-                        .group   = (char*)"j2"
-                });
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_strlen_sn() / j2.string.clen()"
+                        " parameter \"src\" is a NULL ptr.");
                 return 0;
         } 
         if(max < 1) {
                 errno = EINVAL;
-                viwerr(VIWERR_PUSH, &(viwerr_package){
-                        .code    = EINVAL,
-                        .name    = (char*)"j2err: Invalid parameter...",
-                        .message = (char*)
-                                   "j2string_strlen_sn() / j2.string.clen()"
-                                   " parameter \"max\" is less than 1.",
-                        .group   = (char*)"j2"
-                });
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_strlen_sn() / j2.string.clen()"
+                        " parameter \"max\" is less than 1.");
                 return 0;
         }
 #else
@@ -1008,6 +995,7 @@ j2string_utf8_nhbc_strcpy_sn(
 
                 } else if(utf8_in_64(chunk)) {
                         
+                        J2_STATS_ADD(J2_STATS_UTF8_SLOW, 1);
                         unsigned char * rs = (unsigned char *)(&r[i]);
                         if(is_utf8_payload(rs[0])) ch++;
                         if(is_utf8_payload(rs[1])) ch++;
@@ -1031,6 +1019,7 @@ j2string_utf8_nhbc_strcpy_sn(
         }
 
 ret_success:
+        J2_STATS_ADD(J2_STATS_BYTES_COPIED, bytes);
         if(bytelen) (*bytelen) = bytes;
         return ch;
 
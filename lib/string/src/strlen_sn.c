@@ -46,15 +46,13 @@
  *********************************************************/
 
 #include "../string.h"
+#include "../../stats/stats.h"
 #include "../utf8.h"
+#include "kernel.h"
 #include <stdio.h>
 #include <stdint.h>
 #include <stdlib.h>
 #include <errno.h>
-#ifdef __J2_DEV__
-#include "../../../ext/viwerr/viwerr.h"
-#endif
-
 // #define zero_in_64(v)
 //         (((v) - 0x0101010101010101ULL) & ~(v) & 0x8080808080808080ULL)
 
@@ -99,32 +97,36 @@ j2string_strlen_sn(
 #ifdef __J2_DEV__
         if(!str) {
                 errno = EINVAL;
-                viwerr(VIWERR_PUSH, &(viwerr_package){
-                        .code = EINVAL,
-                        .name = (char*)"j2err: Invalid parameter...",
-                        .message = (char*)
-                                   "j2string_strlen_sn() / j2.string.clen()"
-                                   " parameter \"str\" is a NULL ptr.",
-                        .group = (char*)"j2"
-                });
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_strlen_sn() / j2.string.clen()"
+                        " parameter \"str\" is a NULL ptr.");
                 return 0;
         }
         if(max < 1) {
                 errno = EINVAL;
-                viwerr(VIWERR_PUSH, &(viwerr_package){
-                        .code = EINVAL,
-                        .name = (char*)"j2err: Invalid parameter...",
-                        .message = (char*)
-                                   "j2string_strlen_sn() / j2.string.clen()"
-                                   " parameter \"max\" is less than 1.",
-                        .group = (char*)"j2"
-                });
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_strlen_sn() / j2.string.clen()"
+                        " parameter \"max\" is less than 1.");
                 return 0;
         }
 #else
         if(max < 1) return 0;
 #endif
 
+        return j2string_kernel.strlen_sn(str, max);
+
+}
+
+/**
+ * @brief 
+ * Scalar kernel of j2string_strlen_sn(), reads 8 bytes at a time.
+ */
+size_t
+j2string_strlen_sn_scalar(
+        const char * str,
+        size_t max )
+{
+
         chunk_t chunk = 0;
         chunk_t * r = (chunk_t *)str;
         
@@ -207,32 +209,38 @@ j2string_utf8_strlen_sn(
 #ifdef __J2_DEV__
         if(!str) {
                 errno = EINVAL;
-                viwerr(VIWERR_PUSH, &(viwerr_package){
-                        .code = EINVAL,
-                        .name = (char*)"j2err: Invalid parameter...",
-                        .message = (char*)
-                                   "j2string_strlen_sn() / j2.string.clen()"
-                                   " parameter \"str\" is a NULL ptr.",
-                        .group = (char*)"j2"
-                });
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_strlen_sn() / j2.string.clen()"
+                        " parameter \"str\" is a NULL ptr.");
                 return 0;
         }
         if(max < 1) {
                 errno = EINVAL;
-                viwerr(VIWERR_PUSH, &(viwerr_package){
-                        .code = EINVAL,
-                        .name = (char*)"j2err: Invalid parameter...",
-                        .message = (char*)
-                                   "j2string_strlen_sn() / j2.string.clen()"
-                                   " parameter \"max\" is less than 1.",
-                        .group = (char*)"j2"
-                });
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_strlen_sn() / j2.string.clen()"
+                        " parameter \"max\" is less than 1.");
                 return 0;
         }
 #else
         if(max < 1) return 0;
 #endif
 
+        return j2string_kernel.utf8_strlen_sn(str, max, bytelen);
+
+}
+
+/**
+ * @brief 
+ * Scalar kernel of j2string_utf8_strlen_sn(), reads 8 bytes at a time and
+ * only looks at single bytes of chunks with non ASCII characters.
+ */
+size_t
+j2string_utf8_strlen_sn_scalar(
+        const char * str,
+        size_t max,
+        size_t * bytelen )
+{
+
         chunk_t chunk = 0;
         chunk_t * r = (chunk_t *)str;
         
@@ -388,7 +396,7 @@ j2string_utf8_strlen_sn(
 
 
                         if(rs[5] == 0) {
-                                if(bytelen) (*bytelen) = i*chunksize+4;
+                                if(bytelen) (*bytelen) = i*chunksize+5;
                                 return ch;
                         }
                         if(is_utf8_payload(rs[5])) ch++;
@@ -407,6 +415,7 @@ j2string_utf8_strlen_sn(
 
                 } else if(utf8_in_64(chunk)) {
                         
+                        J2_STATS_ADD(J2_STATS_UTF8_SLOW, 1);
                         unsigned char * rs = (unsigned char *)(&r[i]);
                         if(is_utf8_payload(rs[0])) ch++;
                         if(is_utf8_payload(rs[1])) ch++;
@@ -1,4 +1,5 @@
 #include "../utf8.h"
+#include <string.h>
 
 utf8_t utf8_init(
         uint8_t head )
@@ -26,4 +27,34 @@ utf8_t utf8_cat(
 
         return symbol;
 
-}
\ No newline at end of file
+}
+
+/**
+ * @brief 
+ * Characters in @c "size" bytes, every byte that isn't a UTF-8 
+ * continuation byte starts one. Null characters count like any byte.
+ */
+size_t utf8_count(
+        const char * bytes,
+        size_t size )
+{
+
+        size_t continuation = 0, i = 0;
+
+        for(; i + 8 <= size; i += 8) {
+                uint64_t chunk;
+                memcpy(&chunk, bytes + i, sizeof(chunk));
+                /// 10xxxxxx, top bit set and the one under it clear.
+                uint64_t mask = chunk & ~(chunk << 1) & 0x8080808080808080ULL;
+#if defined(__GNUC__)
+                if(mask) continuation += (size_t)__builtin_popcountll(mask);
+#else
+                for(; mask; mask &= mask - 1) continuation++;
+#endif
+        }
+        for(; i < size; i++)
+                if(((unsigned char)bytes[i] & 0xC0) == 0x80) continuation++;
+
+        return size - continuation;
+
+}
@@ -0,0 +1,118 @@
+/*** LICENSE: LGPLV2. *************************************
+ *                                                        *
+ *                                                        *
+ * This file is a part of the j2 project.                 *
+ * Copyright (C) 2022 Joško Križanović                    *
+ * <jkriza02@fesb.com>                                    *
+ *                                                        *
+ * This library is free software; you can redistribute    *
+ * it and/or modify it under the terms of the GNU Lesser  *
+ * General Public License as published by the Free        *
+ * Software Foundation; either version 2.1 of the         *
+ * License, or (at your option) any later version.        *
+ *                                                        *
+ * This library is distributed in the hope that it will   *
+ * be useful,                                             *
+ * but WITHOUT ANY WARRANTY; without even the implied     *
+ * warranty of MERCHANTABILITY or FITNESS FOR A           *
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public  *
+ * License for more details.                              *
+ *                                                        *
+ * You should have received a copy of the GNU Lesser      *
+ * General Public License along with this library; if     *
+ * not, write to the Free Software Foundation, Inc.,      *
+ * 51 Franklin Street, Fifth Floor, Boston,               *
+ * MA  02110-1301  USA                                    *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: FILE, AUTHOR & DATE INFORMATION. *********
+ *                                                        *
+ *                                                        *
+ * FILE:                                                  *
+ * 64 bit arithmetic helpers shared by the number writers *
+ * and parsers, a 128 bit product and a leading zero      *
+ * count.                                                 *
+ *                                                        *
+ *                                                        *
+ * AUTHOR:                                                *
+ *      NAME:  Joško Križanović                           *
+ *      EMAIL: jkriza02@fesb.com                          *
+ *                                                        *
+ *                                                        *
+ * DATE:                                                  *
+ * 19.10.2026.                                            *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+
+
+#include <stdint.h>
+
+#ifndef J2_STRING_VALMATH_INCLUDE
+#define J2_STRING_VALMATH_INCLUDE
+
+/**
+ * 128 bit multiplication helpers, GCC and Clang give us a native type for
+ * it on 64 bit targets, everyone else gets the schoolbook version.
+ */
+#if defined(__SIZEOF_INT128__)
+__extension__ typedef unsigned __int128 valmath_uint128;
+#endif
+
+/**
+ * Low 64 bits of @c "a * b", the high ones go into @c "(*high)".
+ */
+static inline uint64_t
+valmath_umul128(
+        uint64_t a,
+        uint64_t b,
+        uint64_t * high )
+{
+
+#if defined(__SIZEOF_INT128__)
+        valmath_uint128 r = (valmath_uint128)a * b;
+        (*high) = (uint64_t)(r >> 64);
+        return (uint64_t)r;
+#else
+        uint64_t alo = (uint32_t)a, ahi = a >> 32;
+        uint64_t blo = (uint32_t)b, bhi = b >> 32;
+
+        uint64_t b00 = alo * blo;
+        uint64_t b01 = alo * bhi;
+        uint64_t b10 = ahi * blo;
+        uint64_t b11 = ahi * bhi;
+
+        uint64_t mid1 = b10 + (b00 >> 32);
+        uint64_t mid2 = b01 + (uint32_t)mid1;
+
+        (*high) = b11 + (mid1 >> 32) + (mid2 >> 32);
+        return (mid2 << 32) | (uint32_t)b00;
+#endif
+
+}
+
+/**
+ * Count leading zeros of a non zero 64 bit value.
+ */
+static inline unsigned
+valmath_clz64(
+        uint64_t value )
+{
+
+#if defined(__GNUC__)
+        return (unsigned)__builtin_clzll(value);
+#else
+        unsigned n = 0;
+        while(!(value & 0x8000000000000000ULL)) {
+                value <<= 1;
+                n++;
+        }
+        return n;
+#endif
+
+}
+
+#endif
@@ -0,0 +1,239 @@
+/*** LICENSE: LGPLV2. *************************************
+ *                                                        *
+ *                                                        *
+ * This file is a part of the j2 project.                 *
+ * Copyright (C) 2022 Joško Križanović                    *
+ * <jkriza02@fesb.com>                                    *
+ *                                                        *
+ * This library is free software; you can redistribute    *
+ * it and/or modify it under the terms of the GNU Lesser  *
+ * General Public License as published by the Free        *
+ * Software Foundation; either version 2.1 of the         *
+ * License, or (at your option) any later version.        *
+ *                                                        *
+ * This library is distributed in the hope that it will   *
+ * be useful,                                             *
+ * but WITHOUT ANY WARRANTY; without even the implied     *
+ * warranty of MERCHANTABILITY or FITNESS FOR A           *
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public  *
+ * License for more details.                              *
+ *                                                        *
+ * You should have received a copy of the GNU Lesser      *
+ * General Public License along with this library; if     *
+ * not, write to the Free Software Foundation, Inc.,      *
+ * 51 Franklin Street, Fifth Floor, Boston,               *
+ * MA  02110-1301  USA                                    *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: FILE, AUTHOR & DATE INFORMATION. *********
+ *                                                        *
+ *                                                        *
+ * FILE:                                                  *
+ * Writing arrays of j2strings out to a file descriptor   *
+ * with writev(), straight from their payloads and        *
+ * without joining them first.                            *
+ *                                                        *
+ *                                                        *
+ * AUTHOR:                                                *
+ *      NAME:  Joško Križanović                           *
+ *      EMAIL: jkriza02@fesb.com                          *
+ *                                                        *
+ *                                                        *
+ * DATE:                                                  *
+ * 19.10.2026.                                            *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+
+
+#include "../string.h"
+#include <stdint.h>
+#include <limits.h>
+#include <errno.h>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#include <sys/uio.h>
+#endif
+
+/**
+ * @brief 
+ * Most iovecs a single writev() gets, IOV_MAX where the headers have it and
+ * the 1024 of Linux & the BSDs otherwise.
+ */
+#if defined(IOV_MAX) && IOV_MAX < 1024
+#define WRITEV_BATCH IOV_MAX
+#else
+#define WRITEV_BATCH 1024
+#endif
+
+/**
+ * @brief 
+ * Most bytes a single write() is asked for on Windows.
+ */
+#define WRITEV_WRITE_MAX _IEEE1541_INT_GiB(1)
+
+#ifdef _WIN32
+/**
+ * @brief 
+ * Windows has no writev(), write the strings one by one.
+ */
+static long
+writev_batch(
+        int fd,
+        const const_j2string * strings,
+        size_t count,
+        size_t * done )
+{
+
+        for(size_t i = 0; i < count; i++) {
+                const char * bytes = strings[i];
+                size_t left = J2_STRING_INFO(strings[i])->filled;
+                while(left) {
+                        size_t ask = left < WRITEV_WRITE_MAX ? 
+                                left : WRITEV_WRITE_MAX;
+                        int wrote = _write(fd, bytes, (unsigned)ask);
+                        if(wrote < 0) return -1;
+                        bytes += wrote;
+                        left  -= (size_t)wrote;
+                        *done += (size_t)wrote;
+                }
+        }
+
+        return 0;
+
+}
+#else
+/**
+ * @brief 
+ * Write @c "count" strings, at most WRITEV_BATCH of them, with as few 
+ * writev() calls as it takes. After a partial write the iovec it stopped
+ * in is moved up and the rest goes out with the next call.
+ */
+static long
+writev_batch(
+        int fd,
+        const const_j2string * strings,
+        size_t count,
+        size_t * done )
+{
+
+        struct iovec iov[WRITEV_BATCH];
+        int used = 0;
+
+        for(size_t i = 0; i < count; i++) {
+                size_t filled = J2_STRING_INFO(strings[i])->filled;
+                if(!filled) continue;
+                iov[used].iov_base = (void *)strings[i];
+                iov[used].iov_len  = filled;
+                used++;
+        }
+
+        struct iovec * next = iov;
+
+        while(used) {
+
+                ssize_t wrote = writev(fd, next, used);
+                if(wrote < 0) {
+                        if(errno == EINTR) continue;
+                        return -1;
+                }
+                *done += (size_t)wrote;
+
+                while(used && (size_t)wrote >= next->iov_len) {
+                        wrote -= (ssize_t)next->iov_len;
+                        next++;
+                        used--;
+                }
+                if(used) {
+                        next->iov_base = (uint8_t *)next->iov_base + wrote;
+                        next->iov_len -= (size_t)wrote;
+                }
+
+        }
+
+        return 0;
+
+}
+#endif
+
+/**
+ * @fn @c j2string_writev(3)
+ * 
+ *      @brief Write @c "count" j2strings to @c "fd" one after another, 
+ *      taken straight from their payloads with as few writev() calls as it
+ *      takes. Instead of joining fragments with j2string_cat() first or 
+ *      writing every one on its own, e.g. the parts of a response.
+ * 
+ *      Partial writes and EINTR are continued from where they stopped, 
+ *      empty strings are skipped and arrays longer than IOV_MAX go out in 
+ *      batches. Works with static, dynamic and mapped strings alike.
+ * 
+ * 
+ *      @param @b fd
+ *             File descriptor open for writing.
+ * 
+ *      @param @b strings
+ *             Array of @c "count" j2strings.
+ * 
+ *      @param @b count
+ *             Amount of strings in @c "strings".
+ * 
+ * 
+ *      @throw @a EINVAL - If @c "strings" or one of its strings is a NULL 
+ *                         ptr or not a j2string.
+ *      @throw @a ...    - Anything writev() throws, e.g. EAGAIN on a
+ *                         non blocking descriptor that is full.
+ * 
+ * 
+ *      @returns Amount of bytes written. If an error stops it after some
+ *      bytes went out it returns how many did, like write() would, with 
+ *      errno set, -1 if none did.
+ * 
+ */
+long
+j2string_writev(
+        int fd,
+        const const_j2string * strings,
+        size_t count )
+{
+
+#ifdef __J2_DEV__
+        if(!strings && count) {
+                errno = EINVAL;
+                J2_DIAG(J2_DIAG_INVALID,
+                        "j2string_writev() / j2.string.io.writev()"
+                        " parameter strings is a NULL ptr.");
+                return -1;
+        }
+        for(size_t i = 0; i < count; i++) {
+                const struct j2string_st * info = 
+                        strings[i] ? J2_STRING_INFO(strings[i]) : NULL;
+                if(!info) {
+                        errno = EINVAL;
+                        J2_DIAG(J2_DIAG_INVALID,
+                                "j2string_writev() / j2.string.io.writev()"
+                                " one of the strings is a NULL ptr or not"
+                                " a j2string.");
+                        return -1;
+                }
+        }
+#endif
+
+        size_t done = 0;
+
+        for(size_t i = 0; i < count; i += WRITEV_BATCH) {
+                size_t batch = count - i < WRITEV_BATCH ? 
+                        count - i : WRITEV_BATCH;
+                if(writev_batch(fd, strings + i, batch, &done) < 0) 
+                        return done ? (long)done : -1;
+        }
+
+        return (long)done;
+
+}
@@ -156,10 +156,9 @@
 #include <math.h>
 #include <stdbool.h>
 #include <stdint.h>
+#include <stdio.h>
 
-#ifdef __J2_DEV__
-#include "../../ext/viwerr/viwerr.h"
-#endif
+#include "../diag/diag.h"
 
 #include "../ieee1541.h"
 
@@ -199,6 +198,8 @@ typedef const char * __restrict const_restrict_j2string;
  *      @tparam @b filled
  *      @tparam @b max
  *      @tparam @b padding
+ *      @tparam @b reserved
+ *      @tparam @b hash
  *      @tparam @b ensure
  *   
  */
@@ -238,6 +239,20 @@ struct j2string_st{
          */
         size_t length;
 
+        /**
+         * @tparam @b reserved
+         * Set by j2string_reserve(), the size a dynamic string won't shrink
+         * under when j2string_update() applies the padding.
+         */
+        size_t reserved;
+
+        /**
+         * @tparam @b hash
+         * Cached j2string_hash() of the contents, J2_STRING_HASH_NONE until 
+         * it is asked for and after every change of the contents.
+         */
+        uint64_t hash;
+
         /**
          * @tparam @b ensure
          * Ensures (somewhat) the function that it is reading into
@@ -340,6 +355,14 @@ typedef struct j2string_param {
 
 #define J2_STRING_INFO(string) J2_STRING_REACH_FOR_STRUCT(string)
 
+/**
+ * @brief 
+ * Value of the hash field while there is no cached hash, forget the cached
+ * hash after changing the contents of a string by hand.
+ */
+#define J2_STRING_HASH_NONE 0
+#define J2_STRING_HASH_INVALIDATE(info) ((info)->hash = J2_STRING_HASH_NONE)
+
 /**
  * @brief 
  * Assert the fact that the string ends on a null character.
@@ -356,6 +379,45 @@ typedef struct j2string_param {
 #define J2_STRING_ASSERT_FILLED_NOCH(string, pos)\
         (string[pos] == '\0' ? 1 : 0)
 
+/**
+ * @enum @c j2string_primitive
+ * 
+ *      @brief Primitives with a kernel for every instruction set, the best
+ *      one the CPU has is picked when the library is loaded.
+ * 
+ *      @tparam @b J2_STRING_PRIMITIVE_STRLEN
+ *      j2string_strlen_sn().
+ *      @tparam @b J2_STRING_PRIMITIVE_UTF8_STRLEN
+ *      j2string_utf8_strlen_sn().
+ *      @tparam @b J2_STRING_PRIMITIVE_CNT
+ *      j2string_cnt().
+ *      @tparam @b J2_STRING_PRIMITIVE_STRCPY
+ *      j2string_strcpy_sn().
+ *      @tparam @b J2_STRING_PRIMITIVE_UTF8_STRCPY
+ *      j2string_utf8_strcpy_sn().
+ * 
+ */
+enum j2string_primitive {
+
+        J2_STRING_PRIMITIVE_STRLEN,
+        J2_STRING_PRIMITIVE_UTF8_STRLEN,
+        J2_STRING_PRIMITIVE_CNT,
+        J2_STRING_PRIMITIVE_STRCPY,
+        J2_STRING_PRIMITIVE_UTF8_STRCPY,
+        J2_STRING_PRIMITIVES
+
+};
+
+int
+j2string_kernel_pin(
+        const char * spec
+);
+
+const char *
+j2string_kernel_name(
+        enum j2string_primitive primitive
+);
+
 size_t
 j2string_strlen_sn(
         const char * str,
@@ -430,6 +492,22 @@ j2string_free(
         j2string string 
 );
 
+j2string
+j2string_reserve(
+        j2string string,
+        long size
+);
+
+j2string
+j2string_shrink_to_fit(
+        j2string string
+);
+
+void
+j2string_clear(
+        j2string string
+);
+
 long
 j2string_ccpy(
         restrict_j2string *   dst, 
@@ -479,6 +557,145 @@ j2string_noutf8_ccat(
         const char * __restrict src 
 );
 
+long
+j2string_catn(
+        restrict_j2string * dst,
+        const j2string * src,
+        size_t count
+);
+
+long
+j2string_ccatn(
+        restrict_j2string * dst,
+        const char * const * src,
+        size_t count
+);
+
+/**
+ * @brief Concatenate every following argument onto @c "(*dst)" with a 
+ *        single resize, e.g. @c j2string_cat_many(&str, a, b, c).
+ */
+#define j2string_cat_many(dst, ...)                                            \
+        j2string_catn((dst), (const j2string []){__VA_ARGS__},                 \
+                sizeof((const j2string []){__VA_ARGS__})/sizeof(j2string))
+
+/**
+ * @brief Same as @c j2string_cat_many() but for C type strings.
+ */
+#define j2string_ccat_many(dst, ...)                                           \
+        j2string_ccatn((dst), (const char * const []){__VA_ARGS__},            \
+                sizeof((const char * const []){__VA_ARGS__})/sizeof(char*))
+
+long
+j2string_read_fd(
+        restrict_j2string * string,
+        int fd
+);
+
+j2string
+j2string_read_file(
+        const char * path,
+        j2string_param parameters
+);
+
+long
+j2string_getline(
+        restrict_j2string * line,
+        FILE * stream
+);
+
+long
+j2string_writev(
+        int fd,
+        const const_j2string * strings,
+        size_t count
+);
+
+/**
+ * @brief
+ * Padding of a sink, a dynamic string that flushes its contents when they
+ * reach its high-water mark instead of growing.
+ */
+#define J2_STRING_SINK_PADDING SIZE_MAX
+
+/**
+ * @brief
+ * Callback a sink flushes @c "size" bytes to, returns 0 or -1 with errno
+ * set.
+ */
+typedef int (*j2string_sink_fn)(
+        const char * bytes,
+        size_t size,
+        void * data
+);
+
+j2string
+j2string_sink(
+        size_t highwater,
+        j2string_sink_fn write,
+        void * data
+);
+
+j2string
+j2string_sink_fd(
+        size_t highwater,
+        int fd
+);
+
+long
+j2string_sink_flush(
+        j2string string
+);
+
+long
+j2string_sink_close(
+        j2string string
+);
+
+/**
+ * @brief
+ * Flags of j2string_map(), the first three are hints for how the mapping
+ * will be read, the last one counts the UTF-8 length of the file instead of
+ * setting it to the byte count.
+ */
+#define J2_STRING_MAP_SEQUENTIAL 0x01
+#define J2_STRING_MAP_RANDOM     0x02
+#define J2_STRING_MAP_WILLNEED   0x04
+#define J2_STRING_MAP_LENGTH     0x08
+
+/**
+ * @brief
+ * Reserved size of a mapped string whose length is still its byte count,
+ * j2string_catn() counts the characters of such a piece itself. A static
+ * string never uses its reserved size.
+ */
+#define J2_STRING_MAP_UNCOUNTED SIZE_MAX
+#define J2_STRING_IS_UNCOUNTED(info)                                           \
+        ((info)->reserved == J2_STRING_MAP_UNCOUNTED)
+
+const_j2string
+j2string_map(
+        const char * path,
+        int flags
+);
+
+const_j2string
+j2string_map_fd(
+        int fd,
+        int flags
+);
+
+int
+j2string_map_advise(
+        const_j2string string,
+        int flags
+);
+
+void
+j2string_unmap(
+        const_j2string string
+);
+
 long
 j2string_cmp(
         const_restrict_j2string str1, 
@@ -522,6 +739,184 @@ j2string_cnt(
        unsigned char c 
 );
 
+long
+j2string_write_int(
+        restrict_j2string * dst,
+        int value 
+);
+
+long
+j2string_write_i8(
+        restrict_j2string * dst,
+        int8_t value 
+);
+
+long
+j2string_write_i16(
+        restrict_j2string * dst,
+        int16_t value 
+);
+
+long
+j2string_write_i32(
+        restrict_j2string * dst,
+        int32_t value 
+);
+
+long
+j2string_write_i64(
+        restrict_j2string * dst,
+        int64_t value 
+);
+
+long
+j2string_write_u8(
+        restrict_j2string * dst,
+        uint8_t value 
+);
+
+long
+j2string_write_u16(
+        restrict_j2string * dst,
+        uint16_t value 
+);
+
+long
+j2string_write_u32(
+        restrict_j2string * dst,
+        uint32_t value 
+);
+
+long
+j2string_write_u64(
+        restrict_j2string * dst,
+        uint64_t value 
+);
+
+long
+j2string_write_hex(
+        restrict_j2string * dst,
+        uint64_t value 
+);
+
+long
+j2string_write_float(
+        restrict_j2string * dst,
+        float value 
+);
+
+long
+j2string_write_double(
+        restrict_j2string * dst,
+        double value 
+);
+
+double
+j2string_strtod_sn(
+        const char * str,
+        size_t       max,
+        size_t * bytelen 
+);
+
+int64_t
+j2string_strtoi64_sn(
+        const char * str,
+        size_t       max,
+        size_t * bytelen 
+);
+
+uint64_t
+j2string_strtou64_sn(
+        const char * str,
+        size_t       max,
+        size_t * bytelen 
+);
+
+double
+j2string_read_double(
+        const_j2string string,
+        size_t         offset,
+        size_t *      bytelen 
+);
+
+int64_t
+j2string_read_i64(
+        const_j2string string,
+        size_t         offset,
+        size_t *      bytelen 
+);
+
+uint64_t
+j2string_read_u64(
+        const_j2string string,
+        size_t         offset,
+        size_t *      bytelen 
+);
+
+uint64_t
+j2string_hash_sn(
+        const char * str,
+        size_t bytes,
+        uint64_t seed
+);
+
+uint64_t
+j2string_chash_sn(
+        const char * str,
+        size_t bytes
+);
+
+uint64_t
+j2string_hash(
+        const_j2string string
+);
+
+/**
+ * @brief 
+ * Amount of independently locked shards inside of an intern pool, a power
+ * of 2 no bigger than 256.
+ */
+#define J2_STRING_INTERN_SHARDS 16
+
+/**
+ * @brief 
+ * Pool of interned j2strings, see j2string_intern_new().
+ */
+typedef struct j2string_intern_pool j2string_intern_pool;
+
+j2string_intern_pool *
+j2string_intern_new(
+        bool refcount
+);
+
+void
+j2string_intern_free(
+        j2string_intern_pool * pool
+);
+
+const_j2string
+j2string_intern(
+        j2string_intern_pool * pool,
+        const_j2string string
+);
+
+const_j2string
+j2string_cintern(
+        j2string_intern_pool * pool,
+        const char * cstr
+);
+
+void
+j2string_intern_release(
+        j2string_intern_pool * pool,
+        const_j2string string
+);
+
+size_t
+j2string_intern_count(
+        j2string_intern_pool * pool
+);
+
 #ifdef __cplusplus
 }
 #endif
@@ -108,6 +108,7 @@
 
 #include <stdarg.h>
 #include <stdint.h>
+#include <stddef.h>
 // #include "ieee1541.h"
 
 #ifndef J2_UTF8_H
@@ -233,4 +234,8 @@ utf8_t utf8_cat(
         utf8_t symbol, 
         uint8_t byte );
 
+size_t utf8_count(
+        const char * bytes,
+        size_t size );
+
 #endif
\ No newline at end of file
@@ -0,0 +1,690 @@
+/*** LICENSE: LGPLV2. *************************************
+ *                                                        *
+ *                                                        *
+ * This file is a part of the j2 project.                 *
+ * Copyright (C) 2022 Joško Križanović                    *
+ * <jkriza02@fesb.com>                                    *
+ *                                                        *
+ * This library is free software; you can redistribute    *
+ * it and/or modify it under the terms of the GNU Lesser  *
+ * General Public License as published by the Free        *
+ * Software Foundation; either version 2.1 of the         *
+ * License, or (at your option) any later version.        *
+ *                                                        *
+ * This library is distributed in the hope that it will   *
+ * be useful,                                             *
+ * but WITHOUT ANY WARRANTY; without even the implied     *
+ * warranty of MERCHANTABILITY or FITNESS FOR A           *
+ * PARTICULAR PURPOSE. See the GNU Lesser General Public  *
+ * License for more details.                              *
+ *                                                        *
+ * You should have received a copy of the GNU Lesser      *
+ * General Public License along with this library; if     *
+ * not, write to the Free Software Foundation, Inc.,      *
+ * 51 Franklin Street, Fifth Floor, Boston,               *
+ * MA  02110-1301  USA                                    *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/*** INSCRIBING: FILE, AUTHOR & DATE INFORMATION. *********
+ *                                                        *
+ *                                                        *
+ * FILE:                                                  *
+ * Smoke tests of the containers, run with make smoke.    *
+ * Every one is filled and emptied, the concurrent ones   *
+ * by several threads at once, and what is left is        *
+ * checked against what was done.                         *
+ *                                                        *
+ *                                                        *
+ * AUTHOR:                                                *
+ *      NAME:  Joško Križanović                           *
+ *      EMAIL: jkriza02@fesb.com                          *
+ *                                                        *
+ *                                                        *
+ * DATE:                                                  *
+ * 19.10.2026.                                            *
+ *                                                        *
+ *                                                        *
+ *********************************************************/
+
+/**
+ * @brief 
+ * Run with @c "make smoke", every test prints its name and @c "ok" or the
+ * first thing that went wrong, the exit status is the amount of failed 
+ * tests.
+ */
+
+#include "../j2.h"
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * @brief 
+ * Report @c "what" and fail the running test unless @c "cond" holds.
+ */
+#define SMOKE_CHECK(cond, what)                                                \
+        do {                                                                   \
+                if(!(cond)) {                                                  \
+                        printf("FAILED: %s (%s:%d)\n", what,                  \
+                               __FILE__, __LINE__);                            \
+                        return 1;                                              \
+                }                                                              \
+        } while(0)
+
+/**
+ * @brief 
+ * Deterministic per thread random numbers, xorshift64.
+ */
+static uint64_t
+smoke_rand(
+        uint64_t * state )
+{
+
+        (*state) ^= (*state) << 13;
+        (*state) ^= (*state) >> 7;
+        (*state) ^= (*state) << 17;
+        return (*state);
+
+}
+
+#define SMOKE_KERNEL_ROUNDS 20000
+#define SMOKE_KERNEL_BYTES  512
+
+/**
+ * @brief 
+ * Random text of ASCII, UTF-8 heads and continuation bytes in any order, so
+ * most of it is malformed, with a null character now and then.
+ */
+static void
+smoke_kernel_text(
+        uint64_t * state,
+        unsigned char * text,
+        size_t size )
+{
+
+        static const unsigned char bytes[] = {
+                'a', 'b', 'c', 'a', 'b', 'c', 0x80, 0xA9, 0xBF, 
+                0xC3, 0xE2, 0xF0, 0xFF
+        };
+
+        for(size_t i = 0; i < size; i++) {
+                uint64_t r = smoke_rand(state);
+                text[i] = r % 97 == 0 ? '\0' : bytes[r % sizeof(bytes)];
+        }
+        text[size - 1] = '\0';
+
+}
+
+/**
+ * @brief 
+ * Every SIMD kernel set the CPU runs has to give the scalar results, on 
+ * malformed UTF-8 too, at every offset and cut by every @c "max".
+ */
+static int
+smoke_kernels(void)
+{
+
+        static const char * sets[] = { "sse2", "avx2", "avx512", "neon" };
+        static unsigned char text[SMOKE_KERNEL_BYTES + 64];
+        static char copy[2][SMOKE_KERNEL_BYTES + 64];
+        uint64_t state = 3;
+
+        for(int round = 0; round < SMOKE_KERNEL_ROUNDS; round++) {
+
+                size_t offset = smoke_rand(&state) % 64;
+                size_t max = 1 + smoke_rand(&state) % SMOKE_KERNEL_BYTES;
+                const char * src = (const char *)text + offset;
+                size_t want[7], got[7];
+
+                smoke_kernel_text(&state, text, sizeof(text));
+                j2string string = j2.string.create.dy(src);
+                SMOKE_CHECK(string, "create");
+
+                SMOKE_CHECK(!j2.string.kernel.pin("scalar"), "pin scalar");
+                want[0] = j2string_strlen_sn(src, max);
+                want[1] = j2string_utf8_strlen_sn(src, max, &want[2]);
+                want[3] = (size_t)j2string_cnt(string, 'a');
+                want[4] = j2string_strcpy_sn(copy[0], src, max);
+                want[5] = j2string_utf8_strcpy_sn(copy[0] + SMOKE_KERNEL_BYTES
+                                                  / 2, src, max / 2 + 1, 
+                                                  &want[6]);
+
+                for(size_t set = 0; set < sizeof(sets)/sizeof(sets[0]); 
+                    set++) {
+
+                        /// Sets the CPU can't run are skipped.
+                        if(j2.string.kernel.pin(sets[set])) continue;
+
+                        memcpy(copy[1], copy[0], sizeof(copy[1]));
+                        got[0] = j2string_strlen_sn(src, max);
+                        got[1] = j2string_utf8_strlen_sn(src, max, &got[2]);
+                        got[3] = (size_t)j2string_cnt(string, 'a');
+                        got[4] = j2string_strcpy_sn(copy[1], src, max);
+                        got[5] = j2string_utf8_strcpy_sn(copy[1] 
+                                                         + SMOKE_KERNEL_BYTES
+                                                         / 2, src, 
+                                                         max / 2 + 1, 
+                                                         &got[6]);
+
+                        SMOKE_CHECK(!memcmp(want, got, sizeof(want)), 
+                                    sets[set]);
+                        SMOKE_CHECK(!memcmp(copy[0], copy[1], 
+                                            sizeof(copy[1])), 
+                                    sets[set]);
+
+                }
+
+                j2string_free(string);
+
+        }
+
+        /// Back to the best kernels for the other tests.
+        j2.string.kernel.pin(NULL);
+
+        return 0;
+
+}
+
+#define SMOKE_CHT_WRITERS 2
+#define SMOKE_CHT_READERS 4
+#define SMOKE_CHT_KEYS    2048
+#define SMOKE_CHT_ROUNDS  50000
+
+static j2chashtable * smoke_cht_int;
+static j2chashtable * smoke_cht_str;
+static atomic_int  smoke_cht_stop;
+static atomic_long smoke_cht_bad;
+
+/**
+ * @brief 
+ * The value every key maps to, a reader that finds anything else saw a
+ * torn or freed entry.
+ */
+#define SMOKE_CHT_VALUE(key) ((void *)(uintptr_t)((key) * 7 + 1))
+
+static void
+smoke_cht_key(
+        char * buf,
+        size_t size,
+        uint64_t key )
+{
+        snprintf(buf, size, "key%llu", (unsigned long long)key);
+}
+
+/**
+ * @brief 
+ * Looks up random keys in both tables until the writers are done.
+ */
+static void *
+smoke_cht_reader(
+        void * arg )
+{
+
+        uint64_t state = (uintptr_t)arg;
+        char buf[32];
+        void * value;
+
+        while(!atomic_load(&smoke_cht_stop)) {
+
+                uint64_t key = smoke_rand(&state) % SMOKE_CHT_KEYS;
+
+                if(j2.chashtable.integer.get(smoke_cht_int, key, &value)
+                && value != SMOKE_CHT_VALUE(key))
+                        atomic_fetch_add(&smoke_cht_bad, 1);
+
+                smoke_cht_key(buf, sizeof(buf), key);
+                if(j2.chashtable.cget(smoke_cht_str, buf, &value)
+                && value != SMOKE_CHT_VALUE(key))
+                        atomic_fetch_add(&smoke_cht_bad, 1);
+
+        }
+
+        return NULL;
+
+}
+
+/**
+ * @brief 
+ * Sets and removes random keys of its own share (every key modulo 
+ * SMOKE_CHT_WRITERS), the last round sets the even keys and removes the 
+ * odd ones so the end state is known.
+ */
+static void *
+smoke_cht_writer(
+        void * arg )
+{
+
+        uint64_t id = (uintptr_t)arg, state = id + 11;
+        char buf[32];
+
+        for(int i = 0; i < SMOKE_CHT_ROUNDS; i++) {
+
+                uint64_t key = smoke_rand(&state) % SMOKE_CHT_KEYS;
+                key -= key % SMOKE_CHT_WRITERS;
+                key += id;
+                if(key >= SMOKE_CHT_KEYS) continue;
+
+                smoke_cht_key(buf, sizeof(buf), key);
+                if(smoke_rand(&state) & 1) {
+                        j2.chashtable.integer.set(smoke_cht_int, key, 
+                                                  SMOKE_CHT_VALUE(key));
+                        j2.chashtable.cset(smoke_cht_str, buf, 
+                                           SMOKE_CHT_VALUE(key));
+                } else {
+                        j2.chashtable.integer.remove(smoke_cht_int, key, NULL);
+                        j2.chashtable.cremove(smoke_cht_str, buf, NULL);
+                }
+
+        }
+
+        for(uint64_t key = id; key < SMOKE_CHT_KEYS; 
+            key += SMOKE_CHT_WRITERS) {
+
+                smoke_cht_key(buf, sizeof(buf), key);
+                if(key % 2 == 0) {
+                        j2.chashtable.integer.set(smoke_cht_int, key, 
+                                                  SMOKE_CHT_VALUE(key));
+                        j2.chashtable.cset(smoke_cht_str, buf, 
+                                           SMOKE_CHT_VALUE(key));
+                } else {
+                        j2.chashtable.integer.remove(smoke_cht_int, key, NULL);
+                        j2.chashtable.cremove(smoke_cht_str, buf, NULL);
+                }
+
+        }
+
+        return NULL;
+
+}
+
+/**
+ * @brief 
+ * Writers set and remove keys of an integer and a string table while 
+ * readers look them up, starting small so the tables grow under the 
+ * readers.
+ */
+static int
+smoke_chashtable(void)
+{
+
+        pthread_t readers[SMOKE_CHT_READERS], writers[SMOKE_CHT_WRITERS];
+        char buf[32];
+        void * value;
+
+        smoke_cht_int = j2.chashtable.create(J2_CHASHTABLE_INTEGER, 0);
+        smoke_cht_str = j2.chashtable.create(J2_CHASHTABLE_STRING, 0);
+        SMOKE_CHECK(smoke_cht_int && smoke_cht_str, "create");
+
+        for(uintptr_t i = 0; i < SMOKE_CHT_READERS; i++)
+                pthread_create(&readers[i], NULL, &smoke_cht_reader, 
+                               (void *)(i + 1));
+        for(uintptr_t i = 0; i < SMOKE_CHT_WRITERS; i++)
+                pthread_create(&writers[i], NULL, &smoke_cht_writer, 
+                               (void *)i);
+
+        for(int i = 0; i < SMOKE_CHT_WRITERS; i++)
+                pthread_join(writers[i], NULL);
+        atomic_store(&smoke_cht_stop, 1);
+        for(int i = 0; i < SMOKE_CHT_READERS; i++)
+                pthread_join(readers[i], NULL);
+
+        SMOKE_CHECK(atomic_load(&smoke_cht_bad) == 0, 
+                    "a reader saw a wrong value");
+        SMOKE_CHECK(j2.chashtable.count(smoke_cht_int) == SMOKE_CHT_KEYS / 2,
+                    "integer table count");
+        SMOKE_CHECK(j2.chashtable.count(smoke_cht_str) == SMOKE_CHT_KEYS / 2,
+                    "string table count");
+
+        for(uint64_t key = 0; key < SMOKE_CHT_KEYS; key++) {
+
+                bool want = key % 2 == 0;
+                smoke_cht_key(buf, sizeof(buf), key);
+
+                value = NULL;
+                SMOKE_CHECK(j2.chashtable.integer.get(smoke_cht_int, key, 
+                                                      &value) == want,
+                            "integer key after the writers");
+                SMOKE_CHECK(!want || value == SMOKE_CHT_VALUE(key),
+                            "integer value after the writers");
+
+                value = NULL;
+                SMOKE_CHECK(j2.chashtable.cget(smoke_cht_str, buf, 
+                                               &value) == want,
+                            "string key after the writers");
+                SMOKE_CHECK(!want || value == SMOKE_CHT_VALUE(key),
+                            "string value after the writers");
+
+        }
+
+        /// Everything removed is freed once the readers are gone.
+        j2.chashtable.synchronize(smoke_cht_int);
+        j2.chashtable.synchronize(smoke_cht_str);
+        j2.chashtable.free(smoke_cht_int);
+        j2.chashtable.free(smoke_cht_str);
+
+        return 0;
+
+}
+
+#define SMOKE_CQ_ELEMENTS  200000
+#define SMOKE_CQ_CAPACITY  1000
+#define SMOKE_CQ_PRODUCERS 4
+#define SMOKE_CQ_CONSUMERS 4
+
+static j2cqueue_spsc * smoke_cq_spsc;
+static j2cqueue_mpmc * smoke_cq_mpmc;
+static atomic_long  smoke_cq_popped;
+static atomic_ulong smoke_cq_sum;
+
+/**
+ * @brief 
+ * Pushes 0, 1, 2, ... one at a time and in bursts of 7.
+ */
+static void *
+smoke_spsc_producer(
+        void * arg )
+{
+
+        uint64_t i = 0, burst[7];
+
+        while(i < SMOKE_CQ_ELEMENTS) {
+
+                if(i % 3) {
+                        if(j2.cqueue.spsc.push(smoke_cq_spsc, &i)) i++;
+                        continue;
+                }
+
+                size_t count = SMOKE_CQ_ELEMENTS - i < 7 
+                             ? SMOKE_CQ_ELEMENTS - i : 7;
+                for(size_t k = 0; k < count; k++) burst[k] = i + k;
+                i += j2.cqueue.spsc.push_n(smoke_cq_spsc, burst, count);
+
+        }
+
+        return NULL;
+
+}
+
+/**
+ * @brief 
+ * Pops one at a time and in bursts of 5, everything has to come out in 
+ * the order it went in. Returns a non NULL pointer if it didn't.
+ */
+static void *
+smoke_spsc_consumer(
+        void * arg )
+{
+
+        uint64_t expect = 0, burst[5], element;
+
+        while(expect < SMOKE_CQ_ELEMENTS) {
+
+                size_t got = j2.cqueue.spsc.pop_n(smoke_cq_spsc, burst, 5);
+                for(size_t k = 0; k < got; k++) 
+                        if(burst[k] != expect++) return arg;
+
+                if(j2.cqueue.spsc.pop(smoke_cq_spsc, &element)
+                && element != expect++) 
+                        return arg;
+
+        }
+
+        return NULL;
+
+}
+
+/**
+ * @brief 
+ * Pushes its own share of the numbers below SMOKE_CQ_ELEMENTS.
+ */
+static void *
+smoke_mpmc_producer(
+        void * arg )
+{
+
+        uint64_t id = (uintptr_t)arg;
+
+        for(uint64_t i = id; i < SMOKE_CQ_ELEMENTS;) {
+                if(j2.cqueue.mpmc.push(smoke_cq_mpmc, &i)) 
+                        i += SMOKE_CQ_PRODUCERS;
+        }
+
+        return NULL;
+
+}
+
+/**
+ * @brief 
+ * Pops until every element is out and sums them up.
+ */
+static void *
+smoke_mpmc_consumer(
+        void * arg )
+{
+
+        uint64_t element;
+
+        while(atomic_load(&smoke_cq_popped) < SMOKE_CQ_ELEMENTS) {
+                if(!j2.cqueue.mpmc.pop(smoke_cq_mpmc, &element)) continue;
+                atomic_fetch_add(&smoke_cq_sum, element);
+                atomic_fetch_add(&smoke_cq_popped, 1);
+        }
+
+        return NULL;
+
+}
+
+/**
+ * @brief 
+ * One producer and one consumer on a SPSC queue have to keep the order,
+ * several of both on a MPMC queue have to hand out every element once.
+ * Both queues are smaller than what goes through them so they wrap and 
+ * run full and empty.
+ */
+static int
+smoke_cqueue(void)
+{
+
+        pthread_t producers[SMOKE_CQ_PRODUCERS], consumers[SMOKE_CQ_CONSUMERS];
+        void * result;
+
+        smoke_cq_spsc = j2.cqueue.spsc.create(sizeof(uint64_t), 
+                                              SMOKE_CQ_CAPACITY);
+        smoke_cq_mpmc = j2.cqueue.mpmc.create(sizeof(uint64_t), 
+                                              SMOKE_CQ_CAPACITY);
+        SMOKE_CHECK(smoke_cq_spsc && smoke_cq_mpmc, "create");
+
+        pthread_create(&producers[0], NULL, &smoke_spsc_producer, NULL);
+        pthread_create(&consumers[0], NULL, &smoke_spsc_consumer, 
+                       (void *)smoke_cq_spsc);
+        pthread_join(producers[0], NULL);
+        pthread_join(consumers[0], &result);
+        SMOKE_CHECK(result == NULL, "spsc order");
+        SMOKE_CHECK(j2.cqueue.spsc.count(smoke_cq_spsc) == 0, "spsc count");
+
+        for(uintptr_t i = 0; i < SMOKE_CQ_PRODUCERS; i++)
+                pthread_create(&producers[i], NULL, &smoke_mpmc_producer, 
+                               (void *)i);
+        for(int i = 0; i < SMOKE_CQ_CONSUMERS; i++)
+                pthread_create(&consumers[i], NULL, &smoke_mpmc_consumer, 
+                               NULL);
+        for(int i = 0; i < SMOKE_CQ_PRODUCERS; i++)
+                pthread_join(producers[i], NULL);
+        for(int i = 0; i < SMOKE_CQ_CONSUMERS; i++)
+                pthread_join(consumers[i], NULL);
+
+        SMOKE_CHECK(atomic_load(&smoke_cq_popped) == SMOKE_CQ_ELEMENTS,
+                    "mpmc popped more than was pushed");
+        SMOKE_CHECK(atomic_load(&smoke_cq_sum) == 
+                    (uint64_t)SMOKE_CQ_ELEMENTS * (SMOKE_CQ_ELEMENTS - 1) / 2,
+                    "mpmc lost or doubled an element");
+        SMOKE_CHECK(j2.cqueue.mpmc.count(smoke_cq_mpmc) == 0, "mpmc count");
+
+        j2.cqueue.spsc.free(smoke_cq_spsc);
+        j2.cqueue.mpmc.free(smoke_cq_mpmc);
+
+        return 0;
+
+}
+
+#define SMOKE_ART_PATHS 5000
+#define SMOKE_ART_KEYS  (SMOKE_ART_PATHS * 2 + 255)
+
+static char smoke_art_keys[SMOKE_ART_KEYS][32];
+
+/**
+ * @brief 
+ * What a walk saw, the keys have to come in byte order and every one 
+ * with its own value.
+ */
+struct smoke_art_walk {
+        const char * last;
+        size_t count;
+        int bad;
+};
+
+static int
+smoke_art_visit(
+        void * data,
+        const char * key,
+        size_t bytes,
+        void * value )
+{
+
+        struct smoke_art_walk * walk = data;
+        size_t index = (uintptr_t)value - 1;
+
+        if(index >= SMOKE_ART_KEYS
+        || strcmp(smoke_art_keys[index], key)
+        || strlen(key) != bytes
+        || (walk->last && strcmp(walk->last, key) >= 0))
+                walk->bad++;
+
+        walk->last = key;
+        walk->count++;
+        return 0;
+
+}
+
+/**
+ * @brief 
+ * Fills a tree with paths sharing long prefixes, UTF-8 keys and every 
+ * byte after a common one (so the node types grow up to the biggest), 
+ * then walks it and empties it again.
+ */
+static int
+smoke_art(void)
+{
+
+        j2art * tree = j2.art.create();
+        struct smoke_art_walk walk = {0};
+        void * value;
+        size_t keys = 0;
+
+        SMOKE_CHECK(tree, "create");
+
+        for(unsigned i = 0; i < SMOKE_ART_PATHS; i++) {
+                snprintf(smoke_art_keys[keys++], 32, "/path/%u", i);
+                snprintf(smoke_art_keys[keys++], 32, "ključ-%u-šč", i);
+        }
+        for(unsigned i = 1; i <= 255; i++) {
+                smoke_art_keys[keys][0] = '~';
+                smoke_art_keys[keys][1] = (char)i;
+                smoke_art_keys[keys++][2] = '\0';
+        }
+
+        for(size_t i = 0; i < keys; i++)
+                SMOKE_CHECK(j2.art.cset(tree, smoke_art_keys[i], 
+                                        (void *)(uintptr_t)(i + 1)) == 1,
+                            "set of a new key");
+        for(size_t i = 0; i < keys; i += 2)
+                SMOKE_CHECK(j2.art.cset(tree, smoke_art_keys[i], 
+                                        (void *)(uintptr_t)(i + 1)) == 0,
+                            "set of a key already there");
+        SMOKE_CHECK(j2.art.count(tree) == keys, "count after the sets");
+
+        for(size_t i = 0; i < keys; i++) {
+                void ** found = j2.art.cget(tree, smoke_art_keys[i]);
+                SMOKE_CHECK(found && (*found) == (void *)(uintptr_t)(i + 1),
+                            "get after the sets");
+        }
+        SMOKE_CHECK(!j2.art.cget(tree, "/path/"), "get of a prefix");
+        SMOKE_CHECK(!j2.art.cget(tree, "/path/50000"), "get of a longer key");
+
+        j2.art.walk(tree, &smoke_art_visit, &walk);
+        SMOKE_CHECK(!walk.bad && walk.count == keys, "walk");
+
+        /// "/path/1", "/path/10" to "/path/19", ... up to "/path/1999".
+        walk = (struct smoke_art_walk){0};
+        j2.art.walk_prefix(tree, "/path/1", &smoke_art_visit, &walk);
+        SMOKE_CHECK(!walk.bad && walk.count == 1111, "walk of a prefix");
+
+        for(size_t i = 1; i < keys; i += 2) {
+                value = NULL;
+                SMOKE_CHECK(j2.art.cremove(tree, smoke_art_keys[i], &value)
+                         && value == (void *)(uintptr_t)(i + 1),
+                            "remove");
+                SMOKE_CHECK(!j2.art.cremove(tree, smoke_art_keys[i], NULL),
+                            "remove of a removed key");
+        }
+        SMOKE_CHECK(j2.art.count(tree) == (keys + 1) / 2, 
+                    "count after the removes");
+
+        for(size_t i = 0; i < keys; i++) {
+                void ** found = j2.art.cget(tree, smoke_art_keys[i]);
+                SMOKE_CHECK((i % 2 == 0) == (found != NULL), 
+                            "get after the removes");
+        }
+
+        walk = (struct smoke_art_walk){0};
+        j2.art.walk(tree, &smoke_art_visit, &walk);
+        SMOKE_CHECK(!walk.bad && walk.count == (keys + 1) / 2, 
+                    "walk after the removes");
+
+        for(size_t i = 0; i < keys; i += 2)
+                SMOKE_CHECK(j2.art.cremove(tree, smoke_art_keys[i], NULL),
+                            "remove of the rest");
+        SMOKE_CHECK(j2.art.count(tree) == 0, "count of an empty tree");
+
+        walk = (struct smoke_art_walk){0};
+        j2.art.walk(tree, &smoke_art_visit, &walk);
+        SMOKE_CHECK(walk.count == 0, "walk of an empty tree");
+
+        j2.art.free(tree);
+
+        return 0;
+
+}
+
+/**
+ * @brief 
+ * Every test, returns 0 when it passed.
+ */
+static const struct {
+        const char * name;
+        int (*run)(void);
+} smoke_tests[] = {
+        { "kernels",    &smoke_kernels    },
+        { "chashtable", &smoke_chashtable },
+        { "cqueue",     &smoke_cqueue     },
+        { "art",        &smoke_art        },
+};
+
+int main(void) {
+
+        int failed = 0;
+
+        for(size_t i = 0; i < sizeof(smoke_tests)/sizeof(smoke_tests[0]); 
+            i++) {
+                printf("[%s]\n", smoke_tests[i].name);
+                if(smoke_tests[i].run()) failed++;
+                else printf("ok\n");
+        }
+
+        return failed;
+
+}
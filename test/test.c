@@ -8,6 +8,25 @@
 #include <Windows.h>
 #include <locale.h>
 #endif
+
+/**
+ * @brief 
+ * Forward the diagnostics of the development checks to viwerr.
+ */
+static void
+test_diag(
+        enum j2diag_code code,
+        const char * detail,
+        void * data )
+{
+        viwerr(VIWERR_PUSH, &(viwerr_package){
+                .code    = j2.diag.errno_of(code),
+                .group   = (char*)"j2",
+                .name    = (char*)j2.diag.message(code),
+                .message = (char*)detail
+        });
+}
+
 int main() {
 
 #ifndef __linux__
@@ -15,6 +34,8 @@ int main() {
 	SetConsoleOutputCP(CP_UTF8);
 #endif
 
+        j2.diag.set_hook(&test_diag, NULL);
+
         j2string stringy = j2.string.create.st("🍌👍");
         printf("[%d]%s\n", J2_STRING_INFO(stringy)->length, stringy);
 	// printf(stringy);